@@ -0,0 +1,81 @@
+///
+/// @file       bench_cases.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for declaring the groups of benchmarks that make up the benchmark executable.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_BENCH_CASES_HEADER_GUARD
+#define LEAF_SRC_BENCH_CASES_HEADER_GUARD
+
+#include <string>
+#include "benchmark_suite.hpp"
+
+namespace leaf
+{
+    ///
+    /// @brief  Runs the benchmarks for creating and destroying windows.
+    ///
+    /// @param  suite   the suite to run the benchmarks in
+    ///
+    void run_window_lifecycle_benchmarks(benchmark_suite &suite);
+
+    ///
+    /// @brief  Runs the benchmarks for routing events to windows and fanning them out to handlers.
+    ///
+    /// @param  suite   the suite to run the benchmarks in
+    ///
+    void run_event_benchmarks(benchmark_suite &suite);
+
+    ///
+    /// @brief  Runs the benchmark that replays an SDL event recording at maximum speed. It is
+    ///         skipped if no recording is given.
+    ///
+    /// @param  suite           the suite to run the benchmark in
+    /// @param  recording_path  the path of the recording or an empty string
+    ///
+    void run_replay_benchmarks(benchmark_suite &suite, const std::string &recording_path);
+
+    ///
+    /// @brief  Runs the benchmarks for reading and writing window properties.
+    ///
+    /// @param  suite   the suite to run the benchmarks in
+    ///
+    void run_window_property_benchmarks(benchmark_suite &suite);
+
+    ///
+    /// @brief  Runs the benchmarks for formatting geometry types.
+    ///
+    /// @param  suite   the suite to run the benchmarks in
+    ///
+    void run_geometry_benchmarks(benchmark_suite &suite);
+
+    ///
+    /// @brief  Runs the benchmarks for logging messages.
+    ///
+    /// @param  suite   the suite to run the benchmarks in
+    ///
+    void run_log_benchmarks(benchmark_suite &suite);
+
+    ///
+    /// @brief  Runs the benchmarks for laying out a widget tree after its window was resized.
+    ///
+    /// @param  suite   the suite to run the benchmarks in
+    ///
+    void run_layout_benchmarks(benchmark_suite &suite);
+
+    ///
+    /// @brief  Runs the benchmarks for laying out text with and without a text layout cache, and
+    ///         for rasterizing glyphs as bitmaps and as distance fields. They are skipped if no
+    ///         font is given.
+    ///
+    /// @param  suite       the suite to run the benchmarks in
+    /// @param  font_path   the path of a TrueType font or an empty string
+    ///
+    void run_text_benchmarks(benchmark_suite &suite, const std::string &font_path);
+}
+
+#endif
@@ -0,0 +1,344 @@
+///
+/// @file       bench_events.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Benchmarks for routing events to their subject windows and fanning them out to
+///             subscribed handlers. SDL benchmarks are skipped when no video display is available.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <SDL3/SDL.h>
+#include "../window/managed/headless/headless.hpp"
+#include "../window/managed/sdl/sdl.hpp"
+#include "../window/managed/sdl/sdl_event_replayer.hpp"
+#include "bench_cases.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    ///
+    /// @brief  The number of events queued between polls. SDL's event queue holds at most 65535
+    ///         events, so batches must stay well below that.
+    ///
+    static const uint64_t f_events_per_poll = 256;
+
+    ///
+    /// @brief  The window counts events are routed across.
+    ///
+    static const size_t f_window_counts[] = {1, 10, 100, 1000};
+
+    ///
+    /// @brief  The handler counts events are fanned out to.
+    ///
+    static const size_t f_handler_counts[] = {1, 10, 100};
+
+    ///
+    /// @brief  A window event handler that counts minimizations.
+    ///
+    class counting_handler : public window_event_handler_i
+    {
+        public:
+            ///
+            /// @brief  The number of minimizations the handler was notified of.
+            ///
+            uint64_t count = 0;
+
+            virtual void closed(void) noexcept override {}
+
+            virtual void user_requested_close(void) noexcept override {}
+
+            virtual void minimized(void) noexcept override
+            {
+                count++;
+            }
+    };
+
+    ///
+    /// @brief  Pushes a minimization event for the window with the given SDL ID onto the SDL event
+    ///         queue.
+    ///
+    /// @param  window_id   the SDL ID of the subject window, 0 for no window
+    ///
+    /// @return true if and only if SDL queued the event
+    ///
+    static bool push_sdl_event(uint32_t window_id) noexcept
+    {
+        SDL_Event event;
+        SDL_memset(&event, 0, sizeof(event));
+        event.type = SDL_EVENT_WINDOW_MINIMIZED;
+        event.window.windowID = window_id;
+
+        return SDL_PushEvent(&event) > 0;
+    }
+
+    ///
+    /// @brief  Runs the benchmarks that route events across headless windows.
+    ///
+    /// @param  suite   the suite to run the benchmarks in
+    ///
+    static void run_headless_routing_benchmarks(benchmark_suite &suite)
+    {
+        for (size_t window_count : f_window_counts)
+        {
+            string name = "events/route/headless/" + std::to_string(window_count);
+
+            if (!suite.selected(name))
+            {
+                continue;
+            }
+
+            vector<unique_ptr<headless_window>> windows;
+
+            for (size_t i = 0; i < window_count; i++)
+            {
+                windows.emplace_back(new headless_window());
+            }
+
+            // Queue minimizations round robin across the windows and deliver them in batches.
+            suite.run(name, [&windows](uint64_t iterations)
+            {
+                for (uint64_t i = 0; i < iterations; i++)
+                {
+                    windows[i % windows.size()]->inject_minimize();
+
+                    if ((i + 1) % f_events_per_poll == 0)
+                    {
+                        headless::instance.poll_events();
+                    }
+                }
+
+                headless::instance.poll_events();
+            });
+        }
+    }
+
+    ///
+    /// @brief  Runs the benchmarks that route SDL events across SDL windows.
+    ///
+    /// @param  suite   the suite to run the benchmarks in
+    ///
+    static void run_sdl_routing_benchmarks(benchmark_suite &suite)
+    {
+        // Make sure SDL queues events at all, so that an empty queue is not timed instead.
+        if (!push_sdl_event(0))
+        {
+            string reason = SDL_GetError();
+            suite.skip("events/route/sdl/queue_only", reason);
+
+            for (size_t window_count : f_window_counts)
+            {
+                suite.skip("events/route/sdl/" + std::to_string(window_count), reason);
+            }
+
+            return;
+        }
+
+        sdl::instance.poll_events();
+
+        // Measure the SDL queue alone with events that have no subject window, so the cost of
+        // routing can be told apart from the cost of SDL's queue.
+        suite.run("events/route/sdl/queue_only", [](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                push_sdl_event(0);
+
+                if ((i + 1) % f_events_per_poll == 0)
+                {
+                    sdl::instance.poll_events();
+                }
+            }
+
+            sdl::instance.poll_events();
+        });
+
+        for (size_t window_count : f_window_counts)
+        {
+            string name = "events/route/sdl/" + std::to_string(window_count);
+
+            if (!suite.selected(name))
+            {
+                continue;
+            }
+
+            // Create the windows, skipping the benchmark if no display is available.
+            vector<unique_ptr<sdl_window>> windows;
+
+            try
+            {
+                for (size_t i = 0; i < window_count; i++)
+                {
+                    windows.emplace_back(new sdl_window("bench", 0, 0, 100, 100));
+                }
+            }
+            catch (const runtime_error &exc)
+            {
+                suite.skip(name, exc.what());
+                continue;
+            }
+
+            vector<uint32_t> ids;
+
+            for (const unique_ptr<sdl_window> &window : windows)
+            {
+                ids.push_back(window->id());
+            }
+
+            // Push minimizations round robin across the windows and route them in batches.
+            suite.run(name, [&ids](uint64_t iterations)
+            {
+                for (uint64_t i = 0; i < iterations; i++)
+                {
+                    push_sdl_event(ids[i % ids.size()]);
+
+                    if ((i + 1) % f_events_per_poll == 0)
+                    {
+                        sdl::instance.poll_events();
+                    }
+                }
+
+                sdl::instance.poll_events();
+            });
+        }
+    }
+
+    ///
+    /// @brief  Runs the benchmarks that fan events out to handlers of a headless window, with and
+    ///         without collecting latency metrics.
+    ///
+    /// @param  suite   the suite to run the benchmarks in
+    ///
+    static void run_fan_out_benchmarks(benchmark_suite &suite)
+    {
+        for (bool collects_metrics : {false, true})
+        {
+            for (size_t handler_count : f_handler_counts)
+            {
+                string name = string("events/fan_out/headless/") + (collects_metrics ? "metrics/"
+                    : "") + std::to_string(handler_count);
+
+                if (!suite.selected(name))
+                {
+                    continue;
+                }
+
+                // The handlers are declared first so that they outlive the window, which notifies
+                // them when it closes.
+                vector<counting_handler> handlers(handler_count);
+                headless_window window;
+                window.event_manager()->set_collects_metrics(collects_metrics);
+
+                for (counting_handler &handler : handlers)
+                {
+                    window.event_manager()->subscribe_overridden(&handler);
+                }
+
+                // Queue minimizations and deliver them in batches. Each is dispatched to every
+                // handler.
+                suite.run(name, [&window](uint64_t iterations)
+                {
+                    for (uint64_t i = 0; i < iterations; i++)
+                    {
+                        window.inject_minimize();
+
+                        if ((i + 1) % f_events_per_poll == 0)
+                        {
+                            headless::instance.poll_events();
+                        }
+                    }
+
+                    headless::instance.poll_events();
+                });
+
+                // Report how many notifications were delivered so that a regression in dispatch
+                // correctness shows up next to the timing.
+                suite.add_counter("notifications", (double)handlers.front().count);
+            }
+        }
+    }
+
+    void run_replay_benchmarks(benchmark_suite &suite, const string &recording_path)
+    {
+        const string name = "events/replay/sdl";
+
+        if (!suite.selected(name))
+        {
+            return;
+        }
+
+        if (recording_path.empty())
+        {
+            suite.skip(name, "No recording was given with --replay.");
+            return;
+        }
+
+        // Load the recording and create a window for each window it recorded events for, skipping
+        // the benchmark if no display is available.
+        unique_ptr<sdl_event_replayer> replayer;
+        vector<unique_ptr<sdl_window>> windows;
+
+        try
+        {
+            replayer.reset(new sdl_event_replayer(recording_path));
+
+            for (uint32_t recorded_id : replayer->recorded_window_ids())
+            {
+                windows.emplace_back(new sdl_window("bench", 0, 0, 200, 200));
+                replayer->map_window(recorded_id, windows.back().get());
+            }
+        }
+        catch (const runtime_error &exc)
+        {
+            suite.skip(name, exc.what());
+            return;
+        }
+
+        // Replay the whole recording as fast as possible once per iteration. Close requests are
+        // skipped so that the windows stay open and every iteration routes the same events. The
+        // fewest and most events routed by an iteration are tracked so that a shrinking workload
+        // shows up next to the timing.
+        replayer->set_skips_close_requests(true);
+
+        size_t min_routed = SIZE_MAX;
+        size_t max_routed = 0;
+
+        suite.run(name, [&replayer, &min_routed, &max_routed](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                replayer->rewind()->replay(sdl_replay_speed::max);
+                min_routed = min(min_routed, replayer->routed_count());
+                max_routed = max(max_routed, replayer->routed_count());
+            }
+        });
+
+        // The replayed events changed the state the windows report but not the native windows, so
+        // read their state again.
+        for (const unique_ptr<sdl_window> &window : windows)
+        {
+            window->refresh();
+        }
+
+        // Report the size of the workload next to the timing.
+        suite.add_counter("events", (double)replayer->event_count());
+        suite.add_counter("cycles", (double)replayer->cycle_count());
+        suite.add_counter("routed_events_min", (double)min_routed);
+        suite.add_counter("routed_events_max", (double)max_routed);
+    }
+
+    void run_event_benchmarks(benchmark_suite &suite)
+    {
+        // Run each group of event benchmarks.
+        run_headless_routing_benchmarks(suite);
+        run_sdl_routing_benchmarks(suite);
+        run_fan_out_benchmarks(suite);
+    }
+}
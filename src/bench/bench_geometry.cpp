@@ -0,0 +1,170 @@
+///
+/// @file       bench_geometry.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Benchmarks for formatting geometry types as display strings and for batches of
+///             rectangle operations and regions.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <sstream>
+#include <vector>
+#include "../graphics/graphics_types.hpp"
+#include "../graphics/rect_ops.hpp"
+#include "../graphics/region.hpp"
+#include "../utils/display.hpp"
+#include "bench_cases.hpp"
+
+using namespace std;
+
+///
+/// @brief  The number of rectangles each batch operation is run over.
+///
+#define LEAF_BENCH_RECT_BATCH_SIZE 1024
+
+namespace leaf
+{
+    void run_geometry_benchmarks(benchmark_suite &suite)
+    {
+        bounds2_t bounds(1920, 1080);
+        pos2_t pos(-320, 240);
+        border_t border(1, 28, 1, 1);
+
+        // Convert each type to a display string.
+        suite.run("geometry/to_string/bounds2", [&bounds](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                do_not_optimize(to_string(bounds));
+            }
+        });
+
+        suite.run("geometry/to_string/pos2", [&pos](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                do_not_optimize(to_string(pos));
+            }
+        });
+
+        suite.run("geometry/to_string/border", [&border](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                do_not_optimize(to_string(border));
+            }
+        });
+
+        // Format a type into a buffer on the stack, which never allocates.
+        suite.run("geometry/format/bounds2", [&bounds](uint64_t iterations)
+        {
+            char buffer[LEAF_UTIL_DISPLAY_BUFFER_SIZE];
+
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                do_not_optimize(format(buffer, buffer + sizeof(buffer), bounds));
+                do_not_optimize(buffer);
+            }
+        });
+
+        // Insert a type into a stream that is reused, as logging does.
+        suite.run("geometry/ostream/bounds2", [&bounds](uint64_t iterations)
+        {
+            ostringstream stream;
+
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                stream.seekp(0);
+                stream << bounds;
+            }
+
+            do_not_optimize(stream);
+        });
+
+        // Lay out a grid of overlapping rectangles like the widgets of a window, and a clip
+        // rectangle that cuts through it.
+        vector<rect2_t> rects(LEAF_BENCH_RECT_BATCH_SIZE);
+        vector<rect2_t> out(LEAF_BENCH_RECT_BATCH_SIZE);
+        vector<uint8_t> hits(LEAF_BENCH_RECT_BATCH_SIZE);
+        rect2_t clip(100, 100, 640, 480);
+
+        for (size_t i = 0; i < rects.size(); i++)
+        {
+            rects[i] = rect2_t((px_t)(i % 32 * 30), (px_t)(i / 32 * 30), 40, 40);
+        }
+
+        suite.run("geometry/rect/clip/1024", [&](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                clip_rects(rects.data(), clip, out.data(), rects.size());
+                do_not_optimize(out.data());
+            }
+        });
+
+        suite.run("geometry/rect/unite/1024", [&](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                unite_rects(rects.data(), out.data(), out.data(), rects.size());
+                do_not_optimize(out.data());
+            }
+        });
+
+        suite.run("geometry/rect/bounding/1024", [&](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                do_not_optimize(bounding_rect(rects.data(), rects.size()));
+            }
+        });
+
+        suite.run("geometry/rect/translate/1024", [&](uint64_t iterations)
+        {
+            // Move back and forth so the rectangles stay in range.
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                translate_rects(rects.data(), rects.size(), pos2_t(i & 1 ? -1 : 1, 0));
+                do_not_optimize(rects.data());
+            }
+        });
+
+        suite.run("geometry/rect/contains/1024", [&](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                do_not_optimize(contains_point(rects.data(), rects.size(), pos2_t(475, 475),
+                    hits.data()));
+            }
+        });
+
+        suite.run("geometry/rect/hit_test/1024", [&](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                do_not_optimize(hit_test(rects.data(), rects.size(), pos2_t(5, 5)));
+            }
+        });
+
+        // Accumulate the damage of the first 64 overlapping rectangles, as a frame with many
+        // invalidated widgets does. The region reuses its memory after it is cleared.
+        region damage;
+
+        suite.run("geometry/region/unite/64", [&](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                damage.clear();
+
+                for (size_t j = 0; j < 64; j++)
+                {
+                    damage.unite(rects[j]);
+                }
+
+                do_not_optimize(damage.area());
+            }
+        });
+    }
+}
@@ -0,0 +1,170 @@
+///
+/// @file       bench_layout.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Benchmarks for laying out a large widget tree again after its window was resized,
+///             comparing an incremental layout with a layout of the whole tree from scratch.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <memory>
+#include <string>
+#include "../widget/flex_box.hpp"
+#include "../widget/widget_tree.hpp"
+#include "../window/managed/headless/headless.hpp"
+#include "bench_cases.hpp"
+
+using namespace std;
+
+///
+/// @brief  The number of rows in the benchmarked tree.
+///
+#define LEAF_BENCH_LAYOUT_ROW_COUNT 100
+
+///
+/// @brief  The number of labels in each row of the benchmarked tree. With the root, the rows and
+///         a spacer in each row, the tree has 10,001 widgets.
+///
+#define LEAF_BENCH_LAYOUT_LABEL_COUNT 98
+
+namespace leaf
+{
+    ///
+    /// @brief  The number of times a label measured its text.
+    ///
+    static uint64_t f_text_measure_count = 0;
+
+    ///
+    /// @brief  A widget that measures a short text by adding up the advances of its characters,
+    ///         standing in for a label until text can be rendered.
+    ///
+    class bench_label : public widget
+    {
+        private:
+            ///
+            /// @brief  The text of the label.
+            ///
+            string m_text;
+
+        protected:
+            ///
+            /// @brief  Measures the text as a single line.
+            ///
+            /// @param  constraints the range of sizes allowed
+            ///
+            /// @return the size of the text
+            ///
+            virtual bounds2_t measure(const size_constraints_t &constraints) noexcept override
+            {
+                f_text_measure_count++;
+
+                // Look up an advance for each character as a font would.
+                int32_t width = 0;
+
+                for (char c : m_text)
+                {
+                    width += 5 + (c & 3);
+                }
+
+                return bounds2_t((px_t)width, 16);
+            }
+
+        public:
+            ///
+            /// @brief  Constructs a label.
+            ///
+            /// @param  text    the text of the label
+            ///
+            bench_label(const string &text) : m_text(text) {}
+    };
+
+    ///
+    /// @brief  Builds a column of rows of labels, each row ending with a spacer that takes the
+    ///         width left over. Resizing the window horizontally changes the constraints of the
+    ///         rows, but not those of the labels.
+    ///
+    /// @param  tree    the tree to build in
+    ///
+    static void build_layout_tree(widget_tree &tree)
+    {
+        flex_box *column = (flex_box *)tree.set_root(
+            unique_ptr<widget>(new flex_box(flex_direction::column)));
+
+        for (int row_index = 0; row_index < LEAF_BENCH_LAYOUT_ROW_COUNT; row_index++)
+        {
+            flex_box *row = column->emplace_child<flex_box>(flex_direction::row);
+            row->set_align(flex_align::start)->set_gap(4)->set_padding(border_t(2, 2, 2, 2));
+
+            for (int label_index = 0; label_index < LEAF_BENCH_LAYOUT_LABEL_COUNT; label_index++)
+            {
+                row->emplace_child<bench_label>(std::to_string(row_index * label_index));
+            }
+
+            row->emplace_child<widget>()->set_grow(1);
+        }
+    }
+
+    void run_layout_benchmarks(benchmark_suite &suite)
+    {
+        if (!suite.selected("layout/resize/incremental/10k")
+            && !suite.selected("layout/resize/full/10k"))
+        {
+            return;
+        }
+
+        // Wide enough at both widths the window alternates between that the labels never have to
+        // shrink. The widest row needs 2804 pixels.
+        headless_window window("bench", 3000, 2000);
+        widget_tree tree(&window);
+        build_layout_tree(tree);
+        tree.update();
+
+        // Resize the window back and forth. Only the rows and spacers are arranged again, and
+        // the labels keep their measurements.
+        uint64_t resize_count = 0;
+        f_text_measure_count = 0;
+
+        bool is_run = suite.run("layout/resize/incremental/10k", [&](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                window.inject_resize(i & 1 ? 3000 : 2900, 2000);
+                headless::instance.poll_events();
+                tree.update();
+            }
+
+            resize_count += iterations;
+        });
+
+        if (is_run)
+        {
+            suite.add_counter("text_measures_per_resize",
+                (double)f_text_measure_count / resize_count);
+        }
+
+        // Forget everything before each resize, as a layout without caching would.
+        resize_count = 0;
+        f_text_measure_count = 0;
+
+        is_run = suite.run("layout/resize/full/10k", [&](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                window.inject_resize(i & 1 ? 3000 : 2900, 2000);
+                headless::instance.poll_events();
+                tree.invalidate_all();
+                tree.update();
+            }
+
+            resize_count += iterations;
+        });
+
+        if (is_run)
+        {
+            suite.add_counter("text_measures_per_resize",
+                (double)f_text_measure_count / resize_count);
+        }
+    }
+}
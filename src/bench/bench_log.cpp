@@ -0,0 +1,90 @@
+///
+/// @file       bench_log.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Benchmarks for the cost of logging a message on the logging thread.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <iostream>
+#include <streambuf>
+#include "../utils/logger.hpp"
+#include "bench_cases.hpp"
+
+using namespace std;
+using namespace utl;
+
+namespace leaf
+{
+    ///
+    /// @brief  A stream buffer that discards everything written to it, so that writing the logged
+    ///         messages costs as little as possible.
+    ///
+    class null_streambuf : public streambuf
+    {
+        protected:
+            ///
+            /// @brief  Discards a character.
+            ///
+            /// @param  c   the character
+            ///
+            /// @return the character, to report success
+            ///
+            int overflow(int c) override
+            {
+                // Report success without storing anything.
+                return c;
+            }
+    };
+
+    void run_log_benchmarks(benchmark_suite &suite)
+    {
+        // Send the messages nowhere and restore standard output afterwards.
+        null_streambuf discard_buffer;
+        ostream discard(&discard_buffer);
+        logger::set_output(discard);
+
+        log_severity min_severity = logger::min_severity();
+        logger::set_min_severity(log_severity::info);
+
+        // Log a message whose severity is filtered out.
+        suite.run("log/filtered", [](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                logger::log(log_severity::debug, i);
+            }
+        });
+
+        // Log a number, which is copied and formatted later.
+        suite.run("log/deferred/uint64", [](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                logger::log(log_severity::info, i);
+            }
+        });
+
+        // Log text, which is copied into the record.
+        suite.run("log/text", [](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                logger::log(log_severity::info, "The window was resized.");
+            }
+        });
+
+        // Report how many messages the background thread could not keep up with.
+        logger::flush();
+
+        if (suite.selected("log/text"))
+        {
+            suite.add_counter("dropped", (double)logger::dropped_count());
+        }
+
+        logger::set_min_severity(min_severity);
+        logger::set_output(cout);
+    }
+}
@@ -0,0 +1,296 @@
+///
+/// @file       bench_text.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Benchmarks for laying out the text of a screen of labels, comparing a text layout
+///             cache with laying out every label again, and for rasterizing glyphs at many sizes,
+///             comparing bitmaps with distance fields. They are skipped when no font is given.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../graphics/text/font.hpp"
+#include "../graphics/text/glyph_atlas.hpp"
+#include "../graphics/text/text_layout_cache.hpp"
+#include "bench_cases.hpp"
+
+using namespace std;
+
+///
+/// @brief  The number of labels on the benchmarked screen.
+///
+#define LEAF_BENCH_TEXT_LABEL_COUNT 1000
+
+///
+/// @brief  The height of a line of the benchmarked text in pixels.
+///
+#define LEAF_BENCH_TEXT_SIZE 16
+
+///
+/// @brief  The width the benchmarked text is wrapped to in pixels.
+///
+#define LEAF_BENCH_TEXT_WIDTH 240
+
+///
+/// @brief  The characters whose glyphs are rasterized.
+///
+#define LEAF_BENCH_TEXT_CHARACTERS \
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789.,:;!?()"
+
+namespace leaf
+{
+    ///
+    /// @brief  The sizes glyphs are drawn at, as on monitors of different scales and when zooming.
+    ///
+    static const px_t f_glyph_sizes[] = {12, 16, 24, 32, 48, 96};
+
+    ///
+    /// @brief  Samples a distance field between its pixels. The field is taken to be far outside
+    ///         the glyph beyond its box.
+    ///
+    /// @param  field   the distance field
+    /// @param  box     the box of the field
+    /// @param  x       the horizontal position in pixels of the field, 0 at the center of the first
+    /// @param  y       the vertical position in pixels of the field, 0 at the center of the first
+    ///
+    /// @return the value of the field between 0 and 255
+    ///
+    static float sample_field(const vector<uint8_t> &field, const glyph_box_t &box, float x,
+        float y) noexcept
+    {
+        int left = (int)floor(x);
+        int top = (int)floor(y);
+        float right_weight = x - left;
+        float bottom_weight = y - top;
+
+        auto at = [&](int column, int row) -> float
+        {
+            if (column < 0 || row < 0 || column >= box.width || row >= box.height)
+            {
+                return 0;
+            }
+
+            return field[(size_t)row * box.width + column];
+        };
+
+        // Blend the four nearest pixels as a linear texture filter would.
+        float upper = at(left, top) + (at(left + 1, top) - at(left, top)) * right_weight;
+        float lower = at(left, top + 1)
+            + (at(left + 1, top + 1) - at(left, top + 1)) * right_weight;
+
+        return upper + (lower - upper) * bottom_weight;
+    }
+
+    ///
+    /// @brief  Measures how far text drawn from distance fields is from text drawn from bitmaps.
+    ///         Each glyph is reconstructed from its field at every size as the quad shader does,
+    ///         and compared with its bitmap at that size.
+    ///
+    /// @param  face    the font of the glyphs
+    /// @param  glyphs  the indices of the glyphs
+    ///
+    /// @return the mean difference in coverage between 0 and 1 over the pixels of the bitmaps
+    ///
+    static double field_coverage_error(const font &face, const vector<uint32_t> &glyphs)
+    {
+        vector<uint8_t> field;
+        vector<uint8_t> bitmap;
+        double error = 0;
+        uint64_t pixel_count = 0;
+
+        for (uint32_t glyph : glyphs)
+        {
+            glyph_box_t field_box;
+
+            if (!face.rasterize_sdf(glyph, LEAF_GLYPH_ATLAS_SDF_SIZE, LEAF_GLYPH_ATLAS_SDF_SPREAD,
+                field, field_box) || field_box.width == 0)
+            {
+                continue;
+            }
+
+            for (px_t size : f_glyph_sizes)
+            {
+                glyph_box_t box = face.box(glyph, size);
+                bitmap.assign((size_t)box.width * box.height, 0);
+                face.rasterize(glyph, size, bitmap.data(), box.width);
+
+                // Map the pixels on the screen to the pixels of the field.
+                float scale = (float)LEAF_GLYPH_ATLAS_SDF_SIZE / size;
+
+                for (uint16_t y = 0; y < box.height; y++)
+                {
+                    for (uint16_t x = 0; x < box.width; x++)
+                    {
+                        float value = sample_field(field, field_box,
+                            (box.x + x + 0.5f) * scale - field_box.x - 0.5f,
+                            (box.y + y + 0.5f) * scale - field_box.y - 0.5f);
+
+                        // Cover the pixel by its distance inside the edge in screen pixels.
+                        float distance = (value - 128) * LEAF_GLYPH_ATLAS_SDF_SPREAD / 128 / scale;
+                        float coverage = min(max(distance + 0.5f, 0.0f), 1.0f);
+
+                        error += fabs(coverage - bitmap[(size_t)y * box.width + x] / 255.0);
+                        pixel_count++;
+                    }
+                }
+            }
+        }
+
+        return pixel_count ? error / pixel_count : 0;
+    }
+
+    void run_text_benchmarks(benchmark_suite &suite, const string &font_path)
+    {
+        const char *names[] = {"text/layout/cached/1k", "text/layout/uncached/1k",
+            "text/glyphs/bitmap/6-sizes", "text/glyphs/distance-field/6-sizes"};
+
+        bool is_selected = false;
+
+        for (const char *name : names)
+        {
+            is_selected = is_selected || suite.selected(name);
+        }
+
+        if (!is_selected)
+        {
+            return;
+        }
+
+        if (font_path.empty())
+        {
+            for (const char *name : names)
+            {
+                suite.skip(name, "No font was given with --font.");
+            }
+
+            return;
+        }
+
+        // Load the font, skipping the benchmarks if it cannot be read.
+        shared_ptr<const font> face;
+
+        try
+        {
+            face.reset(new font(font_path));
+        }
+        catch (const runtime_error &exc)
+        {
+            for (const char *name : names)
+            {
+                suite.skip(name, exc.what());
+            }
+
+            return;
+        }
+
+        // Give each label a different text of a few words, some long enough to wrap.
+        vector<string> texts;
+
+        for (int i = 0; i < LEAF_BENCH_TEXT_LABEL_COUNT; i++)
+        {
+            texts.push_back("Item " + std::to_string(i) + (i % 4 ? "" : " with a longer "
+                "description that does not fit on a single line"));
+        }
+
+        // Lay out every label each frame through a cache that holds the whole screen. Only the
+        // first frame lays out any text.
+        text_layout_cache cache;
+
+        bool is_run = suite.run(names[0], [&](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                for (const string &text : texts)
+                {
+                    cache.layout(text, face, LEAF_BENCH_TEXT_SIZE, LEAF_BENCH_TEXT_WIDTH);
+                }
+            }
+        });
+
+        if (is_run)
+        {
+            suite.add_counter("hit_rate", cache.hit_rate());
+        }
+
+        // Lay out every label again each frame, as drawing without a cache would.
+        suite.run(names[1], [&](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                for (const string &text : texts)
+                {
+                    text_layout_cache::shape(text, face, LEAF_BENCH_TEXT_SIZE,
+                        LEAF_BENCH_TEXT_WIDTH);
+                }
+            }
+        });
+
+        // Find the glyphs of the characters.
+        vector<uint32_t> glyphs;
+
+        for (char character : string(LEAF_BENCH_TEXT_CHARACTERS))
+        {
+            glyphs.push_back(face->glyph_index((uint32_t)character));
+        }
+
+        // Rasterize every glyph at every size, as a bitmap atlas must when text is drawn at each
+        // of them.
+        vector<uint8_t> pixels;
+        size_t atlas_bytes = 0;
+
+        is_run = suite.run(names[2], [&](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                atlas_bytes = 0;
+
+                for (px_t size : f_glyph_sizes)
+                {
+                    for (uint32_t glyph : glyphs)
+                    {
+                        glyph_box_t box = face->box(glyph, size);
+                        pixels.resize((size_t)box.width * box.height);
+                        face->rasterize(glyph, size, pixels.data(), box.width);
+                        atlas_bytes += pixels.size();
+                    }
+                }
+            }
+        });
+
+        if (is_run)
+        {
+            suite.add_counter("atlas_bytes", (double)atlas_bytes);
+        }
+
+        // Rasterize every glyph once as a distance field, which a distance field atlas draws at
+        // every size.
+        is_run = suite.run(names[3], [&](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                atlas_bytes = 0;
+
+                for (uint32_t glyph : glyphs)
+                {
+                    glyph_box_t box;
+                    face->rasterize_sdf(glyph, LEAF_GLYPH_ATLAS_SDF_SIZE,
+                        LEAF_GLYPH_ATLAS_SDF_SPREAD, pixels, box);
+                    atlas_bytes += pixels.size();
+                }
+            }
+        });
+
+        if (is_run)
+        {
+            suite.add_counter("atlas_bytes", (double)atlas_bytes);
+            suite.add_counter("mean_coverage_error", field_coverage_error(*face, glyphs));
+        }
+    }
+}
@@ -0,0 +1,192 @@
+///
+/// @file       bench_window.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Benchmarks for creating and destroying windows and for reading and writing their
+///             properties. SDL benchmarks are skipped when no video display is available.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <memory>
+#include <stdexcept>
+#include <SDL3/SDL.h>
+#include "../window/managed/headless/headless.hpp"
+#include "../window/managed/sdl/sdl.hpp"
+#include "bench_cases.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    ///
+    /// @brief  The number of SDL property writes between polls, which keeps the SDL event queue
+    ///         from filling up with the events the writes produce.
+    ///
+    static const uint64_t f_writes_per_poll = 64;
+
+    ///
+    /// @brief  Tries to create a hidden SDL window for benchmarking.
+    ///
+    /// @param  reason  set to the reason if the window could not be created
+    ///
+    /// @return the window or null if no video display is available
+    ///
+    static unique_ptr<sdl_window> try_create_sdl_window(string &reason)
+    {
+        try
+        {
+            return unique_ptr<sdl_window>(new sdl_window("bench", 0, 0, 200, 200));
+        }
+        catch (const runtime_error &exc)
+        {
+            reason = exc.what();
+            return NULL;
+        }
+    }
+
+    void run_window_lifecycle_benchmarks(benchmark_suite &suite)
+    {
+        // Create and destroy a headless window. This is the cost of the managed window bookkeeping
+        // alone.
+        suite.run("window/create_destroy/headless", [](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                headless_window window;
+                do_not_optimize(window.handle());
+            }
+        });
+
+        // Create and destroy an SDL window if a display is available.
+        string reason;
+
+        if (!try_create_sdl_window(reason))
+        {
+            suite.skip("window/create_destroy/sdl", reason);
+            return;
+        }
+
+        suite.run("window/create_destroy/sdl", [](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                sdl_window window("bench", 0, 0, 200, 200);
+                do_not_optimize(window.id());
+            }
+
+            sdl::instance.poll_events();
+        });
+    }
+
+    void run_window_property_benchmarks(benchmark_suite &suite)
+    {
+        // Read the bounds of a headless window.
+        {
+            headless_window window;
+
+            suite.run("window/get_bounds/headless", [&window](uint64_t iterations)
+            {
+                for (uint64_t i = 0; i < iterations; i++)
+                {
+                    do_not_optimize(window.bounds());
+                }
+            });
+        }
+
+        headless::instance.poll_events();
+
+        // The remaining benchmarks need an SDL window.
+        string reason;
+        unique_ptr<sdl_window> window = try_create_sdl_window(reason);
+
+        if (!window)
+        {
+            suite.skip("window/get_bounds/sdl/cached", reason);
+            suite.skip("window/get_bounds/sdl/uncached", reason);
+            suite.skip("window/refresh/sdl", reason);
+            suite.skip("window/set_geometry/sdl/individual", reason);
+            suite.skip("window/set_geometry/sdl/batched", reason);
+            return;
+        }
+
+        // Read the bounds, position, and focus from the cached state.
+        suite.run("window/get_bounds/sdl/cached", [&window](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                do_not_optimize(window->bounds());
+                do_not_optimize(window->pos());
+                do_not_optimize(window->has_focus());
+            }
+        });
+
+        // Read the same values from SDL directly. This is what the getters cost before the state
+        // was cached.
+        SDL_Window *internal_window = SDL_GetWindowFromID(window->id());
+
+        suite.run("window/get_bounds/sdl/uncached", [internal_window](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                int width, height, x, y;
+                SDL_GetWindowSizeInPixels(internal_window, &width, &height);
+                SDL_GetWindowPosition(internal_window, &x, &y);
+                do_not_optimize(width);
+                do_not_optimize(height);
+                do_not_optimize(x);
+                do_not_optimize(y);
+                do_not_optimize(SDL_GetWindowFlags(internal_window) & SDL_WINDOW_INPUT_FOCUS);
+            }
+        });
+
+        // Read the full state from SDL, including the size of the frame border, which is what
+        // resynchronizing the cached state costs.
+        suite.run("window/refresh/sdl", [&window](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                window->refresh();
+            }
+        });
+
+        // Write the position and size with one setter call each.
+        suite.run("window/set_geometry/sdl/individual", [&window](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                px_t offset = (px_t)(i & 1);
+                window->set_x(offset)->set_y(offset)->set_width(200 + offset)
+                    ->set_height(200 + offset);
+
+                if (i % f_writes_per_poll == 0)
+                {
+                    sdl::instance.poll_events();
+                }
+            }
+
+            sdl::instance.poll_events();
+        });
+
+        // Write the same properties in a batched update.
+        suite.run("window/set_geometry/sdl/batched", [&window](uint64_t iterations)
+        {
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                px_t offset = (px_t)(i & 1);
+                window->begin_update();
+                window->set_x(offset)->set_y(offset)->set_width(200 + offset)
+                    ->set_height(200 + offset);
+                window->commit_update();
+
+                if (i % f_writes_per_poll == 0)
+                {
+                    sdl::instance.poll_events();
+                }
+            }
+
+            sdl::instance.poll_events();
+        });
+    }
+}
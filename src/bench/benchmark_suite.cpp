@@ -0,0 +1,141 @@
+///
+/// @file       benchmark_suite.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a class that runs microbenchmarks and reports their timings as
+///             JSON so that results can be compared release over release.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <algorithm>
+#include "benchmark_suite.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    ///
+    /// @brief  Writes a string as a quoted JSON string, escaping the characters JSON requires.
+    ///
+    /// @param  stream  the stream to write to
+    /// @param  str     the string to write
+    ///
+    static void write_json_string(ostream &stream, const string &str)
+    {
+        stream << '"';
+
+        for (char c : str)
+        {
+            if (c == '"' || c == '\\')
+            {
+                stream << '\\' << c;
+            }
+            else if ((unsigned char)c < 0x20)
+            {
+                stream << ' ';
+            }
+            else
+            {
+                stream << c;
+            }
+        }
+
+        stream << '"';
+    }
+
+    // Store the filter.
+    benchmark_suite::benchmark_suite(const string &filter) : m_filter(filter) {}
+
+    bool benchmark_suite::selected(const string &name) const noexcept
+    {
+        // An empty filter is contained in every name.
+        return name.find(m_filter) != string::npos;
+    }
+
+    void benchmark_suite::skip(const string &name, const string &reason)
+    {
+        // Only record skipped benchmarks that would have been run.
+        if (selected(name))
+        {
+            m_results.push_back({name, true, reason, 0, {}, {}});
+        }
+    }
+
+    void benchmark_suite::add_counter(const string &name, double value)
+    {
+        // Attach the counter to the most recent result if there is one.
+        if (!m_results.empty())
+        {
+            m_results.back().counters.push_back({name, value});
+        }
+    }
+
+    const vector<benchmark_result_t> &benchmark_suite::results(void) const noexcept
+    {
+        // Return the results.
+        return m_results;
+    }
+
+    void benchmark_suite::write_json(ostream &stream) const
+    {
+        stream << "{\n  \"version\": " << LEAF_BENCH_REPORT_VERSION << ",\n  \"benchmarks\": [";
+
+        for (size_t i = 0; i < m_results.size(); i++)
+        {
+            const benchmark_result_t &result = m_results[i];
+
+            stream << (i ? ",\n" : "\n") << "    {\"name\": ";
+            write_json_string(stream, result.name);
+
+            // Skipped benchmarks only report why they were skipped.
+            if (result.skipped)
+            {
+                stream << ", \"skipped\": true, \"reason\": ";
+                write_json_string(stream, result.skip_reason);
+                stream << '}';
+                continue;
+            }
+
+            // Summarize the samples.
+            vector<double> samples = result.samples;
+            sort(samples.begin(), samples.end());
+
+            double mean = 0;
+
+            for (double sample : samples)
+            {
+                mean += sample;
+            }
+
+            mean /= samples.size();
+
+            stream << ", \"iterations\": " << result.iterations
+                << ", \"samples\": " << samples.size()
+                << ", \"ns_per_op\": {\"min\": " << samples.front()
+                << ", \"median\": " << samples[samples.size() / 2]
+                << ", \"mean\": " << mean
+                << ", \"max\": " << samples.back() << '}';
+
+            // Report the counters if there are any.
+            if (!result.counters.empty())
+            {
+                stream << ", \"counters\": {";
+
+                for (size_t j = 0; j < result.counters.size(); j++)
+                {
+                    stream << (j ? ", " : "");
+                    write_json_string(stream, result.counters[j].first);
+                    stream << ": " << result.counters[j].second;
+                }
+
+                stream << '}';
+            }
+
+            stream << '}';
+        }
+
+        stream << "\n  ]\n}\n";
+    }
+}
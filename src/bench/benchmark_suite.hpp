@@ -0,0 +1,224 @@
+///
+/// @file       benchmark_suite.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a class that runs microbenchmarks and reports their timings as JSON so
+///             that results can be compared release over release.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_BENCHMARK_SUITE_HEADER_GUARD
+#define LEAF_SRC_BENCHMARK_SUITE_HEADER_GUARD
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../utils/unique.hpp"
+
+///
+/// @brief  The minimum duration of a single timed sample in nanoseconds. The number of iterations
+///         per sample is doubled until a sample takes at least this long.
+///
+#define LEAF_BENCH_MIN_SAMPLE_NS (uint64_t)5000000
+
+///
+/// @brief  The number of timed samples taken per benchmark.
+///
+#define LEAF_BENCH_SAMPLE_COUNT 10
+
+///
+/// @brief  The version of the JSON report format. It is incremented whenever a field is renamed or
+///         removed so that tracking tools can tell reports apart.
+///
+#define LEAF_BENCH_REPORT_VERSION 1
+
+namespace leaf
+{
+    ///
+    /// @brief  Prevents the compiler from optimizing away the computation of a value.
+    ///
+    /// @tparam T       the type of the value
+    /// @param  value   the value that must be computed
+    ///
+    template<typename T> inline void do_not_optimize(const T &value) noexcept
+    {
+        // An empty assembly statement that claims to read the value and clobber memory.
+        asm volatile("" : : "g"(&value) : "memory");
+    }
+
+    ///
+    /// @brief  Represents the outcome of a single benchmark.
+    ///
+    typedef struct benchmark_result
+    {
+        ///
+        /// @brief  The name of the benchmark, with parameters separated by slashes.
+        ///
+        std::string name;
+
+        ///
+        /// @brief  Denotes whether the benchmark could not run in this environment.
+        ///
+        bool skipped;
+
+        ///
+        /// @brief  The reason the benchmark was skipped or an empty string.
+        ///
+        std::string skip_reason;
+
+        ///
+        /// @brief  The number of operations timed per sample.
+        ///
+        uint64_t iterations;
+
+        ///
+        /// @brief  The time per operation of each sample in nanoseconds.
+        ///
+        std::vector<double> samples;
+
+        ///
+        /// @brief  Additional named measurements reported with the benchmark.
+        ///
+        std::vector<std::pair<std::string, double>> counters;
+
+    } benchmark_result_t;
+
+    ///
+    /// @brief  Runs microbenchmarks and reports their timings as JSON. Each benchmark body performs
+    ///         a given number of operations. The suite calibrates the number so that a sample takes
+    ///         long enough to time reliably, then takes a fixed number of samples.
+    ///
+    class benchmark_suite : public utl::unique
+    {
+        private:
+            ///
+            /// @brief  Only benchmarks whose name contains this string are run.
+            ///
+            std::string m_filter;
+
+            ///
+            /// @brief  The results of the benchmarks that were run or skipped, in order.
+            ///
+            std::vector<benchmark_result_t> m_results;
+
+            ///
+            /// @brief  Times a single sample of a benchmark body.
+            ///
+            /// @tparam F           the type of the benchmark body
+            /// @param  body        the benchmark body
+            /// @param  iterations  the number of operations to perform
+            ///
+            /// @return the elapsed time in nanoseconds
+            ///
+            template<typename F> static uint64_t time_sample(F &body, uint64_t iterations)
+            {
+                // Time the body with a monotonic clock.
+                auto start = std::chrono::steady_clock::now();
+                body(iterations);
+                auto end = std::chrono::steady_clock::now();
+
+                return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    end - start).count();
+            }
+
+        public:
+            ///
+            /// @brief  Creates a benchmark suite.
+            ///
+            /// @param  filter  only benchmarks whose name contains this string are run, an empty
+            ///                 string runs every benchmark
+            ///
+            benchmark_suite(const std::string &filter = "");
+
+            ///
+            /// @brief  Determines whether a benchmark with the given name passes the filter.
+            ///
+            /// @param  name    the name of the benchmark
+            ///
+            /// @return true if and only if the benchmark should run
+            ///
+            bool selected(const std::string &name) const noexcept;
+
+            ///
+            /// @brief  Runs a benchmark if it passes the filter. The body is called with the number
+            ///         of operations to perform and must perform exactly that many.
+            ///
+            /// @tparam F       the type of the benchmark body
+            /// @param  name    the name of the benchmark
+            /// @param  body    the benchmark body
+            ///
+            /// @return true if and only if the benchmark was run
+            ///
+            template<typename F> bool run(const std::string &name, F body)
+            {
+                // Skip benchmarks that do not pass the filter.
+                if (!selected(name))
+                {
+                    return false;
+                }
+
+                // Warm up, then double the number of iterations until a sample is long enough to
+                // time reliably.
+                uint64_t iterations = 1;
+                time_sample(body, iterations);
+
+                while (time_sample(body, iterations) < LEAF_BENCH_MIN_SAMPLE_NS)
+                {
+                    iterations *= 2;
+                }
+
+                // Take the samples.
+                benchmark_result_t result = {name, false, "", iterations, {}, {}};
+
+                for (int i = 0; i < LEAF_BENCH_SAMPLE_COUNT; i++)
+                {
+                    result.samples.push_back((double)time_sample(body, iterations) / iterations);
+                }
+
+                m_results.push_back(result);
+
+                // Return true indicating that the benchmark was run.
+                return true;
+            }
+
+            ///
+            /// @brief  Records that a benchmark could not run in this environment. It is only
+            ///         recorded if it passes the filter.
+            ///
+            /// @param  name    the name of the benchmark
+            /// @param  reason  the reason the benchmark was skipped
+            ///
+            void skip(const std::string &name, const std::string &reason);
+
+            ///
+            /// @brief  Adds a named measurement to the most recently run benchmark.
+            ///
+            /// @param  name    the name of the measurement
+            /// @param  value   the value of the measurement
+            ///
+            void add_counter(const std::string &name, double value);
+
+            ///
+            /// @brief  Returns the results of the benchmarks that were run or skipped.
+            ///
+            /// @return the results in order
+            ///
+            const std::vector<benchmark_result_t> &results(void) const noexcept;
+
+            ///
+            /// @brief  Writes every result as a JSON document. Each benchmark reports the minimum,
+            ///         median, mean, and maximum time per operation in nanoseconds over its
+            ///         samples.
+            ///
+            /// @param  stream  the stream to write to
+            ///
+            void write_json(std::ostream &stream) const;
+    };
+}
+
+#endif
@@ -0,0 +1,95 @@
+///
+/// @file       main.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Entry point of the benchmark executable. Runs every benchmark group and writes the
+///             results as JSON to standard output or to a file.
+///
+///             Usage:  bench [--filter <substring>] [--out <path>] [--replay <recording>]
+///                           [--font <path>]
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "../utils/console.hpp"
+#include "bench_cases.hpp"
+
+using namespace std;
+using namespace utl;
+using namespace leaf;
+
+int main(int argc, char **argv)
+{
+    // Parse the command line options.
+    string filter;
+    string out_path;
+    string replay_path;
+    string font_path;
+
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+
+        if (arg == "--filter" && i + 1 < argc)
+        {
+            filter = argv[++i];
+        }
+        else if (arg == "--out" && i + 1 < argc)
+        {
+            out_path = argv[++i];
+        }
+        else if (arg == "--replay" && i + 1 < argc)
+        {
+            replay_path = argv[++i];
+        }
+        else if (arg == "--font" && i + 1 < argc)
+        {
+            font_path = argv[++i];
+        }
+        else
+        {
+            console::err("Unknown argument '" + arg + "'. Usage: bench [--filter <substring>] "
+                "[--out <path>] [--replay <recording>] [--font <path>]");
+        }
+    }
+
+    benchmark_suite suite(filter);
+
+    try
+    {
+        // Run every benchmark group.
+        run_window_lifecycle_benchmarks(suite);
+        run_event_benchmarks(suite);
+        run_replay_benchmarks(suite, replay_path);
+        run_window_property_benchmarks(suite);
+        run_geometry_benchmarks(suite);
+        run_log_benchmarks(suite);
+        run_layout_benchmarks(suite);
+        run_text_benchmarks(suite, font_path);
+    }
+    catch (const exception &exc)
+    {
+        console::err(exc);
+    }
+
+    // Write the report to the requested file or to standard output.
+    if (out_path.empty())
+    {
+        suite.write_json(cout);
+    }
+    else
+    {
+        ofstream out(out_path);
+
+        if (!out)
+        {
+            console::err("Failed to open '" + out_path + "' for writing.");
+        }
+
+        suite.write_json(out);
+    }
+}
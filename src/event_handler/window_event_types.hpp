@@ -0,0 +1,67 @@
+///
+/// @file       window_event_types.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for defining types that identify the kinds of window events a window event
+///             handler can be notified of.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_WINDOW_EVENT_TYPES_HEADER_GUARD
+#define LEAF_SRC_WINDOW_EVENT_TYPES_HEADER_GUARD
+
+#include <cstdint>
+
+///
+/// @brief  A window event mask that selects every type of window event.
+///
+#define LEAF_WINDOW_EVENT_MASK_ALL (leaf::window_event_mask_t)0xFFFF
+
+namespace leaf
+{
+    ///
+    /// @brief  Identifies a kind of window event. Each type corresponds to one notification method
+    ///         of a window event handler.
+    ///
+    enum class window_event_type : uint8_t
+    {
+        closed,
+        user_requested_close,
+        resized,
+        moved,
+        hidden,
+        shown,
+        minimized,
+        maximized,
+        entered_fullscreen,
+        exited_fullscreen,
+
+        ///
+        /// @brief  The number of window event types. This is not a valid event type.
+        ///
+        count
+    };
+
+    ///
+    /// @brief  A bit mask of window event types. Bit n is set if the event type with the
+    ///         underlying value n is selected.
+    ///
+    typedef uint16_t window_event_mask_t;
+
+    ///
+    /// @brief  Creates a window event mask that selects a single window event type.
+    ///
+    /// @param  type    the window event type to select
+    ///
+    /// @return the window event mask
+    ///
+    constexpr window_event_mask_t window_event_mask(window_event_type type) noexcept
+    {
+        // Shift a single bit into the position of the event type.
+        return (window_event_mask_t)(1u << (uint8_t)type);
+    }
+}
+
+#endif
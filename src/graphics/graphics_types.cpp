@@ -8,10 +8,11 @@
 /// @copyright  Copyright (c) 2023
 /// 
 
-#include <sstream>
 #include "graphics_types.hpp"
+#include "../utils/display.hpp"
 
 using namespace std;
+using namespace utl;
 
 namespace leaf
 {
@@ -22,18 +23,6 @@ namespace leaf
         this->height = height;
     }
 
-    std::string bounds2::to_string(void) const noexcept
-    {
-        // Create a buffered string stream to create a display string.
-        stringstream stream;
-
-        // Create a display string of the width and height fields.
-        stream << '<' << width << ',' << height << '>';
-
-        // Return the buffer from the string stream.
-        return stream.str();
-    }
-
     pos2::pos2(px_t x, px_t y) noexcept
     {
         // Initialize both fields within the structure.
@@ -41,18 +30,6 @@ namespace leaf
         this->y = y;
     }
 
-    std::string pos2::to_string(void) const noexcept
-    {
-         // Create a buffered string stream to create a display string.
-        stringstream stream;
-
-        // Create a display string of the x-position and y-position fields.
-        stream << '<' << x << ',' << y << '>';
-
-        // Return the buffer from the string stream.
-        return stream.str();
-    }
-
     border::border(px_t left, px_t top, px_t right, px_t bottom) noexcept
     {
         // Initialize each field within the structure.
@@ -62,15 +39,138 @@ namespace leaf
         this->bottom = bottom;
     }
 
-    std::string border::to_string(void) const noexcept
+    char *format(char *first, char *last, const bounds2_t &bounds) noexcept
+    {
+        // Write the width and height fields.
+        first = format_char(first, last, '<');
+        first = format_int(first, last, bounds.width);
+        first = format_char(first, last, ',');
+        first = format_int(first, last, bounds.height);
+
+        return format_char(first, last, '>');
+    }
+
+    char *format(char *first, char *last, const pos2_t &pos) noexcept
     {
-        // Create a buffered string stream to create a display string.
-        stringstream stream;
+        // Write the x-position and y-position fields.
+        first = format_char(first, last, '<');
+        first = format_int(first, last, pos.x);
+        first = format_char(first, last, ',');
+        first = format_int(first, last, pos.y);
 
-        // Create a display string of the left, top, right and bottom fields.
-        stream << '<' << left << ',' << top << ',' << right << ',' << bottom << '>';
+        return format_char(first, last, '>');
+    }
+
+    char *format(char *first, char *last, const border_t &border) noexcept
+    {
+        // Write the left, top, right and bottom fields.
+        first = format_char(first, last, '<');
+        first = format_int(first, last, border.left);
+        first = format_char(first, last, ',');
+        first = format_int(first, last, border.top);
+        first = format_char(first, last, ',');
+        first = format_int(first, last, border.right);
+        first = format_char(first, last, ',');
+        first = format_int(first, last, border.bottom);
+
+        return format_char(first, last, '>');
+    }
+
+    char *format(char *first, char *last, const rect2_t &rect) noexcept
+    {
+        // Write the x-position, y-position, width and height fields.
+        first = format_char(first, last, '<');
+        first = format_int(first, last, rect.x);
+        first = format_char(first, last, ',');
+        first = format_int(first, last, rect.y);
+        first = format_char(first, last, ',');
+        first = format_int(first, last, rect.width);
+        first = format_char(first, last, ',');
+        first = format_int(first, last, rect.height);
+
+        return format_char(first, last, '>');
+    }
+
+    ///
+    /// @brief  Formats a geometry value into a buffer on the stack and copies it into a string.
+    ///         Every geometry display string is short enough that the string does not allocate.
+    ///
+    /// @tparam T       the type of the geometry value
+    /// @param  value   the value to display
+    ///
+    /// @return the display string
+    ///
+    template<typename T> static string format_to_string(const T &value) noexcept
+    {
+        char buffer[LEAF_UTIL_DISPLAY_BUFFER_SIZE];
+        char *end = format(buffer, buffer + sizeof(buffer), value);
+
+        return string(buffer, end);
+    }
 
-        // Return the buffer from the string stream.
-        return stream.str();
+    ///
+    /// @brief  Formats a geometry value into a buffer on the stack and writes it into a stream.
+    ///
+    /// @tparam T       the type of the geometry value
+    /// @param  stream  the output stream to write into
+    /// @param  value   the value to display
+    ///
+    /// @return a reference to the output stream for chaining
+    ///
+    template<typename T> static ostream &format_to_stream(ostream &stream, const T &value)
+        noexcept
+    {
+        char buffer[LEAF_UTIL_DISPLAY_BUFFER_SIZE];
+        char *end = format(buffer, buffer + sizeof(buffer), value);
+
+        return stream.write(buffer, end - buffer);
+    }
+
+    string to_string(const bounds2_t &bounds) noexcept
+    {
+        // Format into a buffer instead of a string stream.
+        return format_to_string(bounds);
+    }
+
+    string to_string(const pos2_t &pos) noexcept
+    {
+        // Format into a buffer instead of a string stream.
+        return format_to_string(pos);
+    }
+
+    string to_string(const border_t &border) noexcept
+    {
+        // Format into a buffer instead of a string stream.
+        return format_to_string(border);
+    }
+
+    string to_string(const rect2_t &rect) noexcept
+    {
+        // Format into a buffer instead of a string stream.
+        return format_to_string(rect);
+    }
+
+    ostream &operator<<(ostream &stream, const bounds2_t &bounds) noexcept
+    {
+        // Write the formatted characters directly. Return the stream for chaining.
+        return format_to_stream(stream, bounds);
+    }
+
+    ostream &operator<<(ostream &stream, const pos2_t &pos) noexcept
+    {
+        // Write the formatted characters directly. Return the stream for chaining.
+        return format_to_stream(stream, pos);
+    }
+
+    ostream &operator<<(ostream &stream, const border_t &border) noexcept
+    {
+        // Write the formatted characters directly. Return the stream for chaining.
+        return format_to_stream(stream, border);
+    }
+
+    ostream &operator<<(ostream &stream, const rect2_t &rect) noexcept
+    {
+        // Write the formatted characters directly. Return the stream for chaining.
+        return format_to_stream(stream, rect);
     }
 }
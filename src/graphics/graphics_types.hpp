@@ -3,7 +3,9 @@
 /// @author     Will Brandon (brandon.w@northeastern.edu)
 /// @date       May 2, 2023
 /// 
-/// @brief      Header for defining types associated computer graphics.
+/// @brief      Header for defining types associated computer graphics. The types are plain data
+///             without virtual functions, so arrays of them can be copied as bytes and processed
+///             in bulk.
 /// 
 /// @copyright  Copyright (c) 2023
 /// 
@@ -12,7 +14,10 @@
 #define LEAF_SRC_GRAPHICS_TYPES_HEADER_GUARD
 
 #include <cstdint>
-#include "../utils/display.hpp"
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include "../utils/log_deferred.hpp"
 
 namespace leaf
 {
@@ -24,7 +29,7 @@ namespace leaf
     ///
     /// @brief  Represents a 2-dimensional bounding rectangle in integer pixel measurements.
     ///
-    typedef struct bounds2 : public utl::displayable
+    typedef struct bounds2
     {
         /// 
         /// @brief  Defines the width of the bounding rectangle in pixels.
@@ -65,20 +70,12 @@ namespace leaf
             return (double)width / (double)height;
         }
 
-        /// 
-        /// @brief  Creates a display string for the bounding rectangle. The width and height are
-        ///         displayed in that order.
-        ///
-        /// @return the display string
-        /// 
-        virtual std::string to_string(void) const noexcept override;
-
     } bounds2_t;
 
     ///
     /// @brief  Represents a 2-dimensional position in integer pixel cartesian coordinates.
     ///
-    typedef struct pos2 : public utl::displayable
+    typedef struct pos2
     {
         /// 
         /// @brief  Defines the x-position in pixels.
@@ -106,20 +103,12 @@ namespace leaf
         /// 
         pos2(px_t x, px_t y) noexcept;
 
-        /// 
-        /// @brief  Creates a display string for the position. The x-position and y-position are
-        ///         displayed in that order.
-        ///
-        /// @return the display string
-        /// 
-        virtual std::string to_string(void) const noexcept override;
-
     } pos2_t;
 
     ///
     /// @brief  Represents the dimensions of a border in integer pixel measurements.
     ///
-    typedef struct border : public utl::displayable
+    typedef struct border
     {
         /// 
         /// @brief  Defines the left measure in pixels.
@@ -159,15 +148,231 @@ namespace leaf
         /// 
         border(px_t left, px_t top, px_t right, px_t bottom) noexcept;
 
-        /// 
-        /// @brief  Creates a display string for the border. The left, right, top, and bottom
-        ///         measures are displayed in that order.
-        ///
-        /// @return the display string
-        /// 
-        virtual std::string to_string(void) const noexcept override;
-    
     } border_t;
+
+    ///
+    /// @brief  Represents a 2-dimensional rectangle in integer pixel measurements, positioned by
+    ///         its top-left corner. A rectangle with a width or height of 0 or less is empty.
+    ///
+    typedef struct rect2
+    {
+        ///
+        /// @brief  Defines the x-position of the left edge in pixels.
+        ///
+        px_t x;
+
+        ///
+        /// @brief  Defines the y-position of the top edge in pixels.
+        ///
+        px_t y;
+
+        ///
+        /// @brief  Defines the width in pixels.
+        ///
+        px_t width;
+
+        ///
+        /// @brief  Defines the height in pixels.
+        ///
+        px_t height;
+
+        ///
+        /// @brief  Constructs a new 2-dimensional rectangle structure.
+        ///
+        /// @note   This implementation is set to default; it just allocates the space but does not
+        ///         update the memory content.
+        ///
+        rect2(void) noexcept = default;
+
+        ///
+        /// @brief  Constructs a new 2-dimensional rectangle structure.
+        ///
+        /// @param  x       the x-position of the left edge measured in pixels
+        /// @param  y       the y-position of the top edge measured in pixels
+        /// @param  width   the width measured in pixels
+        /// @param  height  the height measured in pixels
+        ///
+        rect2(px_t x, px_t y, px_t width, px_t height) noexcept
+            // Initialize each field within the structure.
+            : x(x), y(y), width(width), height(height) {}
+
+        ///
+        /// @brief  Constructs a new 2-dimensional rectangle structure from a position and bounds.
+        ///
+        /// @param  pos     the position of the top-left corner
+        /// @param  bounds  the width and height
+        ///
+        rect2(const pos2 &pos, const bounds2 &bounds) noexcept
+            // Initialize each field within the structure.
+            : x(pos.x), y(pos.y), width(bounds.width), height(bounds.height) {}
+
+        ///
+        /// @brief  Determines the position of the top-left corner.
+        ///
+        /// @return the position
+        ///
+        inline pos2 pos(void) const noexcept
+        {
+            // Return the corner as a position.
+            return pos2(x, y);
+        }
+
+        ///
+        /// @brief  Determines the width and height.
+        ///
+        /// @return the bounds
+        ///
+        inline bounds2 bounds(void) const noexcept
+        {
+            // Return the size as bounds.
+            return bounds2(width, height);
+        }
+
+    } rect2_t;
+
+    // The geometry types must stay plain data so that arrays of them can be copied as bytes and
+    // processed in bulk.
+    static_assert(std::is_trivially_copyable<bounds2_t>::value && sizeof(bounds2_t) == 4,
+        "bounds2_t must be 4 bytes of plain data.");
+    static_assert(std::is_trivially_copyable<pos2_t>::value && sizeof(pos2_t) == 4,
+        "pos2_t must be 4 bytes of plain data.");
+    static_assert(std::is_trivially_copyable<border_t>::value && sizeof(border_t) == 8,
+        "border_t must be 8 bytes of plain data.");
+    static_assert(std::is_trivially_copyable<rect2_t>::value && sizeof(rect2_t) == 8,
+        "rect2_t must be 8 bytes of plain data.");
+
+    ///
+    /// @brief  Writes the display string of bounds into a buffer without allocating.
+    ///
+    /// @param  first   the position in the buffer to write at or null
+    /// @param  last    the end of the buffer
+    /// @param  bounds  the bounds to display
+    ///
+    /// @return the position after the display string or null if it did not fit
+    ///
+    char *format(char *first, char *last, const bounds2_t &bounds) noexcept;
+
+    ///
+    /// @brief  Writes the display string of a position into a buffer without allocating.
+    ///
+    /// @param  first   the position in the buffer to write at or null
+    /// @param  last    the end of the buffer
+    /// @param  pos     the position to display
+    ///
+    /// @return the position after the display string or null if it did not fit
+    ///
+    char *format(char *first, char *last, const pos2_t &pos) noexcept;
+
+    ///
+    /// @brief  Writes the display string of a border into a buffer without allocating.
+    ///
+    /// @param  first   the position in the buffer to write at or null
+    /// @param  last    the end of the buffer
+    /// @param  border  the border to display
+    ///
+    /// @return the position after the display string or null if it did not fit
+    ///
+    char *format(char *first, char *last, const border_t &border) noexcept;
+
+    ///
+    /// @brief  Writes the display string of a rectangle into a buffer without allocating.
+    ///
+    /// @param  first   the position in the buffer to write at or null
+    /// @param  last    the end of the buffer
+    /// @param  rect    the rectangle to display
+    ///
+    /// @return the position after the display string or null if it did not fit
+    ///
+    char *format(char *first, char *last, const rect2_t &rect) noexcept;
+
+    ///
+    /// @brief  Creates a display string for bounds. The width and height are displayed in that
+    ///         order.
+    ///
+    /// @param  bounds  the bounds to display
+    ///
+    /// @return the display string
+    ///
+    std::string to_string(const bounds2_t &bounds) noexcept;
+
+    ///
+    /// @brief  Creates a display string for a position. The x-position and y-position are
+    ///         displayed in that order.
+    ///
+    /// @param  pos the position to display
+    ///
+    /// @return the display string
+    ///
+    std::string to_string(const pos2_t &pos) noexcept;
+
+    ///
+    /// @brief  Creates a display string for a border. The left, top, right, and bottom measures
+    ///         are displayed in that order.
+    ///
+    /// @param  border  the border to display
+    ///
+    /// @return the display string
+    ///
+    std::string to_string(const border_t &border) noexcept;
+
+    ///
+    /// @brief  Creates a display string for a rectangle. The x-position, y-position, width, and
+    ///         height are displayed in that order.
+    ///
+    /// @param  rect    the rectangle to display
+    ///
+    /// @return the display string
+    ///
+    std::string to_string(const rect2_t &rect) noexcept;
+
+    ///
+    /// @brief  Inserts the display string of bounds into an output stream.
+    ///
+    /// @param  stream  the output stream to insert the display string into
+    /// @param  bounds  the bounds to display
+    ///
+    /// @return a reference to the output stream for chaining
+    ///
+    std::ostream &operator<<(std::ostream &stream, const bounds2_t &bounds) noexcept;
+
+    ///
+    /// @brief  Inserts the display string of a position into an output stream.
+    ///
+    /// @param  stream  the output stream to insert the display string into
+    /// @param  pos     the position to display
+    ///
+    /// @return a reference to the output stream for chaining
+    ///
+    std::ostream &operator<<(std::ostream &stream, const pos2_t &pos) noexcept;
+
+    ///
+    /// @brief  Inserts the display string of a border into an output stream.
+    ///
+    /// @param  stream  the output stream to insert the display string into
+    /// @param  border  the border to display
+    ///
+    /// @return a reference to the output stream for chaining
+    ///
+    std::ostream &operator<<(std::ostream &stream, const border_t &border) noexcept;
+
+    ///
+    /// @brief  Inserts the display string of a rectangle into an output stream.
+    ///
+    /// @param  stream  the output stream to insert the display string into
+    /// @param  rect    the rectangle to display
+    ///
+    /// @return a reference to the output stream for chaining
+    ///
+    std::ostream &operator<<(std::ostream &stream, const rect2_t &rect) noexcept;
+}
+
+namespace utl
+{
+    // The geometry types own everything they print, so the logger may format them later.
+    template<> struct log_deferred<leaf::bounds2_t> : std::true_type {};
+    template<> struct log_deferred<leaf::pos2_t> : std::true_type {};
+    template<> struct log_deferred<leaf::border_t> : std::true_type {};
+    template<> struct log_deferred<leaf::rect2_t> : std::true_type {};
 }
 
 #endif
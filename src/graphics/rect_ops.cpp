@@ -0,0 +1,118 @@
+///
+/// @file       rect_ops.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for batches of operations over arrays of rectangles. Each loop body
+///             is branchless and works on contiguous plain data, so the compiler can vectorize it.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include "rect_ops.hpp"
+
+namespace leaf
+{
+    void intersect_rects(const rect2_t *a, const rect2_t *b, rect2_t *out, size_t count) noexcept
+    {
+        // Intersect each pair.
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = intersect(a[i], b[i]);
+        }
+    }
+
+    void clip_rects(const rect2_t *rects, const rect2_t &clip, rect2_t *out, size_t count) noexcept
+    {
+        // Copy the clip rectangle so the compiler knows the output cannot change it.
+        rect2_t clip_copy = clip;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = intersect(rects[i], clip_copy);
+        }
+    }
+
+    void unite_rects(const rect2_t *a, const rect2_t *b, rect2_t *out, size_t count) noexcept
+    {
+        // Unite each pair.
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = unite(a[i], b[i]);
+        }
+    }
+
+    rect2_t bounding_rect(const rect2_t *rects, size_t count) noexcept
+    {
+        // Accumulate the outer edges of the rectangles that are not empty, widening so that the
+        // far edges cannot overflow. The accumulators start inverted so the first rectangle
+        // replaces them.
+        int32_t left = INT32_MAX;
+        int32_t top = INT32_MAX;
+        int32_t right = INT32_MIN;
+        int32_t bottom = INT32_MIN;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            const rect2_t &rect = rects[i];
+            bool is_counted = !is_empty(rect);
+            int32_t rect_right = (int32_t)rect.x + rect.width;
+            int32_t rect_bottom = (int32_t)rect.y + rect.height;
+
+            left = is_counted && rect.x < left ? rect.x : left;
+            top = is_counted && rect.y < top ? rect.y : top;
+            right = is_counted && rect_right > right ? rect_right : right;
+            bottom = is_counted && rect_bottom > bottom ? rect_bottom : bottom;
+        }
+
+        // If no rectangle was counted, the accumulators are still inverted.
+        if (left > right)
+        {
+            return rect2_t(0, 0, 0, 0);
+        }
+
+        return rect2_t((px_t)left, (px_t)top, clamp_px(right - left), clamp_px(bottom - top));
+    }
+
+    void translate_rects(rect2_t *rects, size_t count, const pos2_t &offset) noexcept
+    {
+        // Copy the offset so the compiler knows the rectangles cannot change it.
+        pos2_t offset_copy = offset;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            rects[i] = translate(rects[i], offset_copy);
+        }
+    }
+
+    size_t contains_point(const rect2_t *rects, size_t count, const pos2_t &point, uint8_t *out)
+        noexcept
+    {
+        // Test every rectangle and count the hits without branching.
+        pos2_t point_copy = point;
+        size_t hit_count = 0;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            uint8_t hit = (uint8_t)contains(rects[i], point_copy);
+            out[i] = hit;
+            hit_count += hit;
+        }
+
+        return hit_count;
+    }
+
+    size_t hit_test(const rect2_t *rects, size_t count, const pos2_t &point) noexcept
+    {
+        // Search from the end, since later rectangles are drawn over earlier ones.
+        for (size_t i = count; i > 0; i--)
+        {
+            if (contains(rects[i - 1], point))
+            {
+                return i - 1;
+            }
+        }
+
+        return count;
+    }
+}
@@ -0,0 +1,208 @@
+///
+/// @file       rect_ops.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for operations on rectangles, both on single rectangles and in batches over
+///             arrays of them, for use by layout and hit-testing.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_RECT_OPS_HEADER_GUARD
+#define LEAF_SRC_RECT_OPS_HEADER_GUARD
+
+#include <cstddef>
+#include <cstdint>
+#include "graphics_types.hpp"
+
+namespace leaf
+{
+    ///
+    /// @brief  Clamps a coordinate computed with a wider type to the range of a pixel measure.
+    ///
+    /// @param  value   the coordinate
+    ///
+    /// @return the clamped coordinate
+    ///
+    inline px_t clamp_px(int32_t value) noexcept
+    {
+        // Compare with the limits of the pixel type. This compiles to selects, not branches.
+        return (px_t)(value < INT16_MIN ? INT16_MIN : (value > INT16_MAX ? INT16_MAX : value));
+    }
+
+    ///
+    /// @brief  Determines whether a rectangle covers no pixels.
+    ///
+    /// @param  rect    the rectangle
+    ///
+    /// @return true if and only if the width or height is 0 or less
+    ///
+    inline bool is_empty(const rect2_t &rect) noexcept
+    {
+        // A rectangle needs a positive width and height to cover a pixel.
+        return (rect.width <= 0) | (rect.height <= 0);
+    }
+
+    ///
+    /// @brief  Determines whether a rectangle contains a point. The left and top edges are inside
+    ///         the rectangle, the right and bottom edges are outside.
+    ///
+    /// @param  rect    the rectangle
+    /// @param  point   the point
+    ///
+    /// @return true if and only if the point is inside the rectangle
+    ///
+    inline bool contains(const rect2_t &rect, const pos2_t &point) noexcept
+    {
+        // Compare with each edge, widening so that the far edges cannot overflow. The comparisons
+        // are combined without short-circuiting so the check has no branches.
+        int32_t dx = (int32_t)point.x - rect.x;
+        int32_t dy = (int32_t)point.y - rect.y;
+
+        return (dx >= 0) & (dx < rect.width) & (dy >= 0) & (dy < rect.height);
+    }
+
+    ///
+    /// @brief  Finds the rectangle covered by both of two rectangles.
+    ///
+    /// @param  a   a rectangle
+    /// @param  b   another rectangle
+    ///
+    /// @return the intersection, which has a width and height of 0 if the rectangles do not overlap
+    ///
+    inline rect2_t intersect(const rect2_t &a, const rect2_t &b) noexcept
+    {
+        // Take the inner edges on each side, widening so that the far edges cannot overflow.
+        int32_t left = a.x > b.x ? a.x : b.x;
+        int32_t top = a.y > b.y ? a.y : b.y;
+        int32_t a_right = (int32_t)a.x + a.width;
+        int32_t b_right = (int32_t)b.x + b.width;
+        int32_t a_bottom = (int32_t)a.y + a.height;
+        int32_t b_bottom = (int32_t)b.y + b.height;
+        int32_t width = (a_right < b_right ? a_right : b_right) - left;
+        int32_t height = (a_bottom < b_bottom ? a_bottom : b_bottom) - top;
+
+        // Collapse the rectangle if the edges crossed.
+        return rect2_t((px_t)left, (px_t)top, (px_t)(width > 0 ? width : 0),
+            (px_t)(height > 0 ? height : 0));
+    }
+
+    ///
+    /// @brief  Finds the smallest rectangle that covers both of two rectangles. Empty rectangles
+    ///         do not contribute to the union.
+    ///
+    /// @param  a   a rectangle
+    /// @param  b   another rectangle
+    ///
+    /// @return the union, clamped to the range of a pixel measure
+    ///
+    inline rect2_t unite(const rect2_t &a, const rect2_t &b) noexcept
+    {
+        // Take the outer edges on each side, widening so that the far edges cannot overflow.
+        int32_t left = a.x < b.x ? a.x : b.x;
+        int32_t top = a.y < b.y ? a.y : b.y;
+        int32_t a_right = (int32_t)a.x + a.width;
+        int32_t b_right = (int32_t)b.x + b.width;
+        int32_t a_bottom = (int32_t)a.y + a.height;
+        int32_t b_bottom = (int32_t)b.y + b.height;
+        int32_t width = (a_right > b_right ? a_right : b_right) - left;
+        int32_t height = (a_bottom > b_bottom ? a_bottom : b_bottom) - top;
+        rect2_t united((px_t)left, (px_t)top, clamp_px(width), clamp_px(height));
+
+        // Select the other rectangle if one is empty.
+        return is_empty(a) ? b : (is_empty(b) ? a : united);
+    }
+
+    ///
+    /// @brief  Moves a rectangle by an offset.
+    ///
+    /// @param  rect    the rectangle
+    /// @param  offset  the distance to move in each direction
+    ///
+    /// @return the moved rectangle, clamped to the range of a pixel measure
+    ///
+    inline rect2_t translate(const rect2_t &rect, const pos2_t &offset) noexcept
+    {
+        // Add the offset to the corner and keep the size.
+        return rect2_t(clamp_px((int32_t)rect.x + offset.x), clamp_px((int32_t)rect.y + offset.y),
+            rect.width, rect.height);
+    }
+
+    ///
+    /// @brief  Intersects the rectangles of two arrays pairwise. The output may be either input.
+    ///
+    /// @param  a       the first rectangle of each pair
+    /// @param  b       the second rectangle of each pair
+    /// @param  out     set to the intersection of each pair
+    /// @param  count   the number of pairs
+    ///
+    void intersect_rects(const rect2_t *a, const rect2_t *b, rect2_t *out, size_t count) noexcept;
+
+    ///
+    /// @brief  Intersects every rectangle of an array with the same clip rectangle. The output may
+    ///         be the input.
+    ///
+    /// @param  rects   the rectangles
+    /// @param  clip    the rectangle to intersect each with
+    /// @param  out     set to each intersection
+    /// @param  count   the number of rectangles
+    ///
+    void clip_rects(const rect2_t *rects, const rect2_t &clip, rect2_t *out, size_t count) noexcept;
+
+    ///
+    /// @brief  Unites the rectangles of two arrays pairwise. The output may be either input.
+    ///
+    /// @param  a       the first rectangle of each pair
+    /// @param  b       the second rectangle of each pair
+    /// @param  out     set to the union of each pair
+    /// @param  count   the number of pairs
+    ///
+    void unite_rects(const rect2_t *a, const rect2_t *b, rect2_t *out, size_t count) noexcept;
+
+    ///
+    /// @brief  Finds the smallest rectangle that covers every rectangle of an array.
+    ///
+    /// @param  rects   the rectangles
+    /// @param  count   the number of rectangles
+    ///
+    /// @return the union of the rectangles or an empty rectangle if all of them are empty
+    ///
+    rect2_t bounding_rect(const rect2_t *rects, size_t count) noexcept;
+
+    ///
+    /// @brief  Moves every rectangle of an array by the same offset.
+    ///
+    /// @param  rects   the rectangles, which are moved in place
+    /// @param  count   the number of rectangles
+    /// @param  offset  the distance to move in each direction
+    ///
+    void translate_rects(rect2_t *rects, size_t count, const pos2_t &offset) noexcept;
+
+    ///
+    /// @brief  Determines which rectangles of an array contain a point.
+    ///
+    /// @param  rects   the rectangles
+    /// @param  count   the number of rectangles
+    /// @param  point   the point
+    /// @param  out     set to 1 for each rectangle that contains the point and 0 for each other
+    ///
+    /// @return the number of rectangles that contain the point
+    ///
+    size_t contains_point(const rect2_t *rects, size_t count, const pos2_t &point, uint8_t *out)
+        noexcept;
+
+    ///
+    /// @brief  Finds the last rectangle of an array that contains a point. When the rectangles are
+    ///         in drawing order this is the topmost one, which is the one a click hits.
+    ///
+    /// @param  rects   the rectangles
+    /// @param  count   the number of rectangles
+    /// @param  point   the point
+    ///
+    /// @return the index of the rectangle or count if none contains the point
+    ///
+    size_t hit_test(const rect2_t *rects, size_t count, const pos2_t &point) noexcept;
+}
+
+#endif
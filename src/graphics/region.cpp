@@ -0,0 +1,257 @@
+///
+/// @file       region.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a class that represents an area made up of rectangles that do
+///             not overlap.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include "region.hpp"
+#include "rect_ops.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    void region::cut_rect(const rect2_t &rect, const rect2_t &cut, vector<rect2_t> &out)
+    {
+        rect2_t overlap = leaf::intersect(rect, cut);
+
+        // Keep the whole rectangle if nothing is cut out of it.
+        if (is_empty(overlap))
+        {
+            out.push_back(rect);
+            return;
+        }
+
+        // Keep the full-width bands above and below the cut, then the parts to its left and right
+        // between them.
+        int32_t rect_right = (int32_t)rect.x + rect.width;
+        int32_t rect_bottom = (int32_t)rect.y + rect.height;
+        int32_t overlap_right = (int32_t)overlap.x + overlap.width;
+        int32_t overlap_bottom = (int32_t)overlap.y + overlap.height;
+
+        if (overlap.y > rect.y)
+        {
+            out.push_back(rect2_t(rect.x, rect.y, rect.width, clamp_px(overlap.y - rect.y)));
+        }
+
+        if (overlap_bottom < rect_bottom)
+        {
+            out.push_back(rect2_t(rect.x, clamp_px(overlap_bottom), rect.width,
+                clamp_px(rect_bottom - overlap_bottom)));
+        }
+
+        if (overlap.x > rect.x)
+        {
+            out.push_back(rect2_t(rect.x, overlap.y, clamp_px(overlap.x - rect.x),
+                overlap.height));
+        }
+
+        if (overlap_right < rect_right)
+        {
+            out.push_back(rect2_t(clamp_px(overlap_right), overlap.y,
+                clamp_px(rect_right - overlap_right), overlap.height));
+        }
+    }
+
+    region::region(void) noexcept {}
+
+    region::region(const rect2_t &rect)
+    {
+        // Start with the rectangle unless it is empty.
+        unite(rect);
+    }
+
+    const vector<rect2_t> &region::rects(void) const noexcept
+    {
+        // Return the rectangles.
+        return m_rects;
+    }
+
+    size_t region::count(void) const noexcept
+    {
+        // Return the number of rectangles.
+        return m_rects.size();
+    }
+
+    bool region::empty(void) const noexcept
+    {
+        // Empty rectangles are never kept, so any rectangle covers a pixel.
+        return m_rects.empty();
+    }
+
+    uint64_t region::area(void) const noexcept
+    {
+        // The rectangles do not overlap, so their areas add up.
+        uint64_t area = 0;
+
+        for (const rect2_t &rect : m_rects)
+        {
+            area += (uint64_t)rect.width * (uint64_t)rect.height;
+        }
+
+        return area;
+    }
+
+    rect2_t region::bounds(void) const noexcept
+    {
+        // Bound the rectangles as a batch.
+        return bounding_rect(m_rects.data(), m_rects.size());
+    }
+
+    bool region::contains(const pos2_t &point) const noexcept
+    {
+        // Find a rectangle that contains the point.
+        for (const rect2_t &rect : m_rects)
+        {
+            if (leaf::contains(rect, point))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool region::intersects(const rect2_t &rect) const noexcept
+    {
+        // Find a rectangle that overlaps the given one.
+        for (const rect2_t &own : m_rects)
+        {
+            if (!is_empty(leaf::intersect(own, rect)))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    region *region::unite(const rect2_t &rect)
+    {
+        if (is_empty(rect))
+        {
+            return this;
+        }
+
+        // Cut every existing rectangle out of the new one, so that only the uncovered pieces are
+        // left.
+        m_pieces.clear();
+        m_pieces.push_back(rect);
+
+        for (const rect2_t &own : m_rects)
+        {
+            m_next_pieces.clear();
+
+            for (const rect2_t &piece : m_pieces)
+            {
+                cut_rect(piece, own, m_next_pieces);
+            }
+
+            m_pieces.swap(m_next_pieces);
+
+            // Stop once the rectangle is fully covered.
+            if (m_pieces.empty())
+            {
+                return this;
+            }
+        }
+
+        m_rects.insert(m_rects.end(), m_pieces.begin(), m_pieces.end());
+
+        return this;
+    }
+
+    region *region::unite(const region &other)
+    {
+        // Add each rectangle of the other region.
+        for (const rect2_t &rect : other.m_rects)
+        {
+            unite(rect);
+        }
+
+        return this;
+    }
+
+    region *region::subtract(const rect2_t &rect)
+    {
+        if (is_empty(rect))
+        {
+            return this;
+        }
+
+        // Cut the rectangle out of each rectangle of the region.
+        m_pieces.clear();
+
+        for (const rect2_t &own : m_rects)
+        {
+            cut_rect(own, rect, m_pieces);
+        }
+
+        m_rects.swap(m_pieces);
+
+        return this;
+    }
+
+    region *region::subtract(const region &other)
+    {
+        // Remove each rectangle of the other region. Subtracting a region from itself would
+        // change it while it is iterated, so that is done by clearing it.
+        if (&other == this)
+        {
+            clear();
+            return this;
+        }
+
+        for (const rect2_t &rect : other.m_rects)
+        {
+            subtract(rect);
+        }
+
+        return this;
+    }
+
+    region *region::intersect(const rect2_t &clip) noexcept
+    {
+        // Clip each rectangle in place, dropping those that end up empty. Clipping only shrinks
+        // the rectangles, so they still do not overlap.
+        size_t kept = 0;
+
+        for (const rect2_t &rect : m_rects)
+        {
+            rect2_t clipped = leaf::intersect(rect, clip);
+
+            if (!is_empty(clipped))
+            {
+                m_rects[kept++] = clipped;
+            }
+        }
+
+        m_rects.resize(kept);
+
+        return this;
+    }
+
+    region *region::coalesce(size_t max_count) noexcept
+    {
+        // Replace the rectangles with their bounds. Shrinking the list does not allocate.
+        if (m_rects.size() > max_count && max_count > 0)
+        {
+            rect2_t bounds = this->bounds();
+            m_rects.resize(1);
+            m_rects[0] = bounds;
+        }
+
+        return this;
+    }
+
+    void region::clear(void) noexcept
+    {
+        // Drop the rectangles but keep the memory.
+        m_rects.clear();
+    }
+}
@@ -0,0 +1,190 @@
+///
+/// @file       region.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a class that represents an area made up of rectangles that do not
+///             overlap, such as the damaged area of a window.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_REGION_HEADER_GUARD
+#define LEAF_SRC_REGION_HEADER_GUARD
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "graphics_types.hpp"
+
+namespace leaf
+{
+    ///
+    /// @brief  Represents an area as a set of rectangles that do not overlap. Since no pixel is
+    ///         covered twice, drawing each rectangle of the region draws each pixel of the area
+    ///         exactly once, and the area is the sum of the areas of the rectangles.
+    ///
+    class region
+    {
+        private:
+            ///
+            /// @brief  The rectangles that make up the area. None of them overlap or are empty.
+            ///
+            std::vector<rect2_t> m_rects;
+
+            ///
+            /// @brief  The pieces of a rectangle being united or subtracted. The memory is reused
+            ///         between operations.
+            ///
+            std::vector<rect2_t> m_pieces;
+
+            ///
+            /// @brief  The pieces left over by the last cut. The memory is reused between
+            ///         operations.
+            ///
+            std::vector<rect2_t> m_next_pieces;
+
+            ///
+            /// @brief  Cuts a rectangle out of another and adds what is left as up to 4 rectangles
+            ///         that do not overlap.
+            ///
+            /// @param  rect    the rectangle to cut from
+            /// @param  cut     the rectangle to cut out
+            /// @param  out     the list to add the rectangles that are left to
+            ///
+            static void cut_rect(const rect2_t &rect, const rect2_t &cut,
+                std::vector<rect2_t> &out);
+
+        public:
+            ///
+            /// @brief  Constructs an empty region.
+            ///
+            region(void) noexcept;
+
+            ///
+            /// @brief  Constructs a region that covers a rectangle.
+            ///
+            /// @param  rect    the rectangle
+            ///
+            region(const rect2_t &rect);
+
+            ///
+            /// @brief  Returns the rectangles that make up the area. They do not overlap and are in
+            ///         no particular order.
+            ///
+            /// @return the rectangles
+            ///
+            const std::vector<rect2_t> &rects(void) const noexcept;
+
+            ///
+            /// @brief  Determines how many rectangles make up the area.
+            ///
+            /// @return the number of rectangles
+            ///
+            size_t count(void) const noexcept;
+
+            ///
+            /// @brief  Determines whether the region covers no pixels.
+            ///
+            /// @return true if and only if the region is empty
+            ///
+            bool empty(void) const noexcept;
+
+            ///
+            /// @brief  Determines how many pixels the region covers.
+            ///
+            /// @return the area in pixels
+            ///
+            uint64_t area(void) const noexcept;
+
+            ///
+            /// @brief  Determines the smallest rectangle that contains the region.
+            ///
+            /// @return the bounding rectangle, empty if the region is empty
+            ///
+            rect2_t bounds(void) const noexcept;
+
+            ///
+            /// @brief  Determines whether the region contains a point.
+            ///
+            /// @param  point   the point
+            ///
+            /// @return true if and only if the point is inside a rectangle of the region
+            ///
+            bool contains(const pos2_t &point) const noexcept;
+
+            ///
+            /// @brief  Determines whether the region shares any pixel with a rectangle.
+            ///
+            /// @param  rect    the rectangle
+            ///
+            /// @return true if and only if the region and the rectangle overlap
+            ///
+            bool intersects(const rect2_t &rect) const noexcept;
+
+            ///
+            /// @brief  Adds the area of a rectangle. Only the parts of the rectangle that are not
+            ///         already covered are added, so the rectangles still do not overlap.
+            ///
+            /// @param  rect    the rectangle
+            ///
+            /// @return a pointer to this region for chaining
+            ///
+            region *unite(const rect2_t &rect);
+
+            ///
+            /// @brief  Adds the area of another region.
+            ///
+            /// @param  other   the other region
+            ///
+            /// @return a pointer to this region for chaining
+            ///
+            region *unite(const region &other);
+
+            ///
+            /// @brief  Removes the area of a rectangle.
+            ///
+            /// @param  rect    the rectangle
+            ///
+            /// @return a pointer to this region for chaining
+            ///
+            region *subtract(const rect2_t &rect);
+
+            ///
+            /// @brief  Removes the area of another region.
+            ///
+            /// @param  other   the other region
+            ///
+            /// @return a pointer to this region for chaining
+            ///
+            region *subtract(const region &other);
+
+            ///
+            /// @brief  Removes the area outside a rectangle.
+            ///
+            /// @param  clip    the rectangle to keep the area inside of
+            ///
+            /// @return a pointer to this region for chaining
+            ///
+            region *intersect(const rect2_t &clip) noexcept;
+
+            ///
+            /// @brief  Replaces the rectangles with their bounding rectangle if there are more than
+            ///         a number of them. The region then covers at least the same area, in fewer
+            ///         rectangles that are cheaper to draw one at a time.
+            ///
+            /// @param  max_count   the largest number of rectangles to keep
+            ///
+            /// @return a pointer to this region for chaining
+            ///
+            region *coalesce(size_t max_count) noexcept;
+
+            ///
+            /// @brief  Removes the whole area. The memory of the region is kept so that adding to
+            ///         it again does not allocate.
+            ///
+            void clear(void) noexcept;
+    };
+}
+
+#endif
@@ -0,0 +1,110 @@
+///
+/// @file       canvas_i.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for an abstract class that represents an interface specification for a
+///             canvas. Widgets paint themselves onto a canvas.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_CANVAS_I_HEADER_GUARD
+#define LEAF_SRC_CANVAS_I_HEADER_GUARD
+
+#include <cstdint>
+#include <memory>
+#include "../../utils/slot_map.hpp"
+#include "../graphics_types.hpp"
+#include "../text/text_run.hpp"
+
+namespace leaf
+{
+    ///
+    /// @brief  Represents an interface specification for a canvas. A canvas accepts 2-dimensional
+    ///         drawing operations in pixel coordinates. It may draw them immediately or record them
+    ///         to be drawn later. Colors are 32-bit RGBA values, with red in the highest byte, as
+    ///         bgfx expects.
+    ///
+    class canvas_i
+    {
+        public:
+            ///
+            /// @brief  Fills a rectangle with a solid color.
+            ///
+            /// @param  rect    the rectangle to fill
+            /// @param  color   the color to fill with
+            ///
+            virtual void fill_rect(const rect2_t &rect, uint32_t color) noexcept = 0;
+
+            ///
+            /// @brief  Fills a rectangle with rounded corners with a solid color.
+            ///
+            /// @param  rect    the rectangle to fill
+            /// @param  radius  the radius of the corners in pixels, limited to half the shorter
+            ///                 side
+            /// @param  color   the color to fill with
+            ///
+            virtual void fill_rounded_rect(const rect2_t &rect, px_t radius, uint32_t color)
+                noexcept = 0;
+
+            ///
+            /// @brief  Draws the border along the inside of a rectangle with rounded corners.
+            ///
+            /// @param  rect    the outer edge of the border
+            /// @param  width   the width of the border in pixels
+            /// @param  radius  the radius of the outer corners in pixels, 0 for square corners
+            /// @param  color   the color of the border
+            ///
+            virtual void stroke_rect(const rect2_t &rect, px_t width, px_t radius, uint32_t color)
+                noexcept = 0;
+
+            ///
+            /// @brief  Cuts the drawing that follows to a rectangle until the clip is changed or
+            ///         reset.
+            ///
+            /// @param  clip    the rectangle to draw inside of
+            ///
+            virtual void set_clip(const rect2_t &clip) noexcept = 0;
+
+            ///
+            /// @brief  Stops cutting the drawing that follows.
+            ///
+            virtual void reset_clip(void) noexcept = 0;
+
+            ///
+            /// @brief  Draws laid out text in a solid color.
+            ///
+            /// @param  origin  the position of the top-left corner of the text
+            /// @param  run     the laid out text, which is kept alive as long as it is recorded
+            /// @param  color   the color of the text
+            ///
+            virtual void draw_text(const pos2_t &origin,
+                const std::shared_ptr<const text_run_t> &run, uint32_t color) noexcept = 0;
+
+            ///
+            /// @brief  Draws an image from a texture atlas stretched over a rectangle.
+            ///
+            /// @param  rect    the rectangle to draw into
+            /// @param  image   the handle to the image in the atlas
+            /// @param  tint    the color the image is multiplied with
+            ///
+            virtual void draw_atlas_image(const rect2_t &rect, const utl::slot_handle_t &image,
+                uint32_t tint) noexcept = 0;
+
+            ///
+            /// @brief  Draws an image from a texture atlas as a nine-patch. The corners keep their
+            ///         size, the edges stretch along their length, and the middle stretches both
+            ///         ways.
+            ///
+            /// @param  rect    the rectangle to draw into
+            /// @param  image   the handle to the image in the atlas
+            /// @param  insets  the size of the corners and edges in pixels of the image
+            /// @param  tint    the color the image is multiplied with
+            ///
+            virtual void draw_nine_patch(const rect2_t &rect, const utl::slot_handle_t &image,
+                const border_t &insets, uint32_t tint) noexcept = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,59 @@
+///
+/// @file       frame_builder_i.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for an abstract class that represents an interface specification for a frame
+///             builder. A frame builder submits the draw calls for a surface each time its renderer
+///             builds a frame.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_FRAME_BUILDER_I_HEADER_GUARD
+#define LEAF_SRC_FRAME_BUILDER_I_HEADER_GUARD
+
+#include <bgfx/bgfx.h>
+#include "../graphics_types.hpp"
+
+namespace leaf
+{
+    ///
+    /// @brief  Represents an interface specification for a frame builder. A frame builder submits
+    ///         the draw calls for a surface each time its renderer builds a frame.
+    ///
+    class frame_builder_i
+    {
+        public:
+            ///
+            /// @brief      Called once per frame to submit the draw calls for the surface. The view
+            ///             has already been bound to the surface, sized to its bounds, and cleared.
+            ///             The offscreen view is executed right before it and is left to the frame
+            ///             builder, which can bind it to a frame buffer of its own that keeps what
+            ///             was drawn across frames.
+            ///
+            /// @param      view_id             the bgfx view that draws to the surface
+            /// @param      offscreen_view_id   the bgfx view executed before it, which the frame
+            ///                                 builder must bind, size, and clear itself
+            /// @param      bounds              the bounds of the surface in pixels
+            ///
+            /// @warning    This is called on the renderer's API thread, not on the thread that
+            ///             polls window events. Any state shared with the event loop must be
+            ///             synchronized by the implementation.
+            ///
+            virtual void build_frame(bgfx::ViewId view_id, bgfx::ViewId offscreen_view_id,
+                const bounds2_t &bounds) noexcept = 0;
+
+            ///
+            /// @brief      Called once the frame builder stops drawing to its surface, when the
+            ///             surface is detached or the renderer shuts down, so that it can destroy
+            ///             any bgfx resources it created while building frames. It may be attached
+            ///             again afterwards.
+            ///
+            /// @warning    This is called on the renderer's API thread.
+            ///
+            virtual void destroy_resources(void) noexcept {}
+    };
+}
+
+#endif
@@ -0,0 +1,92 @@
+///
+/// @file       frame_stats.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for type definitions that describe how long a renderer takes to produce the
+///             frames of a render target.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_FRAME_STATS_HEADER_GUARD
+#define LEAF_SRC_FRAME_STATS_HEADER_GUARD
+
+#include <cstddef>
+#include <cstdint>
+
+namespace leaf
+{
+    ///
+    /// @brief  Summarizes one kind of frame time over the frames of a rolling window.
+    ///
+    typedef struct frame_time_summary
+    {
+        ///
+        /// @brief  The median time in nanoseconds.
+        ///
+        uint64_t p50_ns;
+
+        ///
+        /// @brief  The 95th percentile time in nanoseconds.
+        ///
+        uint64_t p95_ns;
+
+        ///
+        /// @brief  The 99th percentile time in nanoseconds.
+        ///
+        uint64_t p99_ns;
+
+        ///
+        /// @brief  The longest time in nanoseconds.
+        ///
+        uint64_t max_ns;
+
+    } frame_time_summary_t;
+
+    ///
+    /// @brief  Describes how long a renderer takes to produce the frames of one render target.
+    ///         The summaries cover the most recent frames the target was drawn in.
+    ///
+    typedef struct frame_stats
+    {
+        ///
+        /// @brief  The number of frames the target has been drawn in since it was attached.
+        ///
+        uint64_t frame_count;
+
+        ///
+        /// @brief  The number of recent frames the summaries cover.
+        ///
+        size_t window_size;
+
+        ///
+        /// @brief  The CPU time spent preparing the target's view and building its draw calls on
+        ///         the API thread.
+        ///
+        frame_time_summary_t build;
+
+        ///
+        /// @brief  The time the API thread spent submitting the frame the target was drawn in.
+        ///         Submitting waits for the render thread to finish the previous frame, so long
+        ///         submit times mean that rendering, not building, is the bottleneck.
+        ///
+        frame_time_summary_t submit;
+
+        ///
+        /// @brief  The time between the submission of the frame the target was drawn in and the
+        ///         submission of the frame before it. With vsync enabled this is paced by the
+        ///         display.
+        ///
+        frame_time_summary_t present_interval;
+
+        ///
+        /// @brief  The number of display refreshes that passed without a new frame since the
+        ///         target was attached.
+        ///
+        uint64_t missed_vsyncs;
+
+    } frame_stats_t;
+}
+
+#endif
@@ -0,0 +1,609 @@
+///
+/// @file       quad_batcher.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a canvas that draws rectangles, rounded rectangles, borders, and
+///             images with bgfx in as few draw calls as possible.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include "quad_batcher.hpp"
+#include "../../utils/logger.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    ///
+    /// @brief  Converts a color from RGBA format, with red in the highest byte, to the byte order
+    ///         the vertex layout reads, with red in the lowest byte.
+    ///
+    /// @param  color   the color in RGBA format
+    ///
+    /// @return the color in ABGR format
+    ///
+    static inline uint32_t to_abgr(uint32_t color) noexcept
+    {
+        // Reverse the bytes.
+        return (color >> 24) | ((color >> 8) & 0xff00) | ((color << 8) & 0xff0000)
+            | (color << 24);
+    }
+
+    ///
+    /// @brief  Determines the name of the directory that holds the shaders for a renderer type.
+    ///
+    /// @param  type    the renderer type
+    ///
+    /// @return the name of the directory, or null if no shaders are compiled for the type
+    ///
+    static const char *shader_language(bgfx::RendererType::Enum type) noexcept
+    {
+        // Direct3D 11 and 12 share their shaders.
+        switch (type)
+        {
+            case bgfx::RendererType::OpenGL:
+                return "glsl";
+            case bgfx::RendererType::OpenGLES:
+                return "essl";
+            case bgfx::RendererType::Vulkan:
+                return "spirv";
+            case bgfx::RendererType::Metal:
+                return "metal";
+            case bgfx::RendererType::Direct3D11:
+            case bgfx::RendererType::Direct3D12:
+                return "dx11";
+            default:
+                return NULL;
+        }
+    }
+
+    bgfx::ShaderHandle quad_batcher::load_shader(const char *name) noexcept
+    {
+        bgfx::ShaderHandle shader = BGFX_INVALID_HANDLE;
+        const char *language = shader_language(bgfx::getRendererType());
+
+        if (!language)
+        {
+            return shader;
+        }
+
+        // Read the whole file. bgfx expects the shader to end with a null character.
+        try
+        {
+            string path = m_shader_dir + "/" + language + "/" + name + ".bin";
+            ifstream file(path, ios::binary);
+
+            if (!file)
+            {
+                return shader;
+            }
+
+            vector<char> data((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+            data.push_back('\0');
+
+            shader = bgfx::createShader(bgfx::copy(data.data(), (uint32_t)data.size()));
+        }
+        catch (const exception &) {}
+
+        return shader;
+    }
+
+    void quad_batcher::create_resources(void) noexcept
+    {
+        // Only try once, so that missing shaders are not searched for every frame.
+        m_is_initialized = true;
+
+        bgfx::ShaderHandle vertex_shader = load_shader("vs_quad");
+        bgfx::ShaderHandle fragment_shader = load_shader("fs_quad");
+
+        if (!bgfx::isValid(vertex_shader) || !bgfx::isValid(fragment_shader))
+        {
+            if (bgfx::isValid(vertex_shader))
+            {
+                bgfx::destroy(vertex_shader);
+            }
+
+            if (bgfx::isValid(fragment_shader))
+            {
+                bgfx::destroy(fragment_shader);
+            }
+
+            try
+            {
+                utl::logger::log(utl::log_severity::error,
+                    "The quad shaders could not be loaded from \"" + m_shader_dir
+                    + "\". Nothing will be drawn.");
+            }
+            catch (const exception &) {}
+
+            m_is_failed = true;
+            return;
+        }
+
+        // The program takes ownership of the shaders.
+        m_program = bgfx::createProgram(vertex_shader, fragment_shader, true);
+
+        // Describe the vertices in the order of the fields of the vertex type.
+        m_layout.begin()
+            .add(bgfx::Attrib::Position, 2, bgfx::AttribType::Float)
+            .add(bgfx::Attrib::Color0, 4, bgfx::AttribType::Uint8, true)
+            .add(bgfx::Attrib::TexCoord0, 2, bgfx::AttribType::Float)
+            .add(bgfx::Attrib::TexCoord1, 3, bgfx::AttribType::Float)
+            .add(bgfx::Attrib::TexCoord2, 4, bgfx::AttribType::Float)
+            .end();
+
+        // Shapes are drawn with a white texture so that every quad uses the same program.
+        const uint32_t white = 0xffffffff;
+        m_sampler = bgfx::createUniform("s_texColor", bgfx::UniformType::Sampler);
+        m_white_texture = bgfx::createTexture2D(1, 1, false, 1, bgfx::TextureFormat::RGBA8,
+            BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT | BGFX_SAMPLER_MIP_POINT,
+            bgfx::copy(&white, sizeof(white)));
+    }
+
+    uint32_t quad_batcher::find_batch(bgfx::TextureHandle texture, float x0, float y0, float x1,
+        float y1)
+    {
+        // Look back through the most recent batches for one with the same texture. A batch that
+        // overlaps the quad is drawn after any batch before it, so the quad cannot join one of
+        // those.
+        size_t lookback = min(m_batches.size(), (size_t)LEAF_QUAD_BATCHER_LOOKBACK);
+        size_t found = m_batches.size();
+
+        for (size_t i = m_batches.size(); i > m_batches.size() - lookback; i--)
+        {
+            const batch_t &batch = m_batches[i - 1];
+
+            if (batch.texture.idx == texture.idx)
+            {
+                found = i - 1;
+                break;
+            }
+
+            if (batch.x0 < x1 && x0 < batch.x1 && batch.y0 < y1 && y0 < batch.y1)
+            {
+                break;
+            }
+        }
+
+        // Start a batch if none can take the quad.
+        if (found == m_batches.size())
+        {
+            m_batches.push_back({texture, 0, 0, x0, y0, x1, y1});
+        }
+
+        batch_t &batch = m_batches[found];
+        batch.quad_count++;
+        batch.x0 = min(batch.x0, x0);
+        batch.y0 = min(batch.y0, y0);
+        batch.x1 = max(batch.x1, x1);
+        batch.y1 = max(batch.y1, y1);
+
+        return (uint32_t)found;
+    }
+
+    void quad_batcher::add_quad(const rect2_t &rect, bgfx::TextureHandle texture, float u0,
+        float v0, float u1, float v1, uint32_t color, float radius, float border,
+        quad_texture_mode mode) noexcept
+    {
+        float x0 = rect.x;
+        float y0 = rect.y;
+        float x1 = x0 + rect.width;
+        float y1 = y0 + rect.height;
+
+        // Cut the quad to the clip rectangle, skipping it if nothing is left.
+        float clipped_x0 = max(x0, m_clip_x0);
+        float clipped_y0 = max(y0, m_clip_y0);
+        float clipped_x1 = min(x1, m_clip_x1);
+        float clipped_y1 = min(y1, m_clip_y1);
+
+        if (clipped_x0 >= clipped_x1 || clipped_y0 >= clipped_y1 || !bgfx::isValid(texture))
+        {
+            return;
+        }
+
+        // Cut the texture coordinates by the same fractions as the quad.
+        float du = (u1 - u0) / (x1 - x0);
+        float dv = (v1 - v0) / (y1 - y0);
+        float clipped_u0 = u0 + (clipped_x0 - x0) * du;
+        float clipped_v0 = v0 + (clipped_y0 - y0) * dv;
+        float clipped_u1 = u0 + (clipped_x1 - x0) * du;
+        float clipped_v1 = v0 + (clipped_y1 - y0) * dv;
+
+        // The shape is still drawn from its own center and size, so cutting it does not change
+        // its corners.
+        float half_width = rect.width * 0.5f;
+        float half_height = rect.height * 0.5f;
+        float center_x = x0 + half_width;
+        float center_y = y0 + half_height;
+        radius = min(radius, min(half_width, half_height));
+        uint32_t abgr = to_abgr(color);
+
+        size_t vertex_count = m_vertices.size();
+        size_t quad_count = m_quad_batches.size();
+
+        // Add the corners in the order top left, top right, bottom left, bottom right. If the
+        // lists cannot grow, the quad is lost rather than failing the frame.
+        try
+        {
+            m_vertices.resize(vertex_count + 4);
+            m_quad_batches.push_back(0);
+            m_quad_batches.back() = find_batch(texture, clipped_x0, clipped_y0, clipped_x1,
+                clipped_y1);
+        }
+        catch (const exception &)
+        {
+            m_vertices.resize(vertex_count);
+            m_quad_batches.resize(quad_count);
+            return;
+        }
+
+        quad_vertex_t *corners = &m_vertices[vertex_count];
+
+        for (int i = 0; i < 4; i++)
+        {
+            quad_vertex_t &corner = corners[i];
+            bool is_right = i & 1;
+            bool is_bottom = i & 2;
+
+            corner.x = is_right ? clipped_x1 : clipped_x0;
+            corner.y = is_bottom ? clipped_y1 : clipped_y0;
+            corner.abgr = abgr;
+            corner.u = is_right ? clipped_u1 : clipped_u0;
+            corner.v = is_bottom ? clipped_v1 : clipped_v0;
+            corner.local_x = corner.x - center_x;
+            corner.local_y = corner.y - center_y;
+            corner.texture_mode = (float)mode;
+            corner.half_width = half_width;
+            corner.half_height = half_height;
+            corner.radius = radius;
+            corner.border = border;
+        }
+    }
+
+    quad_batcher::quad_batcher(const string &shader_dir)
+        // Nothing is created with bgfx until the batcher first draws.
+        : m_shader_dir(shader_dir), m_is_initialized(false), m_is_failed(false),
+        m_program(BGFX_INVALID_HANDLE), m_sampler(BGFX_INVALID_HANDLE),
+        m_white_texture(BGFX_INVALID_HANDLE), m_glyph_atlas(NULL), m_texture_atlas(NULL),
+        m_view_id(0), m_bounds(0, 0), m_clip_x0(0), m_clip_y0(0), m_clip_x1(0), m_clip_y1(0),
+        m_stats({0, 0, 0, 0, 0}) {}
+
+    quad_batcher::~quad_batcher(void) noexcept {}
+
+    quad_batcher *quad_batcher::set_glyph_atlas(glyph_atlas *atlas) noexcept
+    {
+        // Set the atlas.
+        m_glyph_atlas = atlas;
+
+        return this;
+    }
+
+    quad_batcher *quad_batcher::set_texture_atlas(texture_atlas *atlas) noexcept
+    {
+        // Set the atlas.
+        m_texture_atlas = atlas;
+
+        return this;
+    }
+
+    void quad_batcher::begin(bgfx::ViewId view_id, const bounds2_t &bounds) noexcept
+    {
+        // Create the bgfx resources the first time anything is drawn.
+        if (!m_is_initialized)
+        {
+            create_resources();
+        }
+
+        // Let the glyphs of the last frame make room for those of this one.
+        if (m_glyph_atlas)
+        {
+            m_glyph_atlas->next_frame();
+        }
+
+        // Upload the images that were added or moved since the last frame.
+        if (m_texture_atlas)
+        {
+            m_texture_atlas->update();
+        }
+
+        // Forget the quads of the last frame but keep the memory.
+        m_view_id = view_id;
+        m_bounds = bounds;
+        m_vertices.clear();
+        m_quad_batches.clear();
+        m_batches.clear();
+        reset_clip();
+    }
+
+    void quad_batcher::fill_rect(const rect2_t &rect, uint32_t color) noexcept
+    {
+        // Draw the white texture with square corners.
+        add_quad(rect, m_white_texture, 0, 0, 1, 1, color, 0, 0, quad_texture_mode::color);
+    }
+
+    void quad_batcher::fill_rounded_rect(const rect2_t &rect, px_t radius, uint32_t color) noexcept
+    {
+        // The fragment shader rounds the corners.
+        add_quad(rect, m_white_texture, 0, 0, 1, 1, color, max(radius, (px_t)0), 0,
+            quad_texture_mode::color);
+    }
+
+    void quad_batcher::stroke_rect(const rect2_t &rect, px_t width, px_t radius, uint32_t color)
+        noexcept
+    {
+        // The fragment shader leaves out the inside of the border.
+        if (width > 0)
+        {
+            add_quad(rect, m_white_texture, 0, 0, 1, 1, color, max(radius, (px_t)0), width,
+                quad_texture_mode::color);
+        }
+    }
+
+    void quad_batcher::set_clip(const rect2_t &clip) noexcept
+    {
+        // Drawing can never leave the view.
+        m_clip_x0 = max((float)clip.x, 0.0f);
+        m_clip_y0 = max((float)clip.y, 0.0f);
+        m_clip_x1 = min((float)clip.x + clip.width, (float)m_bounds.width);
+        m_clip_y1 = min((float)clip.y + clip.height, (float)m_bounds.height);
+    }
+
+    void quad_batcher::reset_clip(void) noexcept
+    {
+        // Cut drawing to the view only.
+        set_clip(rect2_t(0, 0, m_bounds.width, m_bounds.height));
+    }
+
+    void quad_batcher::draw_text(const pos2_t &origin, const shared_ptr<const text_run_t> &run,
+        uint32_t color) noexcept
+    {
+        if (!m_glyph_atlas || !run || m_is_failed)
+        {
+            return;
+        }
+
+        // Scale the glyphs from the size the atlas rasterized them at.
+        float scale = (float)run->size / m_glyph_atlas->raster_size(run->size);
+        quad_texture_mode mode = m_glyph_atlas->mode() == glyph_atlas_mode::distance_field
+            ? quad_texture_mode::distance_field : quad_texture_mode::coverage;
+
+        for (const positioned_glyph_t &placed : run->glyphs)
+        {
+            const atlas_glyph_t *glyph = m_glyph_atlas->find(*run->face, placed.glyph, run->size);
+
+            if (!glyph || glyph->box.width == 0)
+            {
+                continue;
+            }
+
+            // Round the edges to whole pixels, so that the pixels of a bitmap glyph line up with
+            // those of the atlas.
+            float pen_x = origin.x + placed.x;
+            float pen_y = origin.y + placed.y;
+            long x0 = lround(pen_x + glyph->box.x * scale);
+            long y0 = lround(pen_y + glyph->box.y * scale);
+            long x1 = lround(pen_x + (glyph->box.x + glyph->box.width) * scale);
+            long y1 = lround(pen_y + (glyph->box.y + glyph->box.height) * scale);
+
+            add_quad(rect2_t((px_t)x0, (px_t)y0, (px_t)(x1 - x0), (px_t)(y1 - y0)),
+                m_glyph_atlas->texture(), glyph->u0, glyph->v0, glyph->u1, glyph->v1, color, 0, 0,
+                mode);
+        }
+    }
+
+    void quad_batcher::draw_image(const rect2_t &rect, bgfx::TextureHandle texture, float u0,
+        float v0, float u1, float v1, uint32_t tint) noexcept
+    {
+        // Images have square corners.
+        add_quad(rect, texture, u0, v0, u1, v1, tint, 0, 0, quad_texture_mode::color);
+    }
+
+    void quad_batcher::draw_atlas_image(const rect2_t &rect, const utl::slot_handle_t &image,
+        uint32_t tint) noexcept
+    {
+        atlas_region_t region;
+
+        if (!m_texture_atlas || !m_texture_atlas->find(image, region))
+        {
+            return;
+        }
+
+        // Draw the region of the page like any other image.
+        draw_image(rect, region.texture, region.u0, region.v0, region.u1, region.v1, tint);
+    }
+
+    void quad_batcher::draw_nine_patch(const rect2_t &rect, const utl::slot_handle_t &image,
+        const border_t &insets, uint32_t tint) noexcept
+    {
+        atlas_region_t region;
+
+        if (!m_texture_atlas || !m_texture_atlas->find(image, region))
+        {
+            return;
+        }
+
+        // Shrink the insets evenly along an axis they do not fit.
+        float scale_x = insets.left + insets.right > rect.width
+            ? (float)rect.width / (insets.left + insets.right) : 1.0f;
+        float scale_y = insets.top + insets.bottom > rect.height
+            ? (float)rect.height / (insets.top + insets.bottom) : 1.0f;
+
+        // Find the edges of the nine patches on the screen and in the texture.
+        px_t xs[4] = {rect.x, (px_t)(rect.x + insets.left * scale_x),
+            (px_t)(rect.x + rect.width - insets.right * scale_x), (px_t)(rect.x + rect.width)};
+        px_t ys[4] = {rect.y, (px_t)(rect.y + insets.top * scale_y),
+            (px_t)(rect.y + rect.height - insets.bottom * scale_y), (px_t)(rect.y + rect.height)};
+
+        float texel_u = (region.u1 - region.u0) / region.width;
+        float texel_v = (region.v1 - region.v0) / region.height;
+        float us[4] = {region.u0, region.u0 + insets.left * texel_u,
+            region.u1 - insets.right * texel_u, region.u1};
+        float vs[4] = {region.v0, region.v0 + insets.top * texel_v,
+            region.v1 - insets.bottom * texel_v, region.v1};
+
+        // Empty patches are skipped when their quads are cut to the clip rectangle.
+        for (int row = 0; row < 3; row++)
+        {
+            for (int column = 0; column < 3; column++)
+            {
+                draw_image(rect2_t(xs[column], ys[row], xs[column + 1] - xs[column],
+                    ys[row + 1] - ys[row]), region.texture, us[column], vs[row], us[column + 1],
+                    vs[row + 1], tint);
+            }
+        }
+    }
+
+    void quad_batcher::end(void) noexcept
+    {
+        m_stats = {0, 0, 0, 0, 0};
+        uint32_t quad_count = (uint32_t)m_quad_batches.size();
+
+        if (m_is_failed || quad_count == 0)
+        {
+            m_stats.dropped_quads = m_is_failed ? quad_count : 0;
+            return;
+        }
+
+        // Draw as many quads as bgfx has room for. The quads drawn last are left out, since the
+        // order of the rest does not depend on them.
+        uint32_t drawn_count = bgfx::getAvailTransientVertexBuffer(quad_count * 4, m_layout) / 4;
+
+        for (batch_t &batch : m_batches)
+        {
+            batch.quad_count = 0;
+        }
+
+        uint32_t largest_count = 0;
+
+        for (uint32_t i = 0; i < drawn_count; i++)
+        {
+            batch_t &batch = m_batches[m_quad_batches[i]];
+            batch.quad_count++;
+            largest_count = max(largest_count, batch.quad_count);
+        }
+
+        // Every draw call uses the same index pattern from the start of the index buffer, with
+        // its vertices offset into the vertex buffer.
+        uint32_t pattern_count = min(largest_count, (uint32_t)LEAF_QUAD_BATCHER_MAX_QUADS_PER_DRAW);
+        bgfx::TransientVertexBuffer vertex_buffer;
+        bgfx::TransientIndexBuffer index_buffer;
+
+        if (drawn_count == 0 || !bgfx::allocTransientBuffers(&vertex_buffer, m_layout,
+            drawn_count * 4, &index_buffer, pattern_count * 6))
+        {
+            m_stats.dropped_quads = quad_count;
+            return;
+        }
+
+        // Find where each batch starts, then copy the quads of each batch next to each other.
+        uint32_t first_quad = 0;
+
+        for (batch_t &batch : m_batches)
+        {
+            batch.first_quad = first_quad;
+            first_quad += batch.quad_count;
+        }
+
+        quad_vertex_t *vertices = (quad_vertex_t *)vertex_buffer.data;
+
+        for (uint32_t i = 0; i < drawn_count; i++)
+        {
+            batch_t &batch = m_batches[m_quad_batches[i]];
+            copy_n(&m_vertices[i * 4], 4, &vertices[batch.first_quad++ * 4]);
+        }
+
+        uint16_t *indices = (uint16_t *)index_buffer.data;
+
+        for (uint32_t i = 0; i < pattern_count; i++)
+        {
+            uint16_t corner = (uint16_t)(i * 4);
+            indices[i * 6 + 0] = corner;
+            indices[i * 6 + 1] = corner + 1;
+            indices[i * 6 + 2] = corner + 2;
+            indices[i * 6 + 3] = corner + 2;
+            indices[i * 6 + 4] = corner + 1;
+            indices[i * 6 + 5] = corner + 3;
+        }
+
+        // Map pixels to clip space with the origin at the top left. Draw calls are kept in the
+        // order they are submitted so that batches overlap as they were drawn.
+        float projection[16] = {0};
+        projection[0] = 2.0f / max((int)m_bounds.width, 1);
+        projection[5] = -2.0f / max((int)m_bounds.height, 1);
+        projection[10] = 1.0f;
+        projection[12] = -1.0f;
+        projection[13] = 1.0f;
+        projection[15] = 1.0f;
+
+        bgfx::setViewTransform(m_view_id, NULL, projection);
+        bgfx::setViewMode(m_view_id, bgfx::ViewMode::Sequential);
+
+        // Blend the alpha channel as the coverage of both layers, so that drawing into a frame
+        // buffer that is shown later leaves opaque pixels opaque.
+        uint64_t state = BGFX_STATE_WRITE_RGB | BGFX_STATE_WRITE_A | BGFX_STATE_MSAA
+            | BGFX_STATE_BLEND_FUNC_SEPARATE(BGFX_STATE_BLEND_SRC_ALPHA,
+                BGFX_STATE_BLEND_INV_SRC_ALPHA, BGFX_STATE_BLEND_ONE,
+                BGFX_STATE_BLEND_INV_SRC_ALPHA);
+
+        // Draw each batch, splitting it where the index pattern runs out.
+        for (const batch_t &batch : m_batches)
+        {
+            uint32_t start = batch.first_quad - batch.quad_count;
+
+            for (uint32_t done = 0; done < batch.quad_count; done += pattern_count)
+            {
+                uint32_t count = min(batch.quad_count - done, pattern_count);
+
+                bgfx::setVertexBuffer(0, &vertex_buffer, (start + done) * 4, count * 4);
+                bgfx::setIndexBuffer(&index_buffer, 0, count * 6);
+                bgfx::setTexture(0, m_sampler, batch.texture);
+                bgfx::setState(state);
+                bgfx::submit(m_view_id, m_program);
+
+                m_stats.draw_calls++;
+                m_stats.indices += count * 6;
+            }
+        }
+
+        m_stats.quads = drawn_count;
+        m_stats.vertices = drawn_count * 4;
+        m_stats.dropped_quads = quad_count - drawn_count;
+    }
+
+    void quad_batcher::destroy_resources(void) noexcept
+    {
+        // Destroy whatever was created. The shaders belong to the program.
+        if (bgfx::isValid(m_program))
+        {
+            bgfx::destroy(m_program);
+        }
+
+        if (bgfx::isValid(m_sampler))
+        {
+            bgfx::destroy(m_sampler);
+        }
+
+        if (bgfx::isValid(m_white_texture))
+        {
+            bgfx::destroy(m_white_texture);
+        }
+
+        m_program = BGFX_INVALID_HANDLE;
+        m_sampler = BGFX_INVALID_HANDLE;
+        m_white_texture = BGFX_INVALID_HANDLE;
+        m_is_initialized = false;
+        m_is_failed = false;
+    }
+
+    const quad_batcher_stats_t &quad_batcher::stats(void) const noexcept
+    {
+        // Return the statistics of the last frame.
+        return m_stats;
+    }
+}
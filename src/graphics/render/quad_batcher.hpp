@@ -0,0 +1,466 @@
+///
+/// @file       quad_batcher.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a canvas that draws rectangles, rounded rectangles, borders, and images
+///             with bgfx in as few draw calls as possible.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_QUAD_BATCHER_HEADER_GUARD
+#define LEAF_SRC_QUAD_BATCHER_HEADER_GUARD
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <bgfx/bgfx.h>
+#include "../../utils/unique.hpp"
+#include "../text/glyph_atlas.hpp"
+#include "canvas_i.hpp"
+#include "texture_atlas.hpp"
+
+///
+/// @brief  The directory the compiled quad shaders are loaded from by default. The shaders for
+///         each renderer type are in a subdirectory named after their shader language.
+///
+#define LEAF_QUAD_BATCHER_SHADER_DIR "shaders"
+
+///
+/// @brief  The largest number of quads drawn by a single draw call. Each quad has 4 vertices and
+///         16-bit indices can address 65,536 of them.
+///
+#define LEAF_QUAD_BATCHER_MAX_QUADS_PER_DRAW 16384
+
+///
+/// @brief  The number of most recent batches a quad may join. A quad joins the most recent batch
+///         with the same texture unless a batch after it overlaps the quad.
+///
+#define LEAF_QUAD_BATCHER_LOOKBACK 8
+
+namespace leaf
+{
+    ///
+    /// @brief  Identifies how the texture of a quad is read.
+    ///
+    enum class quad_texture_mode : uint8_t
+    {
+        ///
+        /// @brief  The texture holds colors that are multiplied with the color of the quad.
+        ///
+        color,
+
+        ///
+        /// @brief  The only channel of the texture holds the coverage of the color of the quad,
+        ///         as in a glyph atlas.
+        ///
+        coverage,
+
+        ///
+        /// @brief  The only channel of the texture holds a signed distance field, as in a distance
+        ///         field glyph atlas, which is drawn with smooth edges at any scale.
+        ///
+        distance_field
+    };
+
+    ///
+    /// @brief  A corner of a quad as the shaders read it. Shapes are drawn by the fragment shader
+    ///         from their distance to the edge, so that corners and borders are smooth without
+    ///         extra geometry.
+    ///
+    typedef struct quad_vertex
+    {
+        ///
+        /// @brief  The position of the corner in pixels.
+        ///
+        float x, y;
+
+        ///
+        /// @brief  The color of the quad with red in the lowest byte, as the vertex layout reads
+        ///         it.
+        ///
+        uint32_t abgr;
+
+        ///
+        /// @brief  The texture coordinates of the corner.
+        ///
+        float u, v;
+
+        ///
+        /// @brief  The position of the corner relative to the center of the shape in pixels.
+        ///
+        float local_x, local_y;
+
+        ///
+        /// @brief  How the texture is read, as a quad_texture_mode.
+        ///
+        float texture_mode;
+
+        ///
+        /// @brief  Half the width and height of the shape, the radius of its corners, and the
+        ///         width of its border, or 0 if it is filled, all in pixels.
+        ///
+        float half_width, half_height, radius, border;
+
+    } quad_vertex_t;
+
+    ///
+    /// @brief  Describes how a quad batcher drew a frame.
+    ///
+    typedef struct quad_batcher_stats
+    {
+        ///
+        /// @brief  The number of draw calls submitted.
+        ///
+        uint32_t draw_calls;
+
+        ///
+        /// @brief  The number of quads drawn.
+        ///
+        uint32_t quads;
+
+        ///
+        /// @brief  The number of vertices submitted.
+        ///
+        uint32_t vertices;
+
+        ///
+        /// @brief  The number of indices submitted.
+        ///
+        uint32_t indices;
+
+        ///
+        /// @brief  The number of quads that were not drawn because bgfx ran out of transient
+        ///         buffer space.
+        ///
+        uint32_t dropped_quads;
+
+    } quad_batcher_stats_t;
+
+    ///
+    /// @brief  A canvas that draws into a bgfx view. Every shape is a quad that is cut to the clip
+    ///         rectangle on the CPU, so changing the clip never splits a batch. Quads are grouped
+    ///         into batches by texture, and a quad may join an earlier batch as long as no batch
+    ///         drawn in between overlaps it, so the result looks the same as drawing every quad in
+    ///         order. The vertices of every batch are written into one transient vertex buffer and
+    ///         each batch is drawn with a single draw call sharing one index pattern.
+    ///
+    ///         Drawing begins with begin and is submitted by end. The batcher must only be used on
+    ///         the renderer's API thread, where its bgfx resources are created the first time it
+    ///         draws.
+    ///
+    class quad_batcher : public utl::unique, public canvas_i
+    {
+        private:
+            ///
+            /// @brief  Quads that share a texture and are drawn together.
+            ///
+            typedef struct batch
+            {
+                ///
+                /// @brief  The texture of the quads.
+                ///
+                bgfx::TextureHandle texture;
+
+                ///
+                /// @brief  The number of quads.
+                ///
+                uint32_t quad_count;
+
+                ///
+                /// @brief  The index of the first quad once the quads are sorted by batch.
+                ///
+                uint32_t first_quad;
+
+                ///
+                /// @brief  The bounds of the quads in pixels.
+                ///
+                float x0, y0, x1, y1;
+
+            } batch_t;
+
+            ///
+            /// @brief  The directory the compiled shaders are loaded from.
+            ///
+            std::string m_shader_dir;
+
+            ///
+            /// @brief  Whether the bgfx resources were created.
+            ///
+            bool m_is_initialized;
+
+            ///
+            /// @brief  Whether the bgfx resources could not be created. Nothing is drawn then.
+            ///
+            bool m_is_failed;
+
+            ///
+            /// @brief  The layout of the vertices.
+            ///
+            bgfx::VertexLayout m_layout;
+
+            ///
+            /// @brief  The program that draws the quads.
+            ///
+            bgfx::ProgramHandle m_program;
+
+            ///
+            /// @brief  The sampler the texture of each batch is bound to.
+            ///
+            bgfx::UniformHandle m_sampler;
+
+            ///
+            /// @brief  A white texture of a single pixel that shapes are drawn with.
+            ///
+            bgfx::TextureHandle m_white_texture;
+
+            ///
+            /// @brief  The atlas text is drawn from, or null if text is not drawn.
+            ///
+            glyph_atlas *m_glyph_atlas;
+
+            ///
+            /// @brief  The atlas images are drawn from, or null if atlas images are not drawn.
+            ///
+            texture_atlas *m_texture_atlas;
+
+            ///
+            /// @brief  The view being drawn into.
+            ///
+            bgfx::ViewId m_view_id;
+
+            ///
+            /// @brief  The bounds of the view being drawn into.
+            ///
+            bounds2_t m_bounds;
+
+            ///
+            /// @brief  The rectangle drawing is cut to.
+            ///
+            float m_clip_x0, m_clip_y0, m_clip_x1, m_clip_y1;
+
+            ///
+            /// @brief  The vertices of the quads in the order they were drawn, 4 for each quad.
+            ///
+            std::vector<quad_vertex_t> m_vertices;
+
+            ///
+            /// @brief  The batch of each quad.
+            ///
+            std::vector<uint32_t> m_quad_batches;
+
+            ///
+            /// @brief  The batches in the order they are drawn.
+            ///
+            std::vector<batch_t> m_batches;
+
+            ///
+            /// @brief  How the last frame was drawn.
+            ///
+            quad_batcher_stats_t m_stats;
+
+            ///
+            /// @brief  Loads a compiled shader for the current renderer type.
+            ///
+            /// @param  name    the name of the shader file without its extension
+            ///
+            /// @return the shader, invalid if it could not be loaded
+            ///
+            bgfx::ShaderHandle load_shader(const char *name) noexcept;
+
+            ///
+            /// @brief  Creates the bgfx resources. If they cannot be created, the failure is
+            ///         logged and nothing is drawn.
+            ///
+            void create_resources(void) noexcept;
+
+            ///
+            /// @brief  Finds a batch for a quad, adding one if no batch can take it.
+            ///
+            /// @param  texture the texture of the quad
+            /// @param  x0      the left edge of the quad
+            /// @param  y0      the top edge of the quad
+            /// @param  x1      the right edge of the quad
+            /// @param  y1      the bottom edge of the quad
+            ///
+            /// @return the index of the batch
+            ///
+            uint32_t find_batch(bgfx::TextureHandle texture, float x0, float y0, float x1,
+                float y1);
+
+            ///
+            /// @brief  Adds a quad cut to the clip rectangle. Quads outside the clip rectangle are
+            ///         skipped.
+            ///
+            /// @param  rect        the rectangle of the quad
+            /// @param  texture     the texture of the quad
+            /// @param  u0          the left texture coordinate
+            /// @param  v0          the top texture coordinate
+            /// @param  u1          the right texture coordinate
+            /// @param  v1          the bottom texture coordinate
+            /// @param  color       the color of the quad in RGBA format
+            /// @param  radius      the radius of the corners in pixels
+            /// @param  border      the width of the border in pixels, 0 if the quad is filled
+            /// @param  mode        how the texture is read
+            ///
+            void add_quad(const rect2_t &rect, bgfx::TextureHandle texture, float u0, float v0,
+                float u1, float v1, uint32_t color, float radius, float border,
+                quad_texture_mode mode) noexcept;
+
+        public:
+            ///
+            /// @brief  Constructs a batcher. Nothing is created with bgfx until it first draws.
+            ///
+            /// @param  shader_dir  the directory the compiled shaders are loaded from
+            ///
+            quad_batcher(const std::string &shader_dir = LEAF_QUAD_BATCHER_SHADER_DIR);
+
+            ///
+            /// @brief      Destroys the batcher.
+            ///
+            /// @warning    The bgfx resources must have been destroyed on the API thread first.
+            ///
+            virtual ~quad_batcher(void) noexcept;
+
+            ///
+            /// @brief  Sets the atlas text is drawn from. The atlas starts a new frame each time
+            ///         the batcher begins drawing.
+            ///
+            /// @param  atlas   the atlas, which must outlive its use, or null to not draw text
+            ///
+            /// @return a pointer to this batcher for chaining
+            ///
+            quad_batcher *set_glyph_atlas(glyph_atlas *atlas) noexcept;
+
+            ///
+            /// @brief  Sets the atlas images are drawn from. The atlas is updated each time the
+            ///         batcher begins drawing, so that the images added since are uploaded.
+            ///
+            /// @param  atlas   the atlas, which must outlive its use, or null to not draw images
+            ///
+            /// @return a pointer to this batcher for chaining
+            ///
+            quad_batcher *set_texture_atlas(texture_atlas *atlas) noexcept;
+
+            ///
+            /// @brief  Begins drawing into a view, forgetting any quads from the last frame.
+            ///
+            /// @param  view_id the view to draw into
+            /// @param  bounds  the bounds of the view in pixels
+            ///
+            void begin(bgfx::ViewId view_id, const bounds2_t &bounds) noexcept;
+
+            ///
+            /// @brief  Fills a rectangle with a solid color.
+            ///
+            /// @param  rect    the rectangle to fill
+            /// @param  color   the color to fill with
+            ///
+            virtual void fill_rect(const rect2_t &rect, uint32_t color) noexcept override;
+
+            ///
+            /// @brief  Fills a rectangle with rounded corners with a solid color.
+            ///
+            /// @param  rect    the rectangle to fill
+            /// @param  radius  the radius of the corners in pixels
+            /// @param  color   the color to fill with
+            ///
+            virtual void fill_rounded_rect(const rect2_t &rect, px_t radius, uint32_t color)
+                noexcept override;
+
+            ///
+            /// @brief  Draws the border along the inside of a rectangle.
+            ///
+            /// @param  rect    the outer edge of the border
+            /// @param  width   the width of the border in pixels
+            /// @param  radius  the radius of the outer corners in pixels
+            /// @param  color   the color of the border
+            ///
+            virtual void stroke_rect(const rect2_t &rect, px_t width, px_t radius, uint32_t color)
+                noexcept override;
+
+            ///
+            /// @brief  Cuts the drawing that follows to a rectangle.
+            ///
+            /// @param  clip    the rectangle to draw inside of
+            ///
+            virtual void set_clip(const rect2_t &clip) noexcept override;
+
+            ///
+            /// @brief  Cuts the drawing that follows to the view only.
+            ///
+            virtual void reset_clip(void) noexcept override;
+
+            ///
+            /// @brief  Draws laid out text with a quad for each glyph from the glyph atlas. The
+            ///         glyphs of a distance field atlas are scaled to the size of the text. Glyphs
+            ///         that do not fit into the atlas are left out.
+            ///
+            /// @param  origin  the position of the top-left corner of the text
+            /// @param  run     the laid out text
+            /// @param  color   the color of the text
+            ///
+            virtual void draw_text(const pos2_t &origin,
+                const std::shared_ptr<const text_run_t> &run, uint32_t color) noexcept override;
+
+            ///
+            /// @brief  Draws an image from the texture atlas stretched over a rectangle. Images
+            ///         that are not uploaded yet are left out.
+            ///
+            /// @param  rect    the rectangle to draw into
+            /// @param  image   the handle to the image in the atlas
+            /// @param  tint    the color the image is multiplied with
+            ///
+            virtual void draw_atlas_image(const rect2_t &rect, const utl::slot_handle_t &image,
+                uint32_t tint) noexcept override;
+
+            ///
+            /// @brief  Draws an image from the texture atlas as a nine-patch of up to nine quads,
+            ///         which batch with each other and with other images of the atlas. Insets that
+            ///         do not fit into the rectangle are shrunk evenly.
+            ///
+            /// @param  rect    the rectangle to draw into
+            /// @param  image   the handle to the image in the atlas
+            /// @param  insets  the size of the corners and edges in pixels of the image
+            /// @param  tint    the color the image is multiplied with
+            ///
+            virtual void draw_nine_patch(const rect2_t &rect, const utl::slot_handle_t &image,
+                const border_t &insets, uint32_t tint) noexcept override;
+
+            ///
+            /// @brief  Draws part of a texture into a rectangle.
+            ///
+            /// @param  rect    the rectangle to draw into
+            /// @param  texture the texture to draw
+            /// @param  u0      the left texture coordinate
+            /// @param  v0      the top texture coordinate
+            /// @param  u1      the right texture coordinate
+            /// @param  v1      the bottom texture coordinate
+            /// @param  tint    the color the texture is multiplied with in RGBA format
+            ///
+            void draw_image(const rect2_t &rect, bgfx::TextureHandle texture, float u0, float v0,
+                float u1, float v1, uint32_t tint = 0xffffffff) noexcept;
+
+            ///
+            /// @brief  Submits the quads drawn since begin to the view.
+            ///
+            void end(void) noexcept;
+
+            ///
+            /// @brief  Destroys the bgfx resources. They are created again if the batcher draws
+            ///         again. This must be called on the API thread before bgfx shuts down.
+            ///
+            void destroy_resources(void) noexcept;
+
+            ///
+            /// @brief  Returns how the last frame was drawn.
+            ///
+            /// @return the statistics of the last frame
+            ///
+            const quad_batcher_stats_t &stats(void) const noexcept;
+    };
+}
+
+#endif
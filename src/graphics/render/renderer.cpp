@@ -0,0 +1,703 @@
+///
+/// @file       renderer.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a class that renders native surfaces with bgfx. Frames are
+///             built and submitted on a dedicated API thread while the thread that created the
+///             renderer executes them, so a frame that takes long to build never stalls window
+///             events.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <chrono>
+#include <stdexcept>
+#include <bgfx/bgfx.h>
+#include <bgfx/platform.h>
+#include "renderer.hpp"
+#include "../../utils/trace.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    // Initially, no renderer is active.
+    renderer *renderer::f_active = NULL;
+
+    ///
+    /// @brief  Reads the monotonic clock frame times are measured with.
+    ///
+    /// @return the current time in nanoseconds
+    ///
+    static inline uint64_t now_ns(void) noexcept
+    {
+        // Read the steady clock and convert the time since its epoch to nanoseconds.
+        return (uint64_t)chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    ///
+    /// @brief  Converts a time in nanoseconds to milliseconds for display.
+    ///
+    /// @param  time_ns the time in nanoseconds
+    ///
+    /// @return the time in milliseconds
+    ///
+    static inline double to_ms(uint64_t time_ns) noexcept
+    {
+        // Divide by the number of nanoseconds in a millisecond.
+        return (double)time_ns / 1e6;
+    }
+
+    ///
+    /// @brief  Determines the offscreen view of a render target, which bgfx executes right before
+    ///         the view of the target.
+    ///
+    /// @param  view_id the view of the render target
+    ///
+    /// @return the offscreen view
+    ///
+    static inline bgfx::ViewId offscreen_view(bgfx::ViewId view_id) noexcept
+    {
+        // The offscreen views follow the views of the targets.
+        return (bgfx::ViewId)(view_id + LEAF_RENDERER_MAX_TARGETS);
+    }
+
+    uint64_t renderer::queue_command(const target_command_t &command)
+    {
+        // Append the command and number it.
+        m_commands.push_back(command);
+        return ++m_command_count;
+    }
+
+    void renderer::await_command(uint64_t sequence) noexcept
+    {
+        // The API thread may be blocked submitting a frame, so keep executing frames until it has
+        // applied the command. Stop if the bgfx context is gone.
+        while (m_applied_command_count < sequence)
+        {
+            if (bgfx::renderFrame(LEAF_RENDERER_FRAME_TIMEOUT_MS) == bgfx::RenderFrame::NoContext)
+            {
+                return;
+            }
+        }
+    }
+
+    void renderer::apply_commands(void) noexcept
+    {
+        LEAF_TRACE_ZONE("renderer::apply_commands");
+
+        // Take the queued commands so the lock is not held while they are applied.
+        vector<target_command_t> commands;
+
+        {
+            lock_guard<mutex> lock(m_mutex);
+            commands.swap(m_commands);
+        }
+
+        // Apply each command in the order it was queued.
+        for (const target_command_t &command : commands)
+        {
+            target_t &target = m_views[command.view_id];
+
+            switch (command.type)
+            {
+                // Record the surface. Every target but the primary one draws to a frame buffer
+                // created from its native handle.
+                case target_command_t::attach:
+                    target.is_attached = true;
+                    target.frame_buffer = BGFX_INVALID_HANDLE;
+                    target.native_data = command.native_data;
+                    target.frame_builder = command.frame_builder;
+                    target.resolution = command.resolution;
+
+                    if (command.view_id != 0)
+                    {
+                        create_frame_buffer(command.view_id);
+                    }
+
+                    // Start measuring the target from scratch, since its view may have belonged to
+                    // a detached target.
+                    {
+                        lock_guard<mutex> lock(m_stats_mutex);
+                        m_view_stats[command.view_id] = target_stats_t();
+                    }
+
+                    break;
+
+                // Let the frame builder destroy its resources, then destroy the frame buffer and
+                // unbind the view so it can be reused.
+                case target_command_t::detach:
+                    if (target.frame_builder)
+                    {
+                        target.frame_builder->destroy_resources();
+                    }
+
+                    if (bgfx::isValid(target.frame_buffer))
+                    {
+                        bgfx::destroy(target.frame_buffer);
+                    }
+
+                    bgfx::setViewFrameBuffer(command.view_id, BGFX_INVALID_HANDLE);
+                    bgfx::setViewFrameBuffer(offscreen_view(command.view_id),
+                        BGFX_INVALID_HANDLE);
+                    target.is_attached = false;
+                    target.frame_buffer = BGFX_INVALID_HANDLE;
+                    target.frame_builder = NULL;
+                    break;
+
+                // The primary target resizes the back buffer, every other target recreates its
+                // frame buffer at the new size.
+                case target_command_t::resize:
+                    if (!target.is_attached || target.resolution == command.resolution)
+                    {
+                        break;
+                    }
+
+                    target.resolution = command.resolution;
+
+                    if (command.view_id == 0)
+                    {
+                        bgfx::reset(target.resolution >> 16, target.resolution & 0xFFFF,
+                            BGFX_RESET_VSYNC);
+                    }
+                    else
+                    {
+                        create_frame_buffer(command.view_id);
+                    }
+
+                    break;
+            }
+        }
+
+        // Acknowledge the commands so that threads waiting on them can proceed.
+        m_applied_command_count += commands.size();
+    }
+
+    void renderer::create_frame_buffer(bgfx::ViewId view_id) noexcept
+    {
+        target_t &target = m_views[view_id];
+
+        // Destroy the previous frame buffer if there is one.
+        if (bgfx::isValid(target.frame_buffer))
+        {
+            bgfx::destroy(target.frame_buffer);
+        }
+
+        // Create a frame buffer that presents to the surface's native window and bind the target's
+        // view to it.
+        target.frame_buffer = bgfx::createFrameBuffer(target.native_data.handle,
+            target.resolution >> 16, target.resolution & 0xFFFF);
+        bgfx::setViewFrameBuffer(view_id, target.frame_buffer);
+    }
+
+    void renderer::summarize(const target_stats_t &target_stats, frame_stats_t &stats,
+        vector<uint64_t> &scratch)
+    {
+        // Copy the counters.
+        stats.frame_count = target_stats.frame_count;
+        stats.missed_vsyncs = target_stats.missed_vsyncs;
+        stats.window_size = target_stats.build_ns.size();
+
+        // Sort each kind of measurement and read its percentiles.
+        const utl::sample_window<uint64_t> *windows[] = {&target_stats.build_ns,
+            &target_stats.submit_ns, &target_stats.present_interval_ns};
+        frame_time_summary_t *summaries[] = {&stats.build, &stats.submit, &stats.present_interval};
+
+        for (size_t i = 0; i < 3; i++)
+        {
+            windows[i]->sorted_samples(scratch);
+
+            summaries[i]->p50_ns = utl::sample_window<uint64_t>::percentile(scratch, 50.0);
+            summaries[i]->p95_ns = utl::sample_window<uint64_t>::percentile(scratch, 95.0);
+            summaries[i]->p99_ns = utl::sample_window<uint64_t>::percentile(scratch, 99.0);
+            summaries[i]->max_ns = scratch.empty() ? 0 : scratch.back();
+        }
+    }
+
+    void renderer::record_frame_stats(uint64_t submit_ns, uint64_t present_interval_ns) noexcept
+    {
+        // Count the refreshes that passed without a new frame. An interval is only late once it
+        // exceeds one and a half refreshes, so jitter around a single refresh is not counted.
+        uint64_t refresh_period_ns = m_refresh_period_ns;
+        uint64_t missed_vsyncs = 0;
+
+        if (refresh_period_ns && present_interval_ns > refresh_period_ns + refresh_period_ns / 2)
+        {
+            missed_vsyncs = (present_interval_ns + refresh_period_ns / 2) / refresh_period_ns - 1;
+        }
+
+        lock_guard<mutex> lock(m_stats_mutex);
+
+        // Record the measurements of every target drawn in the frame. The submit time and
+        // present interval are shared by every target since they are submitted together.
+        for (size_t i = 0; i < m_views.size(); i++)
+        {
+            if (!m_views[i].is_attached)
+            {
+                continue;
+            }
+
+            target_stats_t &target_stats = m_view_stats[i];
+            target_stats.frame_count++;
+            target_stats.missed_vsyncs += missed_vsyncs;
+            target_stats.build_ns.push(m_build_times_ns[i]);
+            target_stats.submit_ns.push(submit_ns);
+
+            // The first frame has no previous frame to measure the interval from.
+            if (present_interval_ns)
+            {
+                target_stats.present_interval_ns.push(present_interval_ns);
+            }
+        }
+    }
+
+    void renderer::draw_overlay(void) noexcept
+    {
+        // Refresh the statistics periodically. The API thread is the only writer, so it can read
+        // the measurements without holding the lock.
+        if (m_frame_count % LEAF_RENDERER_OVERLAY_REFRESH_FRAMES == 0 || m_overlay_stats.empty())
+        {
+            m_overlay_stats.clear();
+
+            for (size_t i = 0; i < m_views.size(); i++)
+            {
+                if (m_views[i].is_attached)
+                {
+                    frame_stats_t stats;
+                    summarize(m_view_stats[i], stats, m_overlay_scratch);
+                    m_overlay_stats.push_back({(bgfx::ViewId)i, stats});
+                }
+            }
+        }
+
+        // Print a header and one line per target. Debug text is only drawn on the back buffer,
+        // so every target is listed on the primary surface.
+        bgfx::dbgTextClear();
+        bgfx::dbgTextPrintf(0, 0, 0x0f, "frame times (ms)  p50/p95/p99");
+
+        uint16_t row = 1;
+
+        for (const pair<bgfx::ViewId, frame_stats_t> &entry : m_overlay_stats)
+        {
+            const frame_stats_t &stats = entry.second;
+
+            bgfx::dbgTextPrintf(0, row++, 0x0f, "view %-3u build %6.2f/%6.2f/%6.2f  "
+                "submit %6.2f/%6.2f/%6.2f  interval %6.2f/%6.2f/%6.2f  missed %llu",
+                (unsigned int)entry.first, to_ms(stats.build.p50_ns), to_ms(stats.build.p95_ns),
+                to_ms(stats.build.p99_ns), to_ms(stats.submit.p50_ns),
+                to_ms(stats.submit.p95_ns), to_ms(stats.submit.p99_ns),
+                to_ms(stats.present_interval.p50_ns), to_ms(stats.present_interval.p95_ns),
+                to_ms(stats.present_interval.p99_ns), (unsigned long long)stats.missed_vsyncs);
+        }
+    }
+
+    void renderer::run_api_thread(void) noexcept
+    {
+        // Describe the primary surface to bgfx using its native data and resolution.
+        bgfx::Init init;
+        init.platformData.ndt = m_native_data.display_type;
+        init.platformData.nwh = m_native_data.handle;
+        init.resolution.width = m_resolution >> 16;
+        init.resolution.height = m_resolution & 0xFFFF;
+        init.resolution.reset = BGFX_RESET_VSYNC;
+
+        // Initialize bgfx on this thread, which makes it the API thread. Report the outcome to the
+        // thread waiting in the constructor.
+        if (!bgfx::init(init))
+        {
+            m_init_failed = true;
+            return;
+        }
+
+        m_is_initialized = true;
+        utl::trace::set_thread_name("leaf renderer API");
+
+        // Execute the offscreen view of each target right before the view of the target, so that
+        // whatever is drawn offscreen can be shown in the same frame.
+        bgfx::ViewId view_order[LEAF_RENDERER_MAX_TARGETS * 2];
+
+        for (uint32_t i = 0; i < LEAF_RENDERER_MAX_TARGETS; i++)
+        {
+            view_order[i * 2] = offscreen_view((bgfx::ViewId)i);
+            view_order[i * 2 + 1] = (bgfx::ViewId)i;
+        }
+
+        bgfx::setViewOrder(0, LEAF_RENDERER_MAX_TARGETS * 2, view_order);
+
+        // Remember whether bgfx debug text is enabled and when the previous frame was submitted.
+        bool is_debug_text_enabled = false;
+        uint64_t last_submit_end_ns = 0;
+
+        // Build and submit frames until the renderer is stopped.
+        while (m_is_running)
+        {
+            LEAF_TRACE_ZONE("renderer::frame");
+
+            // Apply attachments, detachments, and resizes before building the frame.
+            apply_commands();
+
+            // Read the clear color once so every surface in the frame uses the same one.
+            uint32_t clear_color = m_clear_color;
+
+            // Build every attached surface into the same frame using its own view.
+            for (size_t i = 0; i < m_views.size(); i++)
+            {
+                const target_t &target = m_views[i];
+
+                if (!target.is_attached)
+                {
+                    continue;
+                }
+
+                LEAF_TRACE_ZONE("renderer::build_target");
+
+                uint64_t build_start_ns = now_ns();
+                bgfx::ViewId view_id = (bgfx::ViewId)i;
+                bounds2_t bounds = {
+                    (px_t)(target.resolution >> 16),
+                    (px_t)(target.resolution & 0xFFFF)
+                };
+
+                // Size the view to the surface and clear it. Touching the view ensures it is
+                // cleared even if the frame builder submits nothing.
+                bgfx::setViewClear(view_id, BGFX_CLEAR_COLOR | BGFX_CLEAR_DEPTH, clear_color, 1.0f,
+                    0);
+                bgfx::setViewRect(view_id, 0, 0, bounds.width, bounds.height);
+                bgfx::touch(view_id);
+
+                // Let the frame builder submit its draw calls.
+                if (target.frame_builder)
+                {
+                    target.frame_builder->build_frame(view_id, offscreen_view(view_id), bounds);
+                }
+
+                m_build_times_ns[i] = now_ns() - build_start_ns;
+            }
+
+            // Enable or disable debug text when the overlay is shown or hidden, and print the
+            // overlay if it is shown.
+            bool is_overlay_visible = m_is_overlay_visible;
+
+            if (is_overlay_visible != is_debug_text_enabled)
+            {
+                bgfx::setDebug(is_overlay_visible ? BGFX_DEBUG_TEXT : BGFX_DEBUG_NONE);
+                is_debug_text_enabled = is_overlay_visible;
+            }
+
+            if (is_overlay_visible)
+            {
+                draw_overlay();
+            }
+
+            // Submit every surface with a single frame. This blocks until the render thread has
+            // finished executing the previous frame.
+            uint64_t submit_start_ns = now_ns();
+            {
+                LEAF_TRACE_ZONE("bgfx::frame");
+                bgfx::frame();
+            }
+            uint64_t submit_end_ns = now_ns();
+            m_frame_count++;
+
+            // Record how long the frame took to submit and how long it has been since the
+            // previous one.
+            record_frame_stats(submit_end_ns - submit_start_ns,
+                last_submit_end_ns ? submit_end_ns - last_submit_end_ns : 0);
+            last_submit_end_ns = submit_end_ns;
+        }
+
+        // Let every frame builder destroy its resources and destroy every frame buffer before
+        // shutting bgfx down. The render thread keeps executing frames until the context is gone.
+        for (target_t &target : m_views)
+        {
+            if (target.is_attached && target.frame_builder)
+            {
+                target.frame_builder->destroy_resources();
+            }
+
+            if (target.is_attached && bgfx::isValid(target.frame_buffer))
+            {
+                bgfx::destroy(target.frame_buffer);
+            }
+        }
+
+        bgfx::shutdown();
+    }
+
+    renderer::renderer(native_surface_i *surface, frame_builder_i *frame_builder)
+        // Start with the default clear color. The API thread is not running yet and no views are
+        // in use.
+        : m_clear_color(LEAF_RENDERER_DEFAULT_CLEAR_COLOR), m_is_running(true),
+        m_is_initialized(false), m_init_failed(false), m_frame_count(0), m_next_view_id(0),
+        m_command_count(0), m_applied_command_count(0), m_views(LEAF_RENDERER_MAX_TARGETS),
+        m_view_stats(LEAF_RENDERER_MAX_TARGETS), m_build_times_ns(LEAF_RENDERER_MAX_TARGETS, 0),
+        m_refresh_period_ns(1000000000 / LEAF_RENDERER_DEFAULT_REFRESH_RATE),
+        m_is_overlay_visible(false)
+    {
+        // Ensure no other renderer is using the global bgfx context.
+        if (f_active)
+        {
+            throw runtime_error("Failed to create renderer. (Another renderer is active)");
+        }
+
+        // Read the native data and size of the primary surface on the creating thread.
+        m_native_data = surface->native_data();
+        m_resolution = pack_resolution(surface->bounds());
+
+        // Ensure the surface has a native handle for bgfx to render to.
+        if (!m_native_data.handle)
+        {
+            throw runtime_error("Failed to create renderer. (The surface has no native handle)");
+        }
+
+        // Attach the primary surface with view 0 so that it draws to the back buffer. The command
+        // is applied before the first frame.
+        m_primary = m_targets.insert((bgfx::ViewId)m_next_view_id++);
+        queue_command({target_command_t::attach, 0, m_native_data, frame_builder, m_resolution});
+
+        // Calling renderFrame before bgfx is initialized marks the calling thread as the render
+        // thread, so bgfx will not create one of its own.
+        bgfx::renderFrame();
+
+        // Start the API thread.
+        m_api_thread = thread(&renderer::run_api_thread, this);
+
+        // Initialization requires the render thread to execute the commands the API thread
+        // submits, so keep rendering until the API thread reports the outcome.
+        while (!m_is_initialized && !m_init_failed)
+        {
+            bgfx::renderFrame(LEAF_RENDERER_FRAME_TIMEOUT_MS);
+        }
+
+        // If initialization failed, the API thread has already exited.
+        if (m_init_failed)
+        {
+            m_api_thread.join();
+            throw runtime_error("Failed to create renderer. (bgfx could not be initialized)");
+        }
+
+        // Mark the renderer as the active one.
+        f_active = this;
+    }
+
+    renderer::~renderer() noexcept
+    {
+        // The renderer is no longer active.
+        if (f_active == this)
+        {
+            f_active = NULL;
+        }
+
+        // Instruct the API thread to stop building frames.
+        m_is_running = false;
+
+        // The API thread may be blocked submitting a frame, and shutting bgfx down requires the
+        // render thread as well. Keep rendering until the context is destroyed.
+        while (bgfx::renderFrame() != bgfx::RenderFrame::NoContext) {}
+
+        // Wait for the API thread to exit.
+        m_api_thread.join();
+    }
+
+    bool renderer::is_active(void) noexcept
+    {
+        // A renderer is active if the pointer is not null.
+        return f_active != NULL;
+    }
+
+    bool renderer::render_frame(int32_t timeout_ms) noexcept
+    {
+        // If no renderer is active, there is nothing to render.
+        if (!f_active)
+        {
+            return false;
+        }
+
+        // Execute the next submitted frame if one arrives within the timeout.
+        LEAF_TRACE_ZONE("bgfx::renderFrame");
+
+        return bgfx::renderFrame(timeout_ms) == bgfx::RenderFrame::Render;
+    }
+
+    utl::slot_handle_t renderer::primary(void) const noexcept
+    {
+        // Return the handle of the primary render target.
+        return m_primary;
+    }
+
+    utl::slot_handle_t renderer::attach(native_surface_i *surface, frame_builder_i *frame_builder)
+    {
+        // Read the native data and size of the surface on the calling thread.
+        native_surface_data_t native_data = surface->native_data();
+        uint32_t resolution = pack_resolution(surface->bounds());
+
+        // Ensure the surface has a native handle for bgfx to render to.
+        if (!native_data.handle)
+        {
+            throw runtime_error("Failed to attach surface to renderer. (The surface has no native "
+                "handle)");
+        }
+
+        lock_guard<mutex> lock(m_mutex);
+
+        // Take a released view if there is one, otherwise use a new one.
+        bgfx::ViewId view_id;
+
+        if (!m_free_view_ids.empty())
+        {
+            view_id = m_free_view_ids.back();
+            m_free_view_ids.pop_back();
+        }
+        else if (m_next_view_id < LEAF_RENDERER_MAX_TARGETS)
+        {
+            view_id = (bgfx::ViewId)m_next_view_id++;
+        }
+        else
+        {
+            throw runtime_error("Failed to attach surface to renderer. (Every view is in use)");
+        }
+
+        // Register the target and queue its attachment for the API thread.
+        queue_command({target_command_t::attach, view_id, native_data, frame_builder, resolution});
+        return m_targets.insert(view_id);
+    }
+
+    bool renderer::detach(const utl::slot_handle_t &target) noexcept
+    {
+        // The primary target draws to the back buffer and cannot be detached.
+        if (target == m_primary)
+        {
+            return false;
+        }
+
+        uint64_t sequence;
+
+        {
+            lock_guard<mutex> lock(m_mutex);
+
+            // Ensure the handle refers to an attached target.
+            const bgfx::ViewId *view_id = m_targets.get(target);
+
+            if (!view_id)
+            {
+                return false;
+            }
+
+            // Queue the detachment and release the view. The view is not reused before the
+            // detachment is applied since commands are applied in order.
+            sequence = queue_command({target_command_t::detach, *view_id, {NULL, NULL}, NULL, 0});
+            m_free_view_ids.push_back(*view_id);
+            m_targets.erase(target);
+        }
+
+        // Wait for the API thread to destroy the frame buffer so the surface can be destroyed.
+        await_command(sequence);
+
+        // Return true indicating that the target was detached.
+        return true;
+    }
+
+    bool renderer::resize(const utl::slot_handle_t &target, const bounds2_t &bounds) noexcept
+    {
+        lock_guard<mutex> lock(m_mutex);
+
+        // Ensure the handle refers to an attached target.
+        const bgfx::ViewId *view_id = m_targets.get(target);
+
+        if (!view_id)
+        {
+            return false;
+        }
+
+        // Queue the resize for the API thread.
+        queue_command({target_command_t::resize, *view_id, {NULL, NULL}, NULL,
+            pack_resolution(bounds)});
+
+        // Return true indicating that the resize was requested.
+        return true;
+    }
+
+    size_t renderer::target_count(void) noexcept
+    {
+        lock_guard<mutex> lock(m_mutex);
+
+        // Return the number of registered targets.
+        return m_targets.size();
+    }
+
+    uint32_t renderer::clear_color(void) const noexcept
+    {
+        // Return the clear color.
+        return m_clear_color;
+    }
+
+    renderer *renderer::set_clear_color(uint32_t clear_color) noexcept
+    {
+        // Publish the new clear color for the API thread to apply.
+        m_clear_color = clear_color;
+
+        // Return a pointer to the renderer for chaining.
+        return this;
+    }
+
+    uint64_t renderer::frame_count(void) const noexcept
+    {
+        // Return the number of submitted frames.
+        return m_frame_count;
+    }
+
+    bool renderer::frame_stats(const utl::slot_handle_t &target, frame_stats_t &stats)
+    {
+        // Find the view of the target. The lock is held until the statistics are copied so the
+        // view cannot be handed to another target meanwhile.
+        lock_guard<mutex> lock(m_mutex);
+        const bgfx::ViewId *view_id = m_targets.get(target);
+
+        if (!view_id)
+        {
+            return false;
+        }
+
+        // Summarize the measurements of the target while the API thread cannot change them.
+        vector<uint64_t> scratch;
+        lock_guard<mutex> stats_lock(m_stats_mutex);
+        summarize(m_view_stats[*view_id], stats, scratch);
+
+        // Return true indicating that the statistics were read.
+        return true;
+    }
+
+    uint32_t renderer::refresh_rate(void) const noexcept
+    {
+        // Convert the refresh period back to a rate. A period of 0 means no rate is set.
+        uint64_t refresh_period_ns = m_refresh_period_ns;
+        return refresh_period_ns ? (uint32_t)((1000000000 + refresh_period_ns / 2)
+            / refresh_period_ns) : 0;
+    }
+
+    renderer *renderer::set_refresh_rate(uint32_t refresh_rate) noexcept
+    {
+        // Publish the duration of one refresh for the API thread to count missed vsyncs with.
+        m_refresh_period_ns = refresh_rate ? 1000000000 / refresh_rate : 0;
+
+        // Return a pointer to the renderer for chaining.
+        return this;
+    }
+
+    bool renderer::is_overlay_visible(void) const noexcept
+    {
+        // Return whether the overlay is drawn.
+        return m_is_overlay_visible;
+    }
+
+    renderer *renderer::set_overlay_visible(bool is_overlay_visible) noexcept
+    {
+        // Publish the visibility for the API thread to apply with the next frame.
+        m_is_overlay_visible = is_overlay_visible;
+
+        // Return a pointer to the renderer for chaining.
+        return this;
+    }
+}
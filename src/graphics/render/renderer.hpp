@@ -0,0 +1,583 @@
+///
+/// @file       renderer.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a class that renders native surfaces with bgfx. Frames are built and
+///             submitted on a dedicated API thread while the thread that created the renderer
+///             executes them, so a frame that takes long to build never stalls window events.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_RENDERER_HEADER_GUARD
+#define LEAF_SRC_RENDERER_HEADER_GUARD
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../../utils/unique.hpp"
+#include "../../utils/slot_map.hpp"
+#include "../../utils/sample_window.hpp"
+#include "../surface/native_surface_i.hpp"
+#include "frame_builder_i.hpp"
+#include "frame_stats.hpp"
+
+///
+/// @brief  The default color surfaces are cleared to before each frame in RGBA format.
+///
+#define LEAF_RENDERER_DEFAULT_CLEAR_COLOR 0x303030ff
+
+///
+/// @brief  The longest time in milliseconds the event loop blocks waiting for the API thread to
+///         submit a frame before it returns to handling window events.
+///
+#define LEAF_RENDERER_FRAME_TIMEOUT_MS 16
+
+///
+/// @brief  The maximum number of surfaces a renderer can draw to at once. Each surface uses its own
+///         bgfx view and an offscreen view, so twice this must not exceed the number of views bgfx
+///         was built with.
+///
+#define LEAF_RENDERER_MAX_TARGETS 128
+
+///
+/// @brief  The number of most recent frames the frame statistics of each render target cover.
+///
+#define LEAF_RENDERER_FRAME_STATS_WINDOW 120
+
+///
+/// @brief  The refresh rate in hertz of the display frames are assumed to be presented to until
+///         another is set. It is used to count missed vsyncs.
+///
+#define LEAF_RENDERER_DEFAULT_REFRESH_RATE 60
+
+///
+/// @brief  The number of frames between updates of the statistics shown by the overlay, so that
+///         the numbers stay readable and are not recomputed every frame.
+///
+#define LEAF_RENDERER_OVERLAY_REFRESH_FRAMES 30
+
+namespace leaf
+{
+    ///
+    /// @brief  Renders native surfaces with bgfx. The renderer owns a dedicated API thread that
+    ///         builds and submits frames. The thread that constructs the renderer becomes the bgfx
+    ///         render thread and must keep executing submitted frames by calling render_frame,
+    ///         which the window manager's event loop does once render_frame is set as its frame
+    ///         hook. Only one renderer can be active at a time since bgfx has a single global
+    ///         context.
+    ///
+    ///         Every attached surface is a render target with its own bgfx view. The primary
+    ///         surface given on construction draws to the back buffer, every other surface draws
+    ///         to a frame buffer created from its native handle. All targets are submitted
+    ///         together with a single frame per tick. Each target also has an offscreen view that
+    ///         bgfx executes right before the target's view, which its frame builder can bind to a
+    ///         frame buffer of its own to keep drawing across frames.
+    ///
+    ///         The renderer measures how long each target takes to build, how long each frame
+    ///         takes to submit, and how often frames are presented. The statistics of each target
+    ///         can be queried from any thread and shown on the primary surface as an overlay.
+    ///
+    class renderer : public utl::unique
+    {
+        private:
+            ///
+            /// @brief  Represents a change to the set of render targets requested by any thread and
+            ///         applied by the API thread before it builds its next frame.
+            ///
+            typedef struct target_command
+            {
+                ///
+                /// @brief  Identifies the kind of change.
+                ///
+                enum type
+                {
+                    attach,
+                    detach,
+                    resize
+                } type;
+
+                ///
+                /// @brief  The view of the render target the change applies to.
+                ///
+                bgfx::ViewId view_id;
+
+                ///
+                /// @brief  The native data of the surface if attaching.
+                ///
+                native_surface_data_t native_data;
+
+                ///
+                /// @brief  The frame builder of the surface if attaching.
+                ///
+                frame_builder_i *frame_builder;
+
+                ///
+                /// @brief  The packed resolution of the surface if attaching or resizing.
+                ///
+                uint32_t resolution;
+
+            } target_command_t;
+
+            ///
+            /// @brief  Represents a render target as seen by the API thread, indexed by view.
+            ///
+            typedef struct target
+            {
+                ///
+                /// @brief  Denotes whether the view is in use.
+                ///
+                bool is_attached;
+
+                ///
+                /// @brief  The frame buffer created from the surface's native handle or an invalid
+                ///         handle if the target draws to the back buffer.
+                ///
+                bgfx::FrameBufferHandle frame_buffer;
+
+                ///
+                /// @brief  The native data of the surface, kept to recreate the frame buffer on
+                ///         resize.
+                ///
+                native_surface_data_t native_data;
+
+                ///
+                /// @brief  The frame builder of the surface or null if it should only be cleared.
+                ///
+                frame_builder_i *frame_builder;
+
+                ///
+                /// @brief  The packed resolution of the surface.
+                ///
+                uint32_t resolution;
+
+            } target_t;
+
+            ///
+            /// @brief  Represents the frame time measurements of a render target, indexed by view.
+            ///
+            typedef struct target_stats
+            {
+                ///
+                /// @brief  The number of frames the target has been drawn in since it was
+                ///         attached.
+                ///
+                uint64_t frame_count;
+
+                ///
+                /// @brief  The number of display refreshes missed since the target was attached.
+                ///
+                uint64_t missed_vsyncs;
+
+                ///
+                /// @brief  The most recent build times in nanoseconds.
+                ///
+                utl::sample_window<uint64_t> build_ns;
+
+                ///
+                /// @brief  The most recent submit times in nanoseconds.
+                ///
+                utl::sample_window<uint64_t> submit_ns;
+
+                ///
+                /// @brief  The most recent present intervals in nanoseconds.
+                ///
+                utl::sample_window<uint64_t> present_interval_ns;
+
+                ///
+                /// @brief  Creates empty measurements covering the configured number of frames.
+                ///
+                target_stats(void) noexcept
+                    : frame_count(0), missed_vsyncs(0), build_ns(LEAF_RENDERER_FRAME_STATS_WINDOW),
+                    submit_ns(LEAF_RENDERER_FRAME_STATS_WINDOW),
+                    present_interval_ns(LEAF_RENDERER_FRAME_STATS_WINDOW) {}
+
+            } target_stats_t;
+
+            ///
+            /// @brief  The active renderer or null if there is none.
+            ///
+            static renderer *f_active;
+
+            ///
+            /// @brief  The native data of the primary surface, read when the renderer was created.
+            ///
+            native_surface_data_t m_native_data;
+
+            ///
+            /// @brief  The packed resolution of the primary surface when the renderer was created.
+            ///
+            uint32_t m_resolution;
+
+            ///
+            /// @brief  The color surfaces are cleared to before each frame in RGBA format.
+            ///
+            std::atomic<uint32_t> m_clear_color;
+
+            ///
+            /// @brief  Denotes whether the API thread should keep building frames.
+            ///
+            std::atomic<bool> m_is_running;
+
+            ///
+            /// @brief  Denotes whether the API thread finished initializing bgfx successfully.
+            ///
+            std::atomic<bool> m_is_initialized;
+
+            ///
+            /// @brief  Denotes whether the API thread failed to initialize bgfx.
+            ///
+            std::atomic<bool> m_init_failed;
+
+            ///
+            /// @brief  The number of frames the API thread has submitted.
+            ///
+            std::atomic<uint64_t> m_frame_count;
+
+            ///
+            /// @brief  Guards the target registry, the free view list, and the command queue.
+            ///
+            std::mutex m_mutex;
+
+            ///
+            /// @brief  The view of each attached render target, addressed by handle.
+            ///
+            utl::slot_map<bgfx::ViewId> m_targets;
+
+            ///
+            /// @brief  The views that were released by detached targets.
+            ///
+            std::vector<bgfx::ViewId> m_free_view_ids;
+
+            ///
+            /// @brief  The lowest view that has never been used.
+            ///
+            uint32_t m_next_view_id;
+
+            ///
+            /// @brief  The changes to the render targets that the API thread has not yet applied.
+            ///
+            std::vector<target_command_t> m_commands;
+
+            ///
+            /// @brief  The number of commands that have been queued.
+            ///
+            uint64_t m_command_count;
+
+            ///
+            /// @brief  The number of queued commands the API thread has applied.
+            ///
+            std::atomic<uint64_t> m_applied_command_count;
+
+            ///
+            /// @brief  The render targets indexed by view. Only the API thread accesses this.
+            ///
+            std::vector<target_t> m_views;
+
+            ///
+            /// @brief  Guards the frame time measurements.
+            ///
+            mutable std::mutex m_stats_mutex;
+
+            ///
+            /// @brief  The frame time measurements of the render targets indexed by view. Only the
+            ///         API thread writes them.
+            ///
+            std::vector<target_stats_t> m_view_stats;
+
+            ///
+            /// @brief  The build time in nanoseconds of each render target in the frame being
+            ///         built, indexed by view. Only the API thread accesses this.
+            ///
+            std::vector<uint64_t> m_build_times_ns;
+
+            ///
+            /// @brief  The duration of one display refresh in nanoseconds, or 0 if missed vsyncs
+            ///         are not counted.
+            ///
+            std::atomic<uint64_t> m_refresh_period_ns;
+
+            ///
+            /// @brief  Denotes whether the frame statistics overlay is drawn on the primary
+            ///         surface.
+            ///
+            std::atomic<bool> m_is_overlay_visible;
+
+            ///
+            /// @brief  The statistics shown by the overlay and the views they belong to, updated
+            ///         periodically. Only the API thread accesses this.
+            ///
+            std::vector<std::pair<bgfx::ViewId, frame_stats_t>> m_overlay_stats;
+
+            ///
+            /// @brief  A vector reused to sort measurements for the overlay. Only the API thread
+            ///         accesses this.
+            ///
+            std::vector<uint64_t> m_overlay_scratch;
+
+            ///
+            /// @brief  The handle of the primary surface's render target.
+            ///
+            utl::slot_handle_t m_primary;
+
+            ///
+            /// @brief  The API thread.
+            ///
+            std::thread m_api_thread;
+
+            ///
+            /// @brief  Packs a width and height into a single resolution value.
+            ///
+            /// @param  bounds  the bounds to pack
+            ///
+            /// @return the packed resolution
+            ///
+            static inline uint32_t pack_resolution(const bounds2_t &bounds) noexcept
+            {
+                // Store the width in the upper half and the height in the lower half.
+                return ((uint32_t)(uint16_t)bounds.width << 16) | (uint16_t)bounds.height;
+            }
+
+            ///
+            /// @brief  Queues a command for the API thread. The caller must hold the mutex.
+            ///
+            /// @param  command     the command to queue
+            ///
+            /// @return the sequence number of the command
+            ///
+            uint64_t queue_command(const target_command_t &command);
+
+            ///
+            /// @brief  Executes frames on the calling thread until the API thread has applied the
+            ///         command with the given sequence number or has stopped.
+            ///
+            /// @param  sequence    the sequence number of the command
+            ///
+            void await_command(uint64_t sequence) noexcept;
+
+            ///
+            /// @brief  Applies the queued commands on the API thread.
+            ///
+            void apply_commands(void) noexcept;
+
+            ///
+            /// @brief  (Re)creates the frame buffer of a render target that does not draw to the
+            ///         back buffer, bound to the target's view. Runs on the API thread.
+            ///
+            /// @param  view_id     the view of the render target
+            ///
+            void create_frame_buffer(bgfx::ViewId view_id) noexcept;
+
+            ///
+            /// @brief  Summarizes the frame time measurements of a render target.
+            ///
+            /// @param  target_stats    the measurements to summarize
+            /// @param  stats           set to the summary
+            /// @param  scratch         a vector that is reused to sort the measurements
+            ///
+            static void summarize(const target_stats_t &target_stats, frame_stats_t &stats,
+                std::vector<uint64_t> &scratch);
+
+            ///
+            /// @brief  Records the frame time measurements of every target drawn in the frame that
+            ///         was just submitted. Runs on the API thread.
+            ///
+            /// @param  submit_ns           the time the frame took to submit in nanoseconds
+            /// @param  present_interval_ns the time since the previous frame was submitted in
+            ///                             nanoseconds, or 0 if this is the first frame
+            ///
+            void record_frame_stats(uint64_t submit_ns, uint64_t present_interval_ns) noexcept;
+
+            ///
+            /// @brief  Prints the frame statistics of every render target with bgfx debug text.
+            ///         The statistics are updated every LEAF_RENDERER_OVERLAY_REFRESH_FRAMES
+            ///         frames. Runs on the API thread.
+            ///
+            void draw_overlay(void) noexcept;
+
+            ///
+            /// @brief  The entry point of the API thread. It initializes bgfx, builds and submits
+            ///         frames until the renderer is stopped, then shuts bgfx down.
+            ///
+            void run_api_thread(void) noexcept;
+
+        public:
+            ///
+            /// @brief  Creates a renderer for a primary native surface and starts its API thread.
+            ///         The calling thread becomes the bgfx render thread. It blocks until bgfx is
+            ///         initialized.
+            ///
+            /// @param  surface         a pointer to the primary native surface
+            /// @param  frame_builder   a pointer to the frame builder that submits draw calls to
+            ///                         the primary surface each frame or null if it should only be
+            ///                         cleared
+            ///
+            /// @throw  runtime_error if another renderer is active, if the surface has no native
+            ///         handle, or if bgfx could not be initialized
+            ///
+            renderer(native_surface_i *surface, frame_builder_i *frame_builder = NULL);
+
+            ///
+            /// @brief  Stops the API thread, destroys every frame buffer, and shuts bgfx down. The
+            ///         calling thread must be the thread that created the renderer.
+            ///
+            ~renderer() noexcept;
+
+            ///
+            /// @brief  Determines whether a renderer is active.
+            ///
+            /// @return true if and only if a renderer is active
+            ///
+            static bool is_active(void) noexcept;
+
+            ///
+            /// @brief      Executes the next frame submitted by the API thread of the active
+            ///             renderer, waiting for it up to the given timeout. If no renderer is
+            ///             active, nothing happens.
+            ///
+            /// @param      timeout_ms  the longest time in milliseconds to wait for a frame
+            ///
+            /// @return     true if and only if a frame was executed
+            ///
+            /// @warning    This must only be called from the thread that created the renderer.
+            ///
+            static bool render_frame(int32_t timeout_ms) noexcept;
+
+            ///
+            /// @brief  Returns the handle of the primary surface's render target. The primary
+            ///         target draws to the back buffer and cannot be detached.
+            ///
+            /// @return the handle of the primary render target
+            ///
+            utl::slot_handle_t primary(void) const noexcept;
+
+            ///
+            /// @brief  Attaches another native surface to the renderer. It is drawn to through a
+            ///         frame buffer created from its native handle with its own view, starting with
+            ///         the next frame. This is safe to call from any thread.
+            ///
+            /// @param  surface         a pointer to the native surface
+            /// @param  frame_builder   a pointer to the frame builder that submits draw calls to
+            ///                         the surface each frame or null if it should only be cleared
+            ///
+            /// @return the handle of the surface's render target
+            ///
+            /// @throw  runtime_error if the surface has no native handle or every view is in use
+            ///
+            utl::slot_handle_t attach(native_surface_i *surface,
+                frame_builder_i *frame_builder = NULL);
+
+            ///
+            /// @brief      Detaches a surface from the renderer. This blocks until the API thread
+            ///             has destroyed the surface's frame buffer, so the surface and its frame
+            ///             builder can be destroyed as soon as it returns.
+            ///
+            /// @param      target  the handle of the surface's render target
+            ///
+            /// @return     true if and only if the handle referred to an attached target other
+            ///             than the primary target
+            ///
+            /// @warning    This must only be called from the thread that created the renderer.
+            ///
+            bool detach(const utl::slot_handle_t &target) noexcept;
+
+            ///
+            /// @brief  Requests that a render target be resized. The API thread applies the change
+            ///         before it builds its next frame. This is safe to call from any thread.
+            ///
+            /// @param  target  the handle of the surface's render target
+            /// @param  bounds  the new bounds of the surface in pixels
+            ///
+            /// @return true if and only if the handle referred to an attached target
+            ///
+            bool resize(const utl::slot_handle_t &target, const bounds2_t &bounds) noexcept;
+
+            ///
+            /// @brief  Determines the number of attached render targets including the primary
+            ///         target.
+            ///
+            /// @return the number of render targets
+            ///
+            size_t target_count(void) noexcept;
+
+            ///
+            /// @brief  Determines the color surfaces are cleared to before each frame.
+            ///
+            /// @return the clear color in RGBA format
+            ///
+            uint32_t clear_color(void) const noexcept;
+
+            ///
+            /// @brief  Sets the color surfaces are cleared to before each frame. This is safe to
+            ///         call from any thread.
+            ///
+            /// @param  clear_color     the clear color in RGBA format
+            ///
+            /// @return a pointer to the renderer for chaining
+            ///
+            renderer *set_clear_color(uint32_t clear_color) noexcept;
+
+            ///
+            /// @brief  Determines the number of frames the API thread has submitted. Each frame
+            ///         includes every attached surface.
+            ///
+            /// @return the number of frames
+            ///
+            uint64_t frame_count(void) const noexcept;
+
+            ///
+            /// @brief  Summarizes how long the renderer takes to produce the frames of a render
+            ///         target over its most recent frames. This is safe to call from any thread.
+            ///
+            /// @param  target  the handle of the surface's render target
+            /// @param  stats   set to the statistics of the target if the handle is valid
+            ///
+            /// @return true if and only if the handle referred to an attached target
+            ///
+            bool frame_stats(const utl::slot_handle_t &target, frame_stats_t &stats);
+
+            ///
+            /// @brief  Determines the refresh rate of the display frames are assumed to be
+            ///         presented to.
+            ///
+            /// @return the refresh rate in hertz or 0 if missed vsyncs are not counted
+            ///
+            uint32_t refresh_rate(void) const noexcept;
+
+            ///
+            /// @brief  Sets the refresh rate of the display frames are assumed to be presented to.
+            ///         A frame interval longer than one and a half refreshes counts the refreshes
+            ///         without a new frame as missed vsyncs. This is safe to call from any thread.
+            ///
+            /// @param  refresh_rate    the refresh rate in hertz or 0 to stop counting missed
+            ///                         vsyncs
+            ///
+            /// @return a pointer to the renderer for chaining
+            ///
+            renderer *set_refresh_rate(uint32_t refresh_rate) noexcept;
+
+            ///
+            /// @brief  Determines whether the frame statistics overlay is drawn.
+            ///
+            /// @return true if and only if the overlay is visible
+            ///
+            bool is_overlay_visible(void) const noexcept;
+
+            ///
+            /// @brief  Shows or hides an overlay that prints the frame statistics of every render
+            ///         target on the primary surface with bgfx debug text. This is safe to call
+            ///         from any thread.
+            ///
+            /// @param  is_overlay_visible  whether the overlay is drawn
+            ///
+            /// @return a pointer to the renderer for chaining
+            ///
+            renderer *set_overlay_visible(bool is_overlay_visible) noexcept;
+    };
+}
+
+#endif
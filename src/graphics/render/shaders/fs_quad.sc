@@ -0,0 +1,53 @@
+$input v_color0, v_texcoord0, v_local, v_shape
+
+///
+/// @file       fs_quad.sc
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Fragment shader for the quads of the quad batcher. Rounded corners and borders are
+///             drawn from the distance of each pixel to the edge of the shape, so they are smooth
+///             without extra geometry. Glyphs are read from a single-channel atlas as coverage
+///             or as a signed distance field.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <bgfx_shader.sh>
+
+SAMPLER2D(s_texColor, 0);
+
+void main()
+{
+    // Find the signed distance from the pixel to the edge of the rounded rectangle. The shape
+    // holds half its width and height, the radius of its corners, and the width of its border.
+    float radius = v_shape.z;
+    vec2 corner = abs(v_local.xy) - v_shape.xy + radius;
+    float edge_distance = length(max(corner, 0.0)) + min(max(corner.x, corner.y), 0.0) - radius;
+
+    // Cover the pixel by how much of it is inside the edge, and leave out the inside of a border.
+    float coverage = clamp(0.5 - edge_distance, 0.0, 1.0);
+
+    if (v_shape.w > 0.0)
+    {
+        coverage *= clamp(0.5 + edge_distance + v_shape.w, 0.0, 1.0);
+    }
+
+    // Glyphs keep their coverage or their distance field in the only channel of their texture.
+    // The field is 0.5 on the edge, so the pixel is covered by how far inside the edge it is,
+    // measured in pixels on the screen whatever the scale of the glyph.
+    vec4 texel = texture2D(s_texColor, v_texcoord0);
+
+    if (v_local.z > 1.5)
+    {
+        float field_step = max(fwidth(texel.r), 0.0001);
+        texel = vec4(1.0, 1.0, 1.0, clamp((texel.r - 0.5) / field_step + 0.5, 0.0, 1.0));
+    }
+    else if (v_local.z > 0.5)
+    {
+        texel = vec4(1.0, 1.0, 1.0, texel.r);
+    }
+
+    vec4 color = texel * v_color0;
+    gl_FragColor = vec4(color.rgb, color.a * coverage);
+}
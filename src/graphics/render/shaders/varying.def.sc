@@ -0,0 +1,10 @@
+vec4 v_color0    : COLOR0    = vec4(1.0, 1.0, 1.0, 1.0);
+vec2 v_texcoord0 : TEXCOORD0 = vec2(0.0, 0.0);
+vec3 v_local     : TEXCOORD1 = vec3(0.0, 0.0, 0.0);
+vec4 v_shape     : TEXCOORD2 = vec4(0.0, 0.0, 0.0, 0.0);
+
+vec2 a_position  : POSITION;
+vec4 a_color0    : COLOR0;
+vec2 a_texcoord0 : TEXCOORD0;
+vec3 a_texcoord1 : TEXCOORD1;
+vec4 a_texcoord2 : TEXCOORD2;
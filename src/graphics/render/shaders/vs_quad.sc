@@ -0,0 +1,27 @@
+$input a_position, a_color0, a_texcoord0, a_texcoord1, a_texcoord2
+$output v_color0, v_texcoord0, v_local, v_shape
+
+///
+/// @file       vs_quad.sc
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Vertex shader for the quads of the quad batcher. Positions are in pixels and are
+///             mapped to clip space by the view transform.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <bgfx_shader.sh>
+
+void main()
+{
+    // Map the corner to clip space.
+    gl_Position = mul(u_viewProj, vec4(a_position, 0.0, 1.0));
+
+    // Pass the color, texture coordinates, and shape on to the fragment shader.
+    v_color0 = a_color0;
+    v_texcoord0 = a_texcoord0;
+    v_local = a_texcoord1;
+    v_shape = a_texcoord2;
+}
@@ -0,0 +1,448 @@
+///
+/// @file       texture_atlas.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a class that packs small images, such as icons and nine-patches,
+///             into a few shared textures.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include "texture_atlas.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    bool texture_atlas::place_on_page(page_t &page, uint16_t width, uint16_t height, uint16_t &x,
+        uint16_t &y)
+    {
+        vector<skyline_node_t> &skyline = page.skyline;
+
+        // Find the segment the rectangle rests lowest on when its left edge is there, preferring
+        // the narrowest segment to leave wide gaps for wide images.
+        size_t best = SIZE_MAX;
+        uint16_t best_y = 0;
+
+        for (size_t i = 0; i < skyline.size() && skyline[i].x + width <= m_page_size; i++)
+        {
+            // The rectangle rests on the highest segment below it.
+            uint16_t top = 0;
+            uint32_t spanned = 0;
+
+            for (size_t j = i; spanned < width; j++)
+            {
+                top = max(top, skyline[j].y);
+                spanned += skyline[j].width;
+            }
+
+            if (top + height > m_page_size)
+            {
+                continue;
+            }
+
+            if (best == SIZE_MAX || top < best_y
+                || (top == best_y && skyline[i].width < skyline[best].width))
+            {
+                best = i;
+                best_y = top;
+            }
+        }
+
+        if (best == SIZE_MAX)
+        {
+            return false;
+        }
+
+        // Raise the skyline over the rectangle and cut the segments it covers.
+        x = skyline[best].x;
+        y = best_y;
+        skyline.insert(skyline.begin() + best, {x, (uint16_t)(y + height), width});
+
+        for (size_t i = best + 1; i < skyline.size() && skyline[i].x < x + width;)
+        {
+            uint16_t overlap = (uint16_t)(x + width - skyline[i].x);
+
+            if (skyline[i].width <= overlap)
+            {
+                skyline.erase(skyline.begin() + i);
+                continue;
+            }
+
+            skyline[i].x += overlap;
+            skyline[i].width -= overlap;
+            break;
+        }
+
+        // Join neighboring segments of the same height.
+        for (size_t i = 0; i + 1 < skyline.size();)
+        {
+            if (skyline[i].y == skyline[i + 1].y)
+            {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + i + 1);
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        return true;
+    }
+
+    bool texture_atlas::place(image_t &image)
+    {
+        uint16_t width = image.width + 2 * LEAF_TEXTURE_ATLAS_PADDING;
+        uint16_t height = image.height + 2 * LEAF_TEXTURE_ATLAS_PADDING;
+        uint16_t x = 0;
+        uint16_t y = 0;
+
+        // Use the first page with room, then a new page if there may be more.
+        size_t index = 0;
+
+        while (index < m_pages.size() && !place_on_page(m_pages[index], width, height, x, y))
+        {
+            index++;
+        }
+
+        if (index == m_pages.size())
+        {
+            if (m_pages.size() >= m_max_pages)
+            {
+                return false;
+            }
+
+            m_pages.push_back({BGFX_INVALID_HANDLE, {{0, 0, m_page_size}}});
+            place_on_page(m_pages.back(), width, height, x, y);
+        }
+
+        image.page = (uint16_t)index;
+        image.x = x + LEAF_TEXTURE_ATLAS_PADDING;
+        image.y = y + LEAF_TEXTURE_ATLAS_PADDING;
+        image.is_uploaded = false;
+        m_is_upload_needed = true;
+        m_stats.used_pixels += (uint64_t)width * height;
+
+        return true;
+    }
+
+    void texture_atlas::repack(void)
+    {
+        // Empty every page but keep its texture.
+        for (page_t &page : m_pages)
+        {
+            page.skyline.assign(1, {0, 0, m_page_size});
+        }
+
+        m_pending.clear();
+        m_stats.used_pixels = 0;
+        m_stats.wasted_pixels = 0;
+        m_stats.defragmentations++;
+
+        // Place the tallest images first, which leaves the fewest gaps under the skylines. Every
+        // image is unplaced until then, so none is found on a page it may no longer have.
+        vector<image_t *> order;
+
+        for (image_t &image : m_images)
+        {
+            image.page = UINT16_MAX;
+            image.is_uploaded = false;
+            order.push_back(&image);
+        }
+
+        stable_sort(order.begin(), order.end(), [](const image_t *a, const image_t *b)
+        {
+            return a->height > b->height || (a->height == b->height && a->width > b->width);
+        });
+
+        size_t page_count = 0;
+
+        for (image_t *image : order)
+        {
+            if (place(*image))
+            {
+                page_count = max(page_count, (size_t)image->page + 1);
+            }
+            else
+            {
+                // Try the image again in later updates.
+                m_stats.failures++;
+                m_pending.push_back(image->handle);
+            }
+        }
+
+        // Retire the pages that were left empty.
+        for (size_t i = page_count; i < m_pages.size(); i++)
+        {
+            if (bgfx::isValid(m_pages[i].texture))
+            {
+                m_retired.push_back(m_pages[i].texture);
+            }
+        }
+
+        m_pages.resize(page_count);
+    }
+
+    void texture_atlas::upload(image_t &image)
+    {
+        page_t &page = m_pages[image.page];
+
+        if (!bgfx::isValid(page.texture))
+        {
+            page.texture = bgfx::createTexture2D(m_page_size, m_page_size, false, 1,
+                bgfx::TextureFormat::RGBA8, BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP);
+        }
+
+        // Copy each row between repeats of its edge pixels, and repeat the edge rows above and
+        // below.
+        uint16_t width = image.width + 2 * LEAF_TEXTURE_ATLAS_PADDING;
+        uint16_t height = image.height + 2 * LEAF_TEXTURE_ATLAS_PADDING;
+        m_scratch.resize((size_t)width * height * 4);
+
+        for (uint16_t row = 0; row < height; row++)
+        {
+            int source_row = min(max(row - LEAF_TEXTURE_ATLAS_PADDING, 0), image.height - 1);
+            const uint8_t *source = &image.pixels[(size_t)source_row * image.width * 4];
+            uint8_t *destination = &m_scratch[(size_t)row * width * 4];
+
+            for (int i = 0; i < LEAF_TEXTURE_ATLAS_PADDING; i++)
+            {
+                memcpy(destination + i * 4, source, 4);
+                memcpy(destination + (width - 1 - i) * 4, source + (image.width - 1) * 4, 4);
+            }
+
+            memcpy(destination + LEAF_TEXTURE_ATLAS_PADDING * 4, source, (size_t)image.width * 4);
+        }
+
+        bgfx::updateTexture2D(page.texture, 0, 0, image.x - LEAF_TEXTURE_ATLAS_PADDING,
+            image.y - LEAF_TEXTURE_ATLAS_PADDING, width, height,
+            bgfx::copy(m_scratch.data(), (uint32_t)m_scratch.size()));
+
+        image.is_uploaded = true;
+        m_stats.uploads++;
+    }
+
+    texture_atlas::texture_atlas(uint16_t page_size, uint16_t max_pages) noexcept
+        // Start without pages or images, with nothing counted.
+        : m_page_size(page_size), m_max_pages(max(max_pages, (uint16_t)1)),
+        m_is_defragment_requested(false), m_is_upload_needed(false),
+        m_stats({0, 0, 0, 0, 0, 0, 0}) {}
+
+    texture_atlas::~texture_atlas(void) noexcept {}
+
+    utl::slot_handle_t texture_atlas::add(uint16_t width, uint16_t height, const uint8_t *pixels)
+    {
+        if (width == 0 || height == 0 || !pixels)
+        {
+            throw runtime_error("An image added to a texture atlas must not be empty.");
+        }
+
+        if (width + 2 * LEAF_TEXTURE_ATLAS_PADDING > m_page_size
+            || height + 2 * LEAF_TEXTURE_ATLAS_PADDING > m_page_size)
+        {
+            throw runtime_error("The image is too large for a page of the texture atlas.");
+        }
+
+        // Copy the pixels before taking the lock.
+        image_t image;
+        image.pixels.assign(pixels, pixels + (size_t)width * height * 4);
+        image.width = width;
+        image.height = height;
+        image.page = UINT16_MAX;
+        image.x = 0;
+        image.y = 0;
+        image.is_uploaded = false;
+
+        lock_guard<mutex> lock(m_mutex);
+        utl::slot_handle_t handle = m_images.insert(std::move(image));
+        m_images.get(handle)->handle = handle;
+
+        try
+        {
+            m_pending.push_back(handle);
+        }
+        catch (const exception &)
+        {
+            m_images.erase(handle);
+            throw;
+        }
+
+        return handle;
+    }
+
+    bool texture_atlas::remove(const utl::slot_handle_t &image) noexcept
+    {
+        lock_guard<mutex> lock(m_mutex);
+        const image_t *found = m_images.get(image);
+
+        if (!found)
+        {
+            return false;
+        }
+
+        // The space of the image stays taken until the pages are packed again.
+        if (found->page != UINT16_MAX)
+        {
+            uint64_t area = (uint64_t)(found->width + 2 * LEAF_TEXTURE_ATLAS_PADDING)
+                * (found->height + 2 * LEAF_TEXTURE_ATLAS_PADDING);
+            m_stats.used_pixels -= area;
+            m_stats.wasted_pixels += area;
+        }
+
+        return m_images.erase(image);
+    }
+
+    void texture_atlas::defragment(void) noexcept
+    {
+        // Leave the packing to the API thread.
+        lock_guard<mutex> lock(m_mutex);
+        m_is_defragment_requested = true;
+    }
+
+    bool texture_atlas::image_size(const utl::slot_handle_t &image, bounds2_t &size) const
+        noexcept
+    {
+        lock_guard<mutex> lock(m_mutex);
+        const image_t *found = m_images.get(image);
+
+        if (!found)
+        {
+            return false;
+        }
+
+        size = bounds2_t(found->width, found->height);
+
+        return true;
+    }
+
+    bool texture_atlas::find(const utl::slot_handle_t &image, atlas_region_t &region) const
+        noexcept
+    {
+        lock_guard<mutex> lock(m_mutex);
+        const image_t *found = m_images.get(image);
+
+        if (!found || found->page == UINT16_MAX || !found->is_uploaded)
+        {
+            return false;
+        }
+
+        // Map the corners of the image inside its padding to texture coordinates.
+        float scale = 1.0f / m_page_size;
+        region.texture = m_pages[found->page].texture;
+        region.width = found->width;
+        region.height = found->height;
+        region.u0 = found->x * scale;
+        region.v0 = found->y * scale;
+        region.u1 = (found->x + found->width) * scale;
+        region.v1 = (found->y + found->height) * scale;
+
+        return true;
+    }
+
+    void texture_atlas::update(void) noexcept
+    {
+        lock_guard<mutex> lock(m_mutex);
+
+        try
+        {
+            if (m_is_defragment_requested)
+            {
+                m_is_defragment_requested = false;
+                repack();
+            }
+
+            // Place the images that were added. If one does not fit, pack everything again to
+            // reuse the space of removed images, which places the others as well.
+            vector<utl::slot_handle_t> pending;
+            swap(pending, m_pending);
+
+            for (const utl::slot_handle_t &handle : pending)
+            {
+                image_t *image = m_images.get(handle);
+
+                if (!image || image->page != UINT16_MAX || place(*image))
+                {
+                    continue;
+                }
+
+                if (m_stats.wasted_pixels > 0)
+                {
+                    repack();
+                    break;
+                }
+
+                m_stats.failures++;
+                m_pending.push_back(handle);
+            }
+
+            // Upload every image that was placed or moved.
+            if (m_is_upload_needed)
+            {
+                for (image_t &image : m_images)
+                {
+                    if (image.page != UINT16_MAX && !image.is_uploaded)
+                    {
+                        upload(image);
+                    }
+                }
+
+                m_is_upload_needed = false;
+            }
+        }
+        catch (const exception &) {}
+
+        // Destroy the textures of pages that were left empty.
+        for (bgfx::TextureHandle texture : m_retired)
+        {
+            bgfx::destroy(texture);
+        }
+
+        m_retired.clear();
+    }
+
+    texture_atlas_stats_t texture_atlas::stats(void) const noexcept
+    {
+        // Count the pages and images along with the counters.
+        lock_guard<mutex> lock(m_mutex);
+        texture_atlas_stats_t stats = m_stats;
+        stats.pages = (uint32_t)m_pages.size();
+        stats.images = (uint32_t)m_images.size();
+
+        return stats;
+    }
+
+    void texture_atlas::destroy_resources(void) noexcept
+    {
+        // Destroy every texture and upload the images again if the atlas is used again.
+        lock_guard<mutex> lock(m_mutex);
+
+        for (page_t &page : m_pages)
+        {
+            if (bgfx::isValid(page.texture))
+            {
+                bgfx::destroy(page.texture);
+            }
+
+            page.texture = BGFX_INVALID_HANDLE;
+        }
+
+        for (bgfx::TextureHandle texture : m_retired)
+        {
+            bgfx::destroy(texture);
+        }
+
+        m_retired.clear();
+
+        for (image_t &image : m_images)
+        {
+            image.is_uploaded = false;
+        }
+
+        m_is_upload_needed = true;
+    }
+}
@@ -0,0 +1,388 @@
+///
+/// @file       texture_atlas.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a class that packs small images, such as icons and nine-patches, into a
+///             few shared textures.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_TEXTURE_ATLAS_HEADER_GUARD
+#define LEAF_SRC_TEXTURE_ATLAS_HEADER_GUARD
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include <bgfx/bgfx.h>
+#include "../../utils/slot_map.hpp"
+#include "../../utils/unique.hpp"
+#include "../graphics_types.hpp"
+
+///
+/// @brief  The width and height of each page of a texture atlas by default, in pixels.
+///
+#define LEAF_TEXTURE_ATLAS_PAGE_SIZE 1024
+
+///
+/// @brief  The number of pages a texture atlas creates at most by default.
+///
+#define LEAF_TEXTURE_ATLAS_MAX_PAGES 8
+
+///
+/// @brief  The number of pixels kept around each image. They repeat the edge of the image, so that
+///         filtering a stretched image never reads a neighboring one.
+///
+#define LEAF_TEXTURE_ATLAS_PADDING 1
+
+namespace leaf
+{
+    ///
+    /// @brief  Where an image is in a texture atlas.
+    ///
+    typedef struct atlas_region
+    {
+        ///
+        /// @brief  The texture of the page the image is on.
+        ///
+        bgfx::TextureHandle texture;
+
+        ///
+        /// @brief  The width and height of the image in pixels.
+        ///
+        uint16_t width, height;
+
+        ///
+        /// @brief  The texture coordinates of the top-left and bottom-right corners of the image.
+        ///
+        float u0, v0, u1, v1;
+
+    } atlas_region_t;
+
+    ///
+    /// @brief  Describes how full a texture atlas is and how much work it did.
+    ///
+    typedef struct texture_atlas_stats
+    {
+        ///
+        /// @brief  The number of pages.
+        ///
+        uint32_t pages;
+
+        ///
+        /// @brief  The number of images, whether or not they are on a page yet.
+        ///
+        uint32_t images;
+
+        ///
+        /// @brief  The number of pixels the images on the pages take, including their padding.
+        ///
+        uint64_t used_pixels;
+
+        ///
+        /// @brief  The number of pixels left behind by removed images until the pages are packed
+        ///         again.
+        ///
+        uint64_t wasted_pixels;
+
+        ///
+        /// @brief  The number of images uploaded to the pages.
+        ///
+        uint64_t uploads;
+
+        ///
+        /// @brief  The number of times the pages were packed again.
+        ///
+        uint64_t defragmentations;
+
+        ///
+        /// @brief  The number of times an image did not fit on any page.
+        ///
+        uint64_t failures;
+
+    } texture_atlas_stats_t;
+
+    ///
+    /// @brief  Packs small images into a few shared textures, so that icons and nine-patches drawn
+    ///         one after another are drawn with one texture and the quad batcher merges their
+    ///         draws. Each page is packed with a skyline, which places an image at the lowest
+    ///         point along the top edge of the images below it. A new page is created when an
+    ///         image fits on none, up to a limit.
+    ///
+    ///         Images are referred to by handles that stay valid while their images move. Removing
+    ///         an image leaves its space behind until the pages are packed again, which happens
+    ///         when an image does not fit otherwise or when it is asked for. Packing again places
+    ///         the images from the tallest down, which usually needs fewer pages.
+    ///
+    ///         Images can be added and removed from any thread. The pages are packed and uploaded
+    ///         by update, which must be called on the renderer's API thread, and an image is only
+    ///         drawn once it was uploaded.
+    ///
+    class texture_atlas : public utl::unique
+    {
+        private:
+            ///
+            /// @brief  A segment of the top edge of the images on a page.
+            ///
+            typedef struct skyline_node
+            {
+                ///
+                /// @brief  The left edge of the segment.
+                ///
+                uint16_t x;
+
+                ///
+                /// @brief  The height of the segment, below which the page is taken.
+                ///
+                uint16_t y;
+
+                ///
+                /// @brief  The width of the segment.
+                ///
+                uint16_t width;
+
+            } skyline_node_t;
+
+            ///
+            /// @brief  A texture the images are packed into.
+            ///
+            typedef struct page
+            {
+                ///
+                /// @brief  The texture, invalid until the page is first uploaded to.
+                ///
+                bgfx::TextureHandle texture;
+
+                ///
+                /// @brief  The top edge of the images on the page from left to right.
+                ///
+                std::vector<skyline_node_t> skyline;
+
+            } page_t;
+
+            ///
+            /// @brief  An image and where it is.
+            ///
+            typedef struct image
+            {
+                ///
+                /// @brief  The handle to the image.
+                ///
+                utl::slot_handle_t handle;
+
+                ///
+                /// @brief  The pixels of the image in RGBA8 format, row by row.
+                ///
+                std::vector<uint8_t> pixels;
+
+                ///
+                /// @brief  The width and height of the image in pixels.
+                ///
+                uint16_t width, height;
+
+                ///
+                /// @brief  The index of the page the image is on, or UINT16_MAX if it is on none.
+                ///
+                uint16_t page;
+
+                ///
+                /// @brief  The top-left corner of the image on the page, inside the padding.
+                ///
+                uint16_t x, y;
+
+                ///
+                /// @brief  Whether the image was uploaded to its place on the page.
+                ///
+                bool is_uploaded;
+
+            } image_t;
+
+            ///
+            /// @brief  The width and height of each page in pixels.
+            ///
+            uint16_t m_page_size;
+
+            ///
+            /// @brief  The number of pages created at most.
+            ///
+            uint16_t m_max_pages;
+
+            ///
+            /// @brief  Guards everything below, since images are added on other threads than the
+            ///         one that uploads them.
+            ///
+            mutable std::mutex m_mutex;
+
+            ///
+            /// @brief  The images by their handles.
+            ///
+            utl::slot_map<image_t> m_images;
+
+            ///
+            /// @brief  The images that were added but are not on a page yet.
+            ///
+            std::vector<utl::slot_handle_t> m_pending;
+
+            ///
+            /// @brief  The pages in the order they were created.
+            ///
+            std::vector<page_t> m_pages;
+
+            ///
+            /// @brief  The textures of pages that packing again left empty. They are destroyed by
+            ///         the next update.
+            ///
+            std::vector<bgfx::TextureHandle> m_retired;
+
+            ///
+            /// @brief  Whether the pages should be packed again by the next update.
+            ///
+            bool m_is_defragment_requested;
+
+            ///
+            /// @brief  Whether an image on a page was not uploaded to its place yet.
+            ///
+            bool m_is_upload_needed;
+
+            ///
+            /// @brief  The image being uploaded with its padding. The memory is reused between
+            ///         images.
+            ///
+            std::vector<uint8_t> m_scratch;
+
+            ///
+            /// @brief  How full the atlas is and how much work it did.
+            ///
+            texture_atlas_stats_t m_stats;
+
+            ///
+            /// @brief  Finds the lowest place on a page for a rectangle and takes it.
+            ///
+            /// @param  page    the page
+            /// @param  width   the width including the padding
+            /// @param  height  the height including the padding
+            /// @param  x       set to the left edge of the place
+            /// @param  y       set to the top edge of the place
+            ///
+            /// @return true if and only if the rectangle fits on the page
+            ///
+            bool place_on_page(page_t &page, uint16_t width, uint16_t height, uint16_t &x,
+                uint16_t &y);
+
+            ///
+            /// @brief  Places an image on the first page it fits on, creating a page if it fits on
+            ///         none and there are not too many.
+            ///
+            /// @param  image   the image
+            ///
+            /// @return true if and only if the image was placed
+            ///
+            bool place(image_t &image);
+
+            ///
+            /// @brief  Empties every page and places every image again from the tallest down.
+            ///         Pages that are left empty are retired.
+            ///
+            void repack(void);
+
+            ///
+            /// @brief  Uploads an image with its padding to its place on its page.
+            ///
+            /// @param  image   the image
+            ///
+            void upload(image_t &image);
+
+        public:
+            ///
+            /// @brief  Constructs an empty atlas. Nothing is created with bgfx until the first
+            ///         update that has an image to upload.
+            ///
+            /// @param  page_size   the width and height of each page in pixels
+            /// @param  max_pages   the number of pages to create at most
+            ///
+            texture_atlas(uint16_t page_size = LEAF_TEXTURE_ATLAS_PAGE_SIZE,
+                uint16_t max_pages = LEAF_TEXTURE_ATLAS_MAX_PAGES) noexcept;
+
+            ///
+            /// @brief      Destroys the atlas.
+            ///
+            /// @warning    The bgfx resources must have been destroyed on the API thread first.
+            ///
+            ~texture_atlas(void) noexcept;
+
+            ///
+            /// @brief  Adds an image. It is placed on a page and uploaded by the next update.
+            ///
+            /// @param  width   the width of the image in pixels
+            /// @param  height  the height of the image in pixels
+            /// @param  pixels  the pixels of the image in RGBA8 format, row by row
+            ///
+            /// @return a handle to the image
+            ///
+            /// @throw  runtime_error if the image is empty or too large for a page
+            ///
+            utl::slot_handle_t add(uint16_t width, uint16_t height, const uint8_t *pixels);
+
+            ///
+            /// @brief  Removes an image. Its space is reused once the pages are packed again.
+            ///
+            /// @param  image   the handle to the image
+            ///
+            /// @return true if and only if the handle referred to an image
+            ///
+            bool remove(const utl::slot_handle_t &image) noexcept;
+
+            ///
+            /// @brief  Asks for the pages to be packed again by the next update, giving back the
+            ///         space of removed images and possibly whole pages.
+            ///
+            void defragment(void) noexcept;
+
+            ///
+            /// @brief  Determines the size of an image.
+            ///
+            /// @param  image   the handle to the image
+            /// @param  size    set to the width and height of the image in pixels
+            ///
+            /// @return true if and only if the handle refers to an image
+            ///
+            bool image_size(const utl::slot_handle_t &image, bounds2_t &size) const noexcept;
+
+            ///
+            /// @brief  Finds where an image is.
+            ///
+            /// @param  image   the handle to the image
+            /// @param  region  set to the texture and texture coordinates of the image
+            ///
+            /// @return true if and only if the image was uploaded and can be drawn
+            ///
+            bool find(const utl::slot_handle_t &image, atlas_region_t &region) const noexcept;
+
+            ///
+            /// @brief      Places the images that were added, packing the pages again if an image
+            ///             does not fit otherwise or if it was asked for, and uploads every image
+            ///             that moved.
+            ///
+            /// @warning    This must be called on the renderer's API thread.
+            ///
+            void update(void) noexcept;
+
+            ///
+            /// @brief  Returns how full the atlas is and how much work it did.
+            ///
+            /// @return the statistics
+            ///
+            texture_atlas_stats_t stats(void) const noexcept;
+
+            ///
+            /// @brief  Destroys the textures of the pages. The images are kept and uploaded again
+            ///         by the next update. This must be called on the API thread before bgfx shuts
+            ///         down.
+            ///
+            void destroy_resources(void) noexcept;
+    };
+}
+
+#endif
@@ -0,0 +1,160 @@
+///
+/// @file       font.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a class that represents a TrueType font that text is laid out and
+///             drawn with.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include "font.hpp"
+
+// Compile stb_truetype into this file only, so that it cannot clash with another copy.
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <stb/stb_truetype.h>
+
+using namespace std;
+
+namespace leaf
+{
+    atomic<uint32_t> font::f_next_id(1);
+
+    void font::init(void)
+    {
+        // Find the first font in the file.
+        int offset = stbtt_GetFontOffsetForIndex(m_data.data(), 0);
+
+        if (offset < 0 || !stbtt_InitFont(m_info.get(), m_data.data(), offset))
+        {
+            throw runtime_error("The font is not a TrueType font.");
+        }
+
+        stbtt_GetFontVMetrics(m_info.get(), &m_ascent, &m_descent, &m_line_gap);
+    }
+
+    font::font(const string &path) : m_id(f_next_id++), m_info(new stbtt_fontinfo())
+    {
+        // Read the whole file.
+        ifstream file(path, ios::binary);
+
+        if (!file)
+        {
+            throw runtime_error("The font file \"" + path + "\" could not be read.");
+        }
+
+        m_data.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+        init();
+    }
+
+    font::font(vector<unsigned char> &&data)
+        // Take the contents without copying them.
+        : m_id(f_next_id++), m_data(std::move(data)), m_info(new stbtt_fontinfo())
+    {
+        init();
+    }
+
+    font::~font(void) noexcept {}
+
+    uint32_t font::id(void) const noexcept
+    {
+        // Return the identifier.
+        return m_id;
+    }
+
+    font_metrics_t font::metrics(px_t size) const noexcept
+    {
+        // Scale the metrics from font units to pixels. The descent is negative in font units.
+        float scale = stbtt_ScaleForPixelHeight(m_info.get(), size);
+
+        return {
+            m_ascent * scale,
+            -m_descent * scale,
+            (m_ascent - m_descent + m_line_gap) * scale
+        };
+    }
+
+    uint32_t font::glyph_index(uint32_t codepoint) const noexcept
+    {
+        // Look the character up in the character map of the font.
+        return (uint32_t)stbtt_FindGlyphIndex(m_info.get(), (int)codepoint);
+    }
+
+    float font::advance(uint32_t glyph, px_t size) const noexcept
+    {
+        // Scale the advance from font units to pixels.
+        int advance = 0;
+        int left_bearing = 0;
+        stbtt_GetGlyphHMetrics(m_info.get(), (int)glyph, &advance, &left_bearing);
+
+        return advance * stbtt_ScaleForPixelHeight(m_info.get(), size);
+    }
+
+    float font::kerning(uint32_t left, uint32_t right, px_t size) const noexcept
+    {
+        // Scale the adjustment from font units to pixels.
+        return stbtt_GetGlyphKernAdvance(m_info.get(), (int)left, (int)right)
+            * stbtt_ScaleForPixelHeight(m_info.get(), size);
+    }
+
+    glyph_box_t font::box(uint32_t glyph, px_t size) const noexcept
+    {
+        // Find the pixels the glyph covers relative to the pen.
+        float scale = stbtt_ScaleForPixelHeight(m_info.get(), size);
+        int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+        stbtt_GetGlyphBitmapBox(m_info.get(), (int)glyph, scale, scale, &x0, &y0, &x1, &y1);
+
+        return {(int16_t)x0, (int16_t)y0, (uint16_t)max(x1 - x0, 0), (uint16_t)max(y1 - y0, 0)};
+    }
+
+    void font::rasterize(uint32_t glyph, px_t size, uint8_t *pixels, size_t stride) const noexcept
+    {
+        // Rasterize into the box the glyph was measured with.
+        float scale = stbtt_ScaleForPixelHeight(m_info.get(), size);
+        glyph_box_t box = this->box(glyph, size);
+
+        stbtt_MakeGlyphBitmap(m_info.get(), pixels, box.width, box.height, (int)stride, scale,
+            scale, (int)glyph);
+    }
+
+    bool font::rasterize_sdf(uint32_t glyph, px_t size, uint8_t spread, vector<uint8_t> &pixels,
+        glyph_box_t &box) const noexcept
+    {
+        // Let stb_truetype find the distances, with the edge halfway through the range.
+        float scale = stbtt_ScaleForPixelHeight(m_info.get(), size);
+        int width = 0, height = 0, x = 0, y = 0;
+        unsigned char *field = stbtt_GetGlyphSDF(m_info.get(), scale, (int)glyph, spread, 128,
+            128.0f / max(spread, (uint8_t)1), &width, &height, &x, &y);
+
+        // Glyphs that draw nothing have no field.
+        if (!field)
+        {
+            box = {0, 0, 0, 0};
+            pixels.clear();
+
+            return true;
+        }
+
+        box = {(int16_t)x, (int16_t)y, (uint16_t)width, (uint16_t)height};
+
+        try
+        {
+            pixels.assign(field, field + (size_t)width * height);
+        }
+        catch (const exception &)
+        {
+            stbtt_FreeSDF(field, NULL);
+            return false;
+        }
+
+        stbtt_FreeSDF(field, NULL);
+
+        return true;
+    }
+}
@@ -0,0 +1,234 @@
+///
+/// @file       font.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a class that represents a TrueType font that text is laid out and drawn
+///             with.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_FONT_HEADER_GUARD
+#define LEAF_SRC_FONT_HEADER_GUARD
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../../utils/unique.hpp"
+#include "../graphics_types.hpp"
+
+///
+/// @brief  The font information of stb_truetype, which is only used by the implementation.
+///
+struct stbtt_fontinfo;
+
+namespace leaf
+{
+    ///
+    /// @brief  Describes the vertical metrics of a font at a size, in pixels.
+    ///
+    typedef struct font_metrics
+    {
+        ///
+        /// @brief  The distance from the top of a line to its baseline.
+        ///
+        float ascent;
+
+        ///
+        /// @brief  The distance from the baseline of a line to its bottom.
+        ///
+        float descent;
+
+        ///
+        /// @brief  The distance from the baseline of a line to the baseline of the next.
+        ///
+        float line_height;
+
+    } font_metrics_t;
+
+    ///
+    /// @brief  Describes the pixels a glyph covers at a size, relative to the point on the baseline
+    ///         where it is drawn.
+    ///
+    typedef struct glyph_box
+    {
+        ///
+        /// @brief  The offset of the left edge from the point.
+        ///
+        int16_t x;
+
+        ///
+        /// @brief  The offset of the top edge from the point. It is negative above the baseline.
+        ///
+        int16_t y;
+
+        ///
+        /// @brief  The width in pixels, 0 if the glyph draws nothing.
+        ///
+        uint16_t width;
+
+        ///
+        /// @brief  The height in pixels, 0 if the glyph draws nothing.
+        ///
+        uint16_t height;
+
+    } glyph_box_t;
+
+    ///
+    /// @brief  Represents a TrueType font. A font can be read from any thread, so that text can be
+    ///         laid out on the thread that polls window events while glyphs are rasterized on the
+    ///         renderer's API thread. Fonts are shared by pointer, since laid out text keeps its
+    ///         font alive until it is drawn.
+    ///
+    class font : public utl::unique
+    {
+        private:
+            ///
+            /// @brief  The identifier given to the next font.
+            ///
+            static std::atomic<uint32_t> f_next_id;
+
+            ///
+            /// @brief  The identifier of the font, which is never reused by another font.
+            ///
+            uint32_t m_id;
+
+            ///
+            /// @brief  The contents of the font file, which stb_truetype reads directly.
+            ///
+            std::vector<unsigned char> m_data;
+
+            ///
+            /// @brief  The font information of stb_truetype.
+            ///
+            std::unique_ptr<stbtt_fontinfo> m_info;
+
+            ///
+            /// @brief  The ascent, descent, and line gap in font units.
+            ///
+            int m_ascent, m_descent, m_line_gap;
+
+            ///
+            /// @brief  Reads the font information from the contents of the file.
+            ///
+            /// @throw  runtime_error if the contents are not a TrueType font
+            ///
+            void init(void);
+
+        public:
+            ///
+            /// @brief  Constructs a font by reading a TrueType file.
+            ///
+            /// @param  path    the path of the file
+            ///
+            /// @throw  runtime_error if the file cannot be read or is not a TrueType font
+            ///
+            font(const std::string &path);
+
+            ///
+            /// @brief  Constructs a font from the contents of a TrueType file.
+            ///
+            /// @param  data    the contents of the file
+            ///
+            /// @throw  runtime_error if the contents are not a TrueType font
+            ///
+            font(std::vector<unsigned char> &&data);
+
+            ///
+            /// @brief  Destroys the font.
+            ///
+            ~font(void) noexcept;
+
+            ///
+            /// @brief  Returns the identifier of the font, which is never reused by another font.
+            ///
+            /// @return the identifier
+            ///
+            uint32_t id(void) const noexcept;
+
+            ///
+            /// @brief  Determines the vertical metrics of the font at a size.
+            ///
+            /// @param  size    the height of a line in pixels
+            ///
+            /// @return the metrics in pixels
+            ///
+            font_metrics_t metrics(px_t size) const noexcept;
+
+            ///
+            /// @brief  Finds the glyph of a Unicode character.
+            ///
+            /// @param  codepoint   the character
+            ///
+            /// @return the index of the glyph, 0 for the missing glyph
+            ///
+            uint32_t glyph_index(uint32_t codepoint) const noexcept;
+
+            ///
+            /// @brief  Determines how far a glyph moves the pen at a size.
+            ///
+            /// @param  glyph   the index of the glyph
+            /// @param  size    the height of a line in pixels
+            ///
+            /// @return the advance in pixels
+            ///
+            float advance(uint32_t glyph, px_t size) const noexcept;
+
+            ///
+            /// @brief  Determines how much the pen moves between a pair of glyphs beyond the
+            ///         advance of the first.
+            ///
+            /// @param  left    the index of the first glyph
+            /// @param  right   the index of the second glyph
+            /// @param  size    the height of a line in pixels
+            ///
+            /// @return the adjustment in pixels, usually 0 or negative
+            ///
+            float kerning(uint32_t left, uint32_t right, px_t size) const noexcept;
+
+            ///
+            /// @brief  Determines the pixels a glyph covers at a size.
+            ///
+            /// @param  glyph   the index of the glyph
+            /// @param  size    the height of a line in pixels
+            ///
+            /// @return the box of the glyph
+            ///
+            glyph_box_t box(uint32_t glyph, px_t size) const noexcept;
+
+            ///
+            /// @brief  Rasterizes a glyph into an 8-bit coverage bitmap the size of its box.
+            ///
+            /// @param  glyph   the index of the glyph
+            /// @param  size    the height of a line in pixels
+            /// @param  pixels  the bitmap to write to
+            /// @param  stride  the number of bytes between rows of the bitmap
+            ///
+            void rasterize(uint32_t glyph, px_t size, uint8_t *pixels, size_t stride) const
+                noexcept;
+
+            ///
+            /// @brief  Rasterizes a glyph into an 8-bit signed distance field. Each pixel holds the
+            ///         distance from its center to the nearest edge of the glyph, 128 on the edge
+            ///         and larger inside, changing by 128 / spread for each pixel. The field is
+            ///         larger than the box of the glyph by the spread on each side, so that it
+            ///         fades out completely.
+            ///
+            /// @param  glyph   the index of the glyph
+            /// @param  size    the height of a line in pixels
+            /// @param  spread  the distance in pixels over which the field fades out
+            /// @param  pixels  set to the field, with rows of the width of the box
+            /// @param  box     set to the pixels the field covers, empty if the glyph draws nothing
+            ///
+            /// @return true unless there was not enough memory
+            ///
+            bool rasterize_sdf(uint32_t glyph, px_t size, uint8_t spread,
+                std::vector<uint8_t> &pixels, glyph_box_t &box) const noexcept;
+    };
+}
+
+#endif
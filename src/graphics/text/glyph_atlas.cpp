@@ -0,0 +1,270 @@
+///
+/// @file       glyph_atlas.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a class that rasterizes glyphs into a texture on demand, keeping
+///             the most recently drawn ones.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <algorithm>
+#include "glyph_atlas.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    bool glyph_atlas::glyph_key::operator==(const glyph_key &other) const noexcept
+    {
+        // Compare every field.
+        return font_id == other.font_id && glyph == other.glyph && size == other.size;
+    }
+
+    size_t glyph_atlas::glyph_key_hash::operator()(const glyph_key_t &key) const noexcept
+    {
+        // Pack the fields and mix them.
+        uint64_t fields = (uint64_t)key.font_id << 40 ^ (uint64_t)key.glyph << 16
+            ^ (uint16_t)key.size;
+
+        return (size_t)(fields * 0x9e3779b97f4a7c15ull >> 16);
+    }
+
+    uint16_t glyph_atlas::allocate(uint16_t width, uint16_t height, uint16_t &x, uint16_t &y)
+    {
+        if (width > m_size || height > m_size)
+        {
+            return UINT16_MAX;
+        }
+
+        // Find the shortest shelf the glyph fits on.
+        uint16_t index = UINT16_MAX;
+
+        for (size_t i = 0; i < m_shelves.size(); i++)
+        {
+            const shelf_t &shelf = m_shelves[i];
+
+            if (shelf.height >= height && shelf.used_width + width <= m_size
+                && (index == UINT16_MAX || shelf.height < m_shelves[index].height))
+            {
+                index = (uint16_t)i;
+            }
+        }
+
+        // Open a shelf below the others unless a shelf that is not much taller has room.
+        uint16_t shelf_height = (uint16_t)((height + LEAF_GLYPH_ATLAS_SHELF_ROUNDING - 1)
+            / LEAF_GLYPH_ATLAS_SHELF_ROUNDING * LEAF_GLYPH_ATLAS_SHELF_ROUNDING);
+        bool is_room_below = m_free_y + shelf_height <= m_size;
+
+        if (is_room_below && (index == UINT16_MAX || m_shelves[index].height > height * 2))
+        {
+            m_shelves.push_back({m_free_y, shelf_height, 0, m_frame});
+            m_free_y += shelf_height;
+            index = (uint16_t)(m_shelves.size() - 1);
+        }
+
+        // Otherwise empty the least recently used shelf the glyph fits on. Shelves drawn from in
+        // this frame are kept, since their glyphs are about to be drawn.
+        if (index == UINT16_MAX)
+        {
+            for (size_t i = 0; i < m_shelves.size(); i++)
+            {
+                const shelf_t &shelf = m_shelves[i];
+
+                if (shelf.height >= height && shelf.last_used < m_frame
+                    && (index == UINT16_MAX || shelf.last_used < m_shelves[index].last_used))
+                {
+                    index = (uint16_t)i;
+                }
+            }
+
+            if (index == UINT16_MAX)
+            {
+                return UINT16_MAX;
+            }
+
+            evict(index);
+        }
+
+        // Place the glyph after the others on the shelf.
+        shelf_t &shelf = m_shelves[index];
+        x = shelf.used_width;
+        y = shelf.y;
+        shelf.used_width += width;
+        shelf.last_used = m_frame;
+
+        return index;
+    }
+
+    void glyph_atlas::evict(uint16_t index) noexcept
+    {
+        // Remove the glyphs on the shelf. Their pixels are overwritten by the glyphs that replace
+        // them.
+        for (auto it = m_glyphs.begin(); it != m_glyphs.end();)
+        {
+            if (it->second.shelf == index)
+            {
+                it = m_glyphs.erase(it);
+                m_stats.evictions++;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        m_shelves[index].used_width = 0;
+    }
+
+    glyph_atlas::glyph_atlas(uint16_t size, glyph_atlas_mode mode) noexcept
+        // Start empty in the first frame with nothing counted.
+        : m_size(size), m_mode(mode), m_texture(BGFX_INVALID_HANDLE), m_free_y(0), m_frame(1),
+        m_stats({0, 0, 0, 0}) {}
+
+    glyph_atlas::~glyph_atlas(void) noexcept {}
+
+    glyph_atlas_mode glyph_atlas::mode(void) const noexcept
+    {
+        // Return the mode.
+        return m_mode;
+    }
+
+    px_t glyph_atlas::raster_size(px_t size) const noexcept
+    {
+        // A distance field serves every size.
+        return m_mode == glyph_atlas_mode::distance_field ? LEAF_GLYPH_ATLAS_SDF_SIZE : size;
+    }
+
+    void glyph_atlas::next_frame(void) noexcept
+    {
+        // Let the glyphs of the last frame be removed.
+        m_frame++;
+    }
+
+    const atlas_glyph_t *glyph_atlas::find(const font &face, uint32_t glyph, px_t size) noexcept
+    {
+        size = raster_size(size);
+        glyph_key_t key = {face.id(), glyph, size};
+
+        try
+        {
+            // Keep the shelf of a glyph that is drawn again.
+            auto found = m_glyphs.find(key);
+
+            if (found != m_glyphs.end())
+            {
+                m_stats.hits++;
+
+                if (found->second.shelf != UINT16_MAX)
+                {
+                    m_shelves[found->second.shelf].last_used = m_frame;
+                }
+
+                return &found->second.glyph;
+            }
+
+            m_stats.misses++;
+
+            // A distance field is found before it is placed, since its box includes the spread.
+            glyph_box_t box = face.box(glyph, size);
+
+            if (m_mode == glyph_atlas_mode::distance_field
+                && !face.rasterize_sdf(glyph, size, LEAF_GLYPH_ATLAS_SDF_SPREAD, m_field, box))
+            {
+                m_stats.failures++;
+                return NULL;
+            }
+
+            // Glyphs that draw nothing, such as spaces, are remembered without taking room.
+            entry_t entry = {{box, 0, 0, 0, 0}, UINT16_MAX};
+
+            if (box.width > 0 && box.height > 0)
+            {
+                if (!bgfx::isValid(m_texture))
+                {
+                    m_texture = bgfx::createTexture2D(m_size, m_size, false, 1,
+                        bgfx::TextureFormat::R8, BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP);
+                }
+
+                // Find a place for the glyph with its padding.
+                uint16_t width = box.width + 2 * LEAF_GLYPH_ATLAS_PADDING;
+                uint16_t height = box.height + 2 * LEAF_GLYPH_ATLAS_PADDING;
+                uint16_t x = 0;
+                uint16_t y = 0;
+                entry.shelf = allocate(width, height, x, y);
+
+                if (entry.shelf == UINT16_MAX)
+                {
+                    m_stats.failures++;
+                    return NULL;
+                }
+
+                // Rasterize the glyph inside cleared padding and upload both, so that nothing of
+                // an evicted glyph is left around it.
+                m_scratch.assign((size_t)width * height, 0);
+                uint8_t *pixels = &m_scratch[LEAF_GLYPH_ATLAS_PADDING * (width + 1)];
+
+                if (m_mode == glyph_atlas_mode::distance_field)
+                {
+                    for (uint16_t row = 0; row < box.height; row++)
+                    {
+                        copy_n(&m_field[(size_t)row * box.width], box.width,
+                            pixels + (size_t)row * width);
+                    }
+                }
+                else
+                {
+                    face.rasterize(glyph, size, pixels, width);
+                }
+
+                bgfx::updateTexture2D(m_texture, 0, 0, x, y, width, height,
+                    bgfx::copy(m_scratch.data(), (uint32_t)m_scratch.size()));
+
+                float scale = 1.0f / m_size;
+                entry.glyph.u0 = (x + LEAF_GLYPH_ATLAS_PADDING) * scale;
+                entry.glyph.v0 = (y + LEAF_GLYPH_ATLAS_PADDING) * scale;
+                entry.glyph.u1 = (x + LEAF_GLYPH_ATLAS_PADDING + box.width) * scale;
+                entry.glyph.v1 = (y + LEAF_GLYPH_ATLAS_PADDING + box.height) * scale;
+            }
+
+            return &m_glyphs.emplace(key, entry).first->second.glyph;
+        }
+        catch (const exception &)
+        {
+            return NULL;
+        }
+    }
+
+    bgfx::TextureHandle glyph_atlas::texture(void) const noexcept
+    {
+        // Return the texture.
+        return m_texture;
+    }
+
+    size_t glyph_atlas::glyph_count(void) const noexcept
+    {
+        // Return the number of glyphs.
+        return m_glyphs.size();
+    }
+
+    const glyph_atlas_stats_t &glyph_atlas::stats(void) const noexcept
+    {
+        // Return the counters.
+        return m_stats;
+    }
+
+    void glyph_atlas::destroy_resources(void) noexcept
+    {
+        // Destroy the texture and forget the glyphs that were in it.
+        if (bgfx::isValid(m_texture))
+        {
+            bgfx::destroy(m_texture);
+        }
+
+        m_texture = BGFX_INVALID_HANDLE;
+        m_glyphs.clear();
+        m_shelves.clear();
+        m_free_y = 0;
+    }
+}
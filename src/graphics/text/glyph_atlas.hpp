@@ -0,0 +1,379 @@
+///
+/// @file       glyph_atlas.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a class that rasterizes glyphs into a texture on demand, keeping the most
+///             recently drawn ones.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_GLYPH_ATLAS_HEADER_GUARD
+#define LEAF_SRC_GLYPH_ATLAS_HEADER_GUARD
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <bgfx/bgfx.h>
+#include "../../utils/unique.hpp"
+#include "../graphics_types.hpp"
+#include "font.hpp"
+
+///
+/// @brief  The width and height of the texture of a glyph atlas by default, in pixels.
+///
+#define LEAF_GLYPH_ATLAS_SIZE 1024
+
+///
+/// @brief  The number of empty pixels kept around each glyph, so that filtering never reads a
+///         neighboring glyph.
+///
+#define LEAF_GLYPH_ATLAS_PADDING 1
+
+///
+/// @brief  The multiple shelf heights are rounded up to, so that glyphs of similar sizes share
+///         shelves.
+///
+#define LEAF_GLYPH_ATLAS_SHELF_ROUNDING 4
+
+///
+/// @brief  The height of a line that glyphs are rasterized at in a distance field atlas, whatever
+///         size they are drawn at.
+///
+#define LEAF_GLYPH_ATLAS_SDF_SIZE 48
+
+///
+/// @brief  The distance in pixels at the size of a distance field atlas over which the field of a
+///         glyph fades out. Glyphs drawn far larger than that size soften within this distance.
+///
+#define LEAF_GLYPH_ATLAS_SDF_SPREAD 6
+
+namespace leaf
+{
+    ///
+    /// @brief  Identifies what a glyph atlas stores for each glyph.
+    ///
+    enum class glyph_atlas_mode : uint8_t
+    {
+        ///
+        /// @brief  The coverage of the glyph at each size it is drawn at. Small text is sharpest
+        ///         this way, but every size takes its own room.
+        ///
+        bitmap,
+
+        ///
+        /// @brief  The signed distance field of the glyph at one size, which is drawn at every
+        ///         size and scale.
+        ///
+        distance_field
+    };
+
+    ///
+    /// @brief  A glyph in a glyph atlas.
+    ///
+    typedef struct atlas_glyph
+    {
+        ///
+        /// @brief  The pixels the glyph covers relative to the pen, at the size the atlas
+        ///         rasterized it at.
+        ///
+        glyph_box_t box;
+
+        ///
+        /// @brief  The texture coordinates of the top-left and bottom-right corners of the glyph.
+        ///
+        float u0, v0, u1, v1;
+
+    } atlas_glyph_t;
+
+    ///
+    /// @brief  Counts how often a glyph atlas found the glyphs it was asked for.
+    ///
+    typedef struct glyph_atlas_stats
+    {
+        ///
+        /// @brief  The number of glyphs that were already in the atlas.
+        ///
+        uint64_t hits;
+
+        ///
+        /// @brief  The number of glyphs that had to be rasterized.
+        ///
+        uint64_t misses;
+
+        ///
+        /// @brief  The number of glyphs removed to make room for others.
+        ///
+        uint64_t evictions;
+
+        ///
+        /// @brief  The number of glyphs that could not be added because every shelf they fit on
+        ///         was used in the same frame.
+        ///
+        uint64_t failures;
+
+    } glyph_atlas_stats_t;
+
+    ///
+    /// @brief  Rasterizes glyphs into a single-channel texture the first time they are drawn and
+    ///         keeps them there. Glyphs are packed onto shelves, rows as tall as the tallest glyph
+    ///         on them, which suits glyphs since those of one size have similar heights. When the
+    ///         texture is full, the shelf that was drawn from least recently is emptied, unless it
+    ///         was drawn from in the current frame.
+    ///
+    ///         A distance field atlas rasterizes every glyph at one size, so that a glyph drawn at
+    ///         many sizes, such as in windows of different scales, takes room only once. The
+    ///         boxes of its glyphs are scaled to the size they are drawn at.
+    ///
+    ///         An atlas must only be used on the renderer's API thread, where its texture is
+    ///         created the first time a glyph is added.
+    ///
+    class glyph_atlas : public utl::unique
+    {
+        private:
+            ///
+            /// @brief  Identifies a glyph at a size.
+            ///
+            typedef struct glyph_key
+            {
+                ///
+                /// @brief  The identifier of the font.
+                ///
+                uint32_t font_id;
+
+                ///
+                /// @brief  The index of the glyph in the font.
+                ///
+                uint32_t glyph;
+
+                ///
+                /// @brief  The height of a line in pixels.
+                ///
+                px_t size;
+
+                ///
+                /// @brief  Determines whether two keys identify the same glyph.
+                ///
+                /// @param  other   the other key
+                ///
+                /// @return true if and only if the keys are equal
+                ///
+                bool operator==(const glyph_key &other) const noexcept;
+
+            } glyph_key_t;
+
+            ///
+            /// @brief  Hashes the keys of glyphs.
+            ///
+            struct glyph_key_hash
+            {
+                ///
+                /// @brief  Hashes a key.
+                ///
+                /// @param  key the key
+                ///
+                /// @return the hash
+                ///
+                size_t operator()(const glyph_key_t &key) const noexcept;
+            };
+
+            ///
+            /// @brief  A glyph and the shelf it is on.
+            ///
+            typedef struct entry
+            {
+                ///
+                /// @brief  The glyph.
+                ///
+                atlas_glyph_t glyph;
+
+                ///
+                /// @brief  The index of the shelf, or UINT16_MAX if the glyph draws nothing and is
+                ///         on no shelf.
+                ///
+                uint16_t shelf;
+
+            } entry_t;
+
+            ///
+            /// @brief  A row of glyphs.
+            ///
+            typedef struct shelf
+            {
+                ///
+                /// @brief  The top edge of the row.
+                ///
+                uint16_t y;
+
+                ///
+                /// @brief  The height of the row.
+                ///
+                uint16_t height;
+
+                ///
+                /// @brief  The width of the row that is used.
+                ///
+                uint16_t used_width;
+
+                ///
+                /// @brief  The last frame a glyph on the row was drawn in.
+                ///
+                uint64_t last_used;
+
+            } shelf_t;
+
+            ///
+            /// @brief  The width and height of the texture in pixels.
+            ///
+            uint16_t m_size;
+
+            ///
+            /// @brief  What is stored for each glyph.
+            ///
+            glyph_atlas_mode m_mode;
+
+            ///
+            /// @brief  The texture, invalid until the first glyph is added.
+            ///
+            bgfx::TextureHandle m_texture;
+
+            ///
+            /// @brief  The glyphs by their keys.
+            ///
+            std::unordered_map<glyph_key_t, entry_t, glyph_key_hash> m_glyphs;
+
+            ///
+            /// @brief  The rows from top to bottom.
+            ///
+            std::vector<shelf_t> m_shelves;
+
+            ///
+            /// @brief  The top edge of the space below the last row.
+            ///
+            uint16_t m_free_y;
+
+            ///
+            /// @brief  The current frame.
+            ///
+            uint64_t m_frame;
+
+            ///
+            /// @brief  The bitmap glyphs are rasterized into before they are uploaded. The memory
+            ///         is reused between glyphs.
+            ///
+            std::vector<uint8_t> m_scratch;
+
+            ///
+            /// @brief  The distance field of the glyph being added. The memory is reused between
+            ///         glyphs.
+            ///
+            std::vector<uint8_t> m_field;
+
+            ///
+            /// @brief  Counts the glyphs that were and were not in the atlas.
+            ///
+            glyph_atlas_stats_t m_stats;
+
+            ///
+            /// @brief  Finds a place for a glyph, emptying the least recently used shelf it fits on
+            ///         if there is no room.
+            ///
+            /// @param  width   the width including the padding
+            /// @param  height  the height including the padding
+            /// @param  x       set to the left edge of the place
+            /// @param  y       set to the top edge of the place
+            ///
+            /// @return the index of the shelf, or UINT16_MAX if there is no place
+            ///
+            uint16_t allocate(uint16_t width, uint16_t height, uint16_t &x, uint16_t &y);
+
+            ///
+            /// @brief  Removes every glyph on a shelf so that the shelf can be filled again.
+            ///
+            /// @param  index   the index of the shelf
+            ///
+            void evict(uint16_t index) noexcept;
+
+        public:
+            ///
+            /// @brief  Constructs an empty atlas. Nothing is created with bgfx until the first
+            ///         glyph is added.
+            ///
+            /// @param  size    the width and height of the texture in pixels
+            /// @param  mode    what to store for each glyph
+            ///
+            glyph_atlas(uint16_t size = LEAF_GLYPH_ATLAS_SIZE,
+                glyph_atlas_mode mode = glyph_atlas_mode::bitmap) noexcept;
+
+            ///
+            /// @brief      Destroys the atlas.
+            ///
+            /// @warning    The bgfx resources must have been destroyed on the API thread first.
+            ///
+            ~glyph_atlas(void) noexcept;
+
+            ///
+            /// @brief  Returns what is stored for each glyph.
+            ///
+            /// @return the mode
+            ///
+            glyph_atlas_mode mode(void) const noexcept;
+
+            ///
+            /// @brief  Determines the size glyphs drawn at a size are rasterized at.
+            ///
+            /// @param  size    the height of a line in pixels the glyphs are drawn at
+            ///
+            /// @return the size itself, or LEAF_GLYPH_ATLAS_SDF_SIZE for a distance field atlas
+            ///
+            px_t raster_size(px_t size) const noexcept;
+
+            ///
+            /// @brief  Starts a new frame. Glyphs found before this may be removed to make room.
+            ///
+            void next_frame(void) noexcept;
+
+            ///
+            /// @brief  Finds a glyph, rasterizing it into the texture if it is not in the atlas.
+            ///
+            /// @param  face    the font of the glyph
+            /// @param  glyph   the index of the glyph in the font
+            /// @param  size    the height of a line in pixels
+            ///
+            /// @return the glyph, or null if there is no room for it in this frame
+            ///
+            const atlas_glyph_t *find(const font &face, uint32_t glyph, px_t size) noexcept;
+
+            ///
+            /// @brief  Returns the texture the glyphs are in. Its only channel is the coverage or
+            ///         the distance field.
+            ///
+            /// @return the texture, invalid if no glyph was added
+            ///
+            bgfx::TextureHandle texture(void) const noexcept;
+
+            ///
+            /// @brief  Determines how many glyphs are in the atlas.
+            ///
+            /// @return the number of glyphs
+            ///
+            size_t glyph_count(void) const noexcept;
+
+            ///
+            /// @brief  Returns how often glyphs were found.
+            ///
+            /// @return the counters
+            ///
+            const glyph_atlas_stats_t &stats(void) const noexcept;
+
+            ///
+            /// @brief  Destroys the texture and removes every glyph. This must be called on the API
+            ///         thread before bgfx shuts down.
+            ///
+            void destroy_resources(void) noexcept;
+    };
+}
+
+#endif
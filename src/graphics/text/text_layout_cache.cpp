@@ -0,0 +1,260 @@
+///
+/// @file       text_layout_cache.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a class that lays out text into glyphs and remembers the most
+///             recently used layouts.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include "text_layout_cache.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    ///
+    /// @brief  Decodes the next character of UTF-8 text. Bytes that do not form a character are
+    ///         decoded as the replacement character one at a time.
+    ///
+    /// @param  text    the text
+    /// @param  index   the index of the first byte of the character, moved past it
+    ///
+    /// @return the character
+    ///
+    static uint32_t decode_utf8(const string &text, size_t &index) noexcept
+    {
+        uint8_t lead = (uint8_t)text[index++];
+
+        // Find the length of the character from its first byte.
+        size_t length = lead < 0x80 ? 0 : (lead & 0xe0) == 0xc0 ? 1 : (lead & 0xf0) == 0xe0 ? 2
+            : (lead & 0xf8) == 0xf0 ? 3 : 4;
+
+        if (length == 0)
+        {
+            return lead;
+        }
+
+        if (length > 3 || index + length > text.size())
+        {
+            return 0xfffd;
+        }
+
+        // Add 6 bits from each continuation byte.
+        uint32_t codepoint = lead & (0x3f >> length);
+
+        for (size_t i = 0; i < length; i++)
+        {
+            uint8_t next = (uint8_t)text[index + i];
+
+            if ((next & 0xc0) != 0x80)
+            {
+                return 0xfffd;
+            }
+
+            codepoint = (codepoint << 6) | (next & 0x3f);
+        }
+
+        index += length;
+
+        return codepoint;
+    }
+
+    bool text_layout_cache::layout_key::operator==(const layout_key &other) const noexcept
+    {
+        // Compare the cheap fields first.
+        return font_id == other.font_id && size == other.size && max_width == other.max_width
+            && text == other.text;
+    }
+
+    size_t text_layout_cache::layout_key_hash::operator()(const layout_key_t &key) const noexcept
+    {
+        // Mix the fields into the hash of the text.
+        uint64_t fields = (uint64_t)key.font_id << 32 | (uint64_t)(uint16_t)key.size << 16
+            | (uint16_t)key.max_width;
+
+        return std::hash<string>()(key.text) ^ (size_t)(fields * 0x9e3779b97f4a7c15ull);
+    }
+
+    shared_ptr<text_run_t> text_layout_cache::shape(const string &text,
+        const shared_ptr<const font> &face, px_t size, px_t max_width)
+    {
+        shared_ptr<text_run_t> run(new text_run_t());
+        run->face = face;
+        run->size = size;
+        run->line_count = 1;
+
+        font_metrics_t metrics = face->metrics(size);
+        float baseline = metrics.ascent;
+        float pen = 0;
+        float width = 0;
+        uint32_t previous = 0;
+
+        // Remember the last space on the line, where it can be broken.
+        size_t break_index = SIZE_MAX;
+        float break_pen = 0;
+
+        for (size_t i = 0; i < text.size();)
+        {
+            uint32_t codepoint = decode_utf8(text, i);
+
+            // Start a new line at a newline.
+            if (codepoint == '\n')
+            {
+                width = max(width, pen);
+                baseline += metrics.line_height;
+                pen = 0;
+                previous = 0;
+                break_index = SIZE_MAX;
+                run->line_count++;
+                continue;
+            }
+
+            uint32_t glyph = face->glyph_index(codepoint);
+            float advance = face->advance(glyph, size);
+
+            if (previous)
+            {
+                pen += face->kerning(previous, glyph, size);
+            }
+
+            // Move the word after the last space to a new line if the glyph does not fit. A word
+            // that is wider than the line is left to overflow it.
+            if (codepoint != ' ' && pen + advance > max_width && break_index != SIZE_MAX)
+            {
+                float shift = break_index + 1 < run->glyphs.size()
+                    ? run->glyphs[break_index + 1].x : pen;
+
+                width = max(width, break_pen);
+                baseline += metrics.line_height;
+                pen -= shift;
+                run->line_count++;
+
+                for (size_t j = break_index + 1; j < run->glyphs.size(); j++)
+                {
+                    run->glyphs[j].x -= shift;
+                    run->glyphs[j].y = baseline;
+                }
+
+                break_index = SIZE_MAX;
+            }
+
+            if (codepoint == ' ')
+            {
+                break_index = run->glyphs.size();
+                break_pen = pen;
+            }
+
+            run->glyphs.push_back({glyph, pen, baseline});
+            pen += advance;
+            previous = glyph;
+        }
+
+        // Size the text to its widest line and the lines above the last, which ends at its
+        // descent.
+        width = max(width, pen);
+        float height = baseline + metrics.descent;
+        run->bounds = bounds2_t((px_t)min(ceil(width), (float)INT16_MAX),
+            (px_t)min(ceil(height), (float)INT16_MAX));
+
+        return run;
+    }
+
+    text_layout_cache::text_layout_cache(size_t capacity) noexcept
+        // Start empty with nothing counted.
+        : m_capacity(max(capacity, (size_t)1)), m_stats({0, 0, 0}) {}
+
+    shared_ptr<const text_run_t> text_layout_cache::layout(const string &text,
+        const shared_ptr<const font> &face, px_t size, px_t max_width) noexcept
+    {
+        if (!face)
+        {
+            return NULL;
+        }
+
+        try
+        {
+            layout_key_t key = {text, face->id(), size, max_width};
+            auto found = m_entries.find(key);
+
+            // Move a remembered layout to the front of the order of use.
+            if (found != m_entries.end())
+            {
+                m_order.splice(m_order.begin(), m_order, found->second.order);
+                m_stats.hits++;
+
+                return found->second.run;
+            }
+
+            m_stats.misses++;
+            shared_ptr<const text_run_t> run = shape(text, face, size, max_width);
+
+            // Forget the least recently used layout to make room.
+            if (m_entries.size() >= m_capacity)
+            {
+                auto oldest = m_entries.find(*m_order.back());
+                m_order.pop_back();
+                m_entries.erase(oldest);
+                m_stats.evictions++;
+            }
+
+            auto inserted = m_entries.emplace(std::move(key), entry_t{run, m_order.end()});
+
+            try
+            {
+                m_order.push_front(&inserted.first->first);
+            }
+            catch (const exception &)
+            {
+                m_entries.erase(inserted.first);
+                return run;
+            }
+
+            inserted.first->second.order = m_order.begin();
+
+            return run;
+        }
+        catch (const exception &)
+        {
+            return NULL;
+        }
+    }
+
+    size_t text_layout_cache::size(void) const noexcept
+    {
+        // Return the number of remembered layouts.
+        return m_entries.size();
+    }
+
+    size_t text_layout_cache::capacity(void) const noexcept
+    {
+        // Return the capacity.
+        return m_capacity;
+    }
+
+    void text_layout_cache::clear(void) noexcept
+    {
+        // Forget the layouts. The runs stay alive while they are used.
+        m_order.clear();
+        m_entries.clear();
+    }
+
+    const text_layout_cache_stats_t &text_layout_cache::stats(void) const noexcept
+    {
+        // Return the counters.
+        return m_stats;
+    }
+
+    double text_layout_cache::hit_rate(void) const noexcept
+    {
+        // Divide the hits by the lookups.
+        uint64_t lookups = m_stats.hits + m_stats.misses;
+
+        return lookups ? (double)m_stats.hits / lookups : 0.0;
+    }
+}
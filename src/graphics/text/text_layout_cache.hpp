@@ -0,0 +1,228 @@
+///
+/// @file       text_layout_cache.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a class that lays out text into glyphs and remembers the most recently
+///             used layouts.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_TEXT_LAYOUT_CACHE_HEADER_GUARD
+#define LEAF_SRC_TEXT_LAYOUT_CACHE_HEADER_GUARD
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "../../utils/unique.hpp"
+#include "../graphics_types.hpp"
+#include "font.hpp"
+#include "text_run.hpp"
+
+///
+/// @brief  The number of layouts a text layout cache remembers by default.
+///
+#define LEAF_TEXT_LAYOUT_CACHE_CAPACITY 1024
+
+namespace leaf
+{
+    ///
+    /// @brief  Counts how often a text layout cache found a layout it remembered.
+    ///
+    typedef struct text_layout_cache_stats
+    {
+        ///
+        /// @brief  The number of layouts that were remembered.
+        ///
+        uint64_t hits;
+
+        ///
+        /// @brief  The number of layouts that had to be laid out.
+        ///
+        uint64_t misses;
+
+        ///
+        /// @brief  The number of layouts forgotten to make room for others.
+        ///
+        uint64_t evictions;
+
+    } text_layout_cache_stats_t;
+
+    ///
+    /// @brief  Lays out text into glyphs and remembers the most recently used layouts by their
+    ///         text, font, size, and width, so that text that does not change is laid out only
+    ///         once. Characters are mapped to glyphs one to one and placed by their advances and
+    ///         the kerning of the font. Lines break at newlines and, when a width is given, at the
+    ///         last space that keeps the line inside it.
+    ///
+    ///         A cache must only be used by one thread, usually the one that polls window events.
+    ///         The layouts it returns can be shared with any thread.
+    ///
+    class text_layout_cache : public utl::unique
+    {
+        private:
+            ///
+            /// @brief  Identifies a layout.
+            ///
+            typedef struct layout_key
+            {
+                ///
+                /// @brief  The text.
+                ///
+                std::string text;
+
+                ///
+                /// @brief  The identifier of the font.
+                ///
+                uint32_t font_id;
+
+                ///
+                /// @brief  The height of a line in pixels.
+                ///
+                px_t size;
+
+                ///
+                /// @brief  The width the text was wrapped to.
+                ///
+                px_t max_width;
+
+                ///
+                /// @brief  Determines whether two keys identify the same layout.
+                ///
+                /// @param  other   the other key
+                ///
+                /// @return true if and only if the keys are equal
+                ///
+                bool operator==(const layout_key &other) const noexcept;
+
+            } layout_key_t;
+
+            ///
+            /// @brief  Hashes the keys of layouts.
+            ///
+            struct layout_key_hash
+            {
+                ///
+                /// @brief  Hashes a key.
+                ///
+                /// @param  key the key
+                ///
+                /// @return the hash
+                ///
+                size_t operator()(const layout_key_t &key) const noexcept;
+            };
+
+            ///
+            /// @brief  A remembered layout.
+            ///
+            typedef struct entry
+            {
+                ///
+                /// @brief  The layout.
+                ///
+                std::shared_ptr<const text_run_t> run;
+
+                ///
+                /// @brief  The position of the key in the order of use.
+                ///
+                std::list<const layout_key_t *>::iterator order;
+
+            } entry_t;
+
+            ///
+            /// @brief  The keys of the remembered layouts, the most recently used first. The keys
+            ///         are owned by the map, which never moves them.
+            ///
+            std::list<const layout_key_t *> m_order;
+
+            ///
+            /// @brief  The remembered layouts by their keys.
+            ///
+            std::unordered_map<layout_key_t, entry_t, layout_key_hash> m_entries;
+
+            ///
+            /// @brief  The number of layouts remembered at most.
+            ///
+            size_t m_capacity;
+
+            ///
+            /// @brief  Counts the layouts that were and were not remembered.
+            ///
+            text_layout_cache_stats_t m_stats;
+
+        public:
+            ///
+            /// @brief  Lays out text without remembering it.
+            ///
+            /// @param  text        the text in UTF-8
+            /// @param  face        the font to lay out with
+            /// @param  size        the height of a line in pixels
+            /// @param  max_width   the width to wrap the text to, or LEAF_TEXT_UNWRAPPED
+            ///
+            /// @return the layout
+            ///
+            static std::shared_ptr<text_run_t> shape(const std::string &text,
+                const std::shared_ptr<const font> &face, px_t size, px_t max_width);
+
+            ///
+            /// @brief  Constructs an empty cache.
+            ///
+            /// @param  capacity    the number of layouts to remember at most
+            ///
+            text_layout_cache(size_t capacity = LEAF_TEXT_LAYOUT_CACHE_CAPACITY) noexcept;
+
+            ///
+            /// @brief  Returns the layout of text, laying it out only if it is not remembered. The
+            ///         least recently used layout is forgotten if there are too many.
+            ///
+            /// @param  text        the text in UTF-8
+            /// @param  face        the font to lay out with
+            /// @param  size        the height of a line in pixels
+            /// @param  max_width   the width to wrap the text to, or LEAF_TEXT_UNWRAPPED
+            ///
+            /// @return the layout, or null if there was no font or not enough memory
+            ///
+            std::shared_ptr<const text_run_t> layout(const std::string &text,
+                const std::shared_ptr<const font> &face, px_t size,
+                px_t max_width = LEAF_TEXT_UNWRAPPED) noexcept;
+
+            ///
+            /// @brief  Determines how many layouts are remembered.
+            ///
+            /// @return the number of layouts
+            ///
+            size_t size(void) const noexcept;
+
+            ///
+            /// @brief  Returns the number of layouts remembered at most.
+            ///
+            /// @return the capacity
+            ///
+            size_t capacity(void) const noexcept;
+
+            ///
+            /// @brief  Forgets every layout. Layouts that were returned stay valid.
+            ///
+            void clear(void) noexcept;
+
+            ///
+            /// @brief  Returns how often layouts were remembered.
+            ///
+            /// @return the counters
+            ///
+            const text_layout_cache_stats_t &stats(void) const noexcept;
+
+            ///
+            /// @brief  Determines the fraction of layouts that were remembered.
+            ///
+            /// @return the hit rate between 0 and 1, or 0 if nothing was laid out
+            ///
+            double hit_rate(void) const noexcept;
+    };
+}
+
+#endif
@@ -0,0 +1,79 @@
+///
+/// @file       text_run.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for type definitions that describe text laid out into glyphs.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_TEXT_RUN_HEADER_GUARD
+#define LEAF_SRC_TEXT_RUN_HEADER_GUARD
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "../graphics_types.hpp"
+#include "font.hpp"
+
+///
+/// @brief  The width given to lay out text that is never wrapped.
+///
+#define LEAF_TEXT_UNWRAPPED ((leaf::px_t)INT16_MAX)
+
+namespace leaf
+{
+    ///
+    /// @brief  A glyph placed in laid out text.
+    ///
+    typedef struct positioned_glyph
+    {
+        ///
+        /// @brief  The index of the glyph in the font.
+        ///
+        uint32_t glyph;
+
+        ///
+        /// @brief  The position of the pen relative to the top-left corner of the text, with y on
+        ///         the baseline, in pixels.
+        ///
+        float x, y;
+
+    } positioned_glyph_t;
+
+    ///
+    /// @brief  Text laid out into glyphs with a font and size. A run never changes once it is laid
+    ///         out, so it can be shared between threads and drawn while it is being laid out again.
+    ///
+    typedef struct text_run
+    {
+        ///
+        /// @brief  The font the glyphs belong to.
+        ///
+        std::shared_ptr<const font> face;
+
+        ///
+        /// @brief  The height of a line in pixels.
+        ///
+        px_t size;
+
+        ///
+        /// @brief  The size of the laid out text, rounded up to whole pixels.
+        ///
+        bounds2_t bounds;
+
+        ///
+        /// @brief  The number of lines the text was wrapped into.
+        ///
+        uint32_t line_count;
+
+        ///
+        /// @brief  The glyphs in the order of the text.
+        ///
+        std::vector<positioned_glyph_t> glyphs;
+
+    } text_run_t;
+}
+
+#endif
@@ -9,9 +9,14 @@
 /// 
 
 #include <iostream>
+#include <memory>
+#include <string>
 #include "../utils/console.hpp"
+#include "../utils/trace.hpp"
 #include "../window/managed/sdl/sdl.hpp"
+#include "../window/managed/sdl/sdl_event_recorder.hpp"
 #include "../window/managed/sdl/sdl_window.hpp"
+#include "../graphics/render/renderer.hpp"
 
 using namespace std;
 using namespace utl;
@@ -19,6 +24,12 @@ using namespace leaf;
 
 class event_handler : virtual public window_event_handler_i
 {
+    renderer *m_renderer;
+
+public:
+    event_handler(renderer *renderer) : m_renderer(renderer) {}
+
+private:
     virtual void closed(void) noexcept override
     {
         cout << "Closed\n";
@@ -32,6 +43,7 @@ class event_handler : virtual public window_event_handler_i
     virtual void resized(const bounds2_t &bounds) noexcept override
     {
         cout << "Resized: " << bounds << '\n';
+        m_renderer->resize(m_renderer->primary(), bounds);
     }
 
     virtual void moved(const pos2_t &pos, const pos2_t &frame_pos) noexcept override
@@ -44,6 +56,33 @@ int main(int argc, char **argv)
 {
     try
     {
+        // Parse the command line options. The events of the session can be recorded so that it
+        // can be replayed later, the frame statistics overlay can be shown, and the session can
+        // be traced.
+        unique_ptr<sdl_event_recorder> recorder;
+        bool show_overlay = false;
+        string trace_path;
+
+        for (int i = 1; i < argc; i++)
+        {
+            string arg = argv[i];
+
+            if (arg == "--record" && i + 1 < argc)
+            {
+                recorder.reset(new sdl_event_recorder(argv[++i]));
+            }
+            else if (arg == "--overlay")
+            {
+                show_overlay = true;
+            }
+            else if (arg == "--trace" && i + 1 < argc)
+            {
+                trace_path = argv[++i];
+                trace::set_thread_name("main");
+                trace::set_enabled(true);
+            }
+        }
+
         sdl_window window1("Test1", 100, 100, 200, 200);
         sdl_window window2("Test2", 200, 128, 200, 200);
         sdl_window window3("Test3", 300, 156, 200, 200);
@@ -52,19 +91,43 @@ int main(int argc, char **argv)
         window2.set_visible(true)->set_user_resizable(true)->focus();
         window3.set_visible(true)->set_user_resizable(true)->focus();
 
-        event_handler event_handler1;
+        // Let the event loop execute the frames the renderer submits.
+        renderer renderer1(&window1);
+        renderer1.set_overlay_visible(show_overlay);
+        sdl::instance.set_frame_hook(renderer::render_frame);
+        event_handler event_handler1(&renderer1);
 
         window2.close();
         window3.close();
 
-        window1.event_manager()->subscribe(&event_handler1);
+        window1.event_manager()->subscribe_overridden(&event_handler1);
         
-        while (sdl::instance.poll_events())
+        // Sleep between events instead of spinning. The timeout bounds how long a close flagged
+        // by the program can go unnoticed.
+        while (sdl::instance.wait_events(100))
         {
             //cout << "Surface pos:\t" << window1.pos() << '\n';
             //cout << "Surface bounds:\t" << window1.bounds() << '\n';
             //cout << "Frame pos:\t" << window1.frame_pos() << '\n';
         }
+
+        // The renderer is destroyed at the end of the scope, so stop executing its frames.
+        sdl::instance.set_frame_hook(NULL);
+
+        // Write the trace of the session, if it was traced.
+        if (!trace_path.empty())
+        {
+            trace::set_enabled(false);
+            trace::write_chrome_json(trace_path);
+
+            // Point out that the trace only covers the end of the session if zones were dropped.
+            uint64_t dropped_count = trace::dropped_count();
+
+            if (dropped_count)
+            {
+                console::warn(std::to_string(dropped_count) + " older trace zones were dropped.");
+            }
+        }
     }
     catch (const exception &exc)
     {
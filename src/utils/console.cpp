@@ -13,18 +13,15 @@
 
 namespace utl
 {
-    // By default ANSI style is enabled.
-    bool console::f_ansi_style_enabled(true);
-
     bool console::ansi_style_enabled(void) noexcept
     {
-        // Return whether ANSI style is enabled.
-        return f_ansi_style_enabled;
+        // The logger writes the messages, so it owns the setting.
+        return logger::ansi_style_enabled();
     }
 
     void console::set_ansi_style_enabled(bool enabled) noexcept
     {
-        // Set whether ANSI style is enabled.
-        f_ansi_style_enabled = enabled;
+        // The logger writes the messages, so it owns the setting.
+        logger::set_ansi_style_enabled(enabled);
     }
 }
\ No newline at end of file
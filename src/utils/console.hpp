@@ -4,7 +4,8 @@
 /// @date       February 6, 2023
 /// 
 /// @brief      Header for a class with static functionality to interact with the terminal console
-///             through standard input and standard output.
+///             through standard input and standard output. Messages are written asynchronously by
+///             the logger, except for errors, which are written before exiting.
 /// 
 /// @copyright  Copyright (c) 2023
 /// 
@@ -12,23 +13,20 @@
 #ifndef LEAF_UTIL_SRC_CONSOLE_HEADER_GUARD
 #define LEAF_UTIL_SRC_CONSOLE_HEADER_GUARD
 
-#include <iostream>
+#include <cstdlib>
+#include <exception>
+#include "logger.hpp"
 
 namespace utl
 {
     /// 
     /// @brief  A class with static functionality to interact with the terminal console through
-    ///         standard input and standard output.
+    ///         standard input and standard output. It is a front-end to the logger, so messages
+    ///         are formatted and written by a background thread and the caller never waits on
+    ///         standard output. Errors and warnings are never truncated or dropped (see logger).
     /// 
     class console
     {
-        private:
-            /// 
-            /// @brief  Denotes whether console messages in standard output should contain ANSI
-            ///         escape sequences for styling such as color, bold, italic, etc.
-            /// 
-            static bool f_ansi_style_enabled;
-
         public:
             /// 
             /// @brief  Determines whether console messages in standard output will contain ANSI
@@ -48,7 +46,7 @@ namespace utl
 
             /// 
             /// @brief  Displays a formatted error message in standard output, then exits with the
-            ///         given code.
+            ///         given code. Every message logged before it is written before exiting.
             /// 
             /// @tparam T           the type of object to pipe into standard output as the message
             /// @param  obj         the object to pipe into standard output as the messsage
@@ -56,15 +54,9 @@ namespace utl
             /// 
             template<typename T> static void err(const T &obj, int exit_code) noexcept
             {
-                // Print a styled message if ANSI style is enabled, print a clean message otherwise.
-                if (f_ansi_style_enabled)
-                {
-                    std::cout << "\033[1;91mError:\033[0;1m " << obj << "\033[0m\n";
-                }
-                else
-                {
-                    std::cout << "Error: " << obj << "\n";
-                }
+                // Write the message on this thread, since the background thread will not get the
+                // chance to before exiting.
+                logger::log_now(log_severity::error, obj);
 
                 // Exit with the given exit code.
                 std::exit(exit_code);
@@ -112,22 +104,29 @@ namespace utl
             }
 
             /// 
-            /// @brief  Displays a formatted warning message in standard output.
+            /// @brief  Displays a formatted informational message in standard output. It returns
+            ///         without waiting for the message to be written.
+            /// 
+            /// @tparam T   the type of object to pipe into standard output as the message
+            /// @param  obj the object to pipe into standard output as the messsage
+            /// 
+            template<typename T> static void info(const T &obj) noexcept
+            {
+                // Hand the message to the logger.
+                logger::log(log_severity::info, obj);
+            }
+
+            /// 
+            /// @brief  Displays a formatted warning message in standard output. It returns without
+            ///         waiting for the message to be written.
             /// 
             /// @tparam T   the type of object to pipe into standard output as the message
             /// @param  obj the object to pipe into standard output as the messsage
             /// 
             template<typename T> static void warn(const T &obj) noexcept
             {
-                // Print a styled message if ANSI style is enabled, print a clean message otherwise.
-                if (f_ansi_style_enabled)
-                {
-                    std::cout << "\033[1;93mWarning:\033[0;1m " << obj << "\033[0m\n";
-                }
-                else
-                {
-                    std::cout << "Warning: " << obj << "\n";
-                }
+                // Hand the message to the logger.
+                logger::log(log_severity::warning, obj);
             }
 
             /// 
@@ -7,17 +7,125 @@
 ///             abstract structure that represents a displayable structure. It is displayable in the
 ///             sense that it has a string representation.
 /// 
+///             Values can also be formatted into a buffer provided by the caller with
+///             std::to_chars, which uses no locale and does not allocate.
+/// 
 /// @copyright  Copyright (c) 2023
 /// 
 
 #ifndef LEAF_UTIL_SRC_DISPLAY_HEADER_GUARD
 #define LEAF_UTIL_SRC_DISPLAY_HEADER_GUARD
 
+#include <charconv>
+#include <cstdint>
+#include <cstring>
 #include <ostream>
-#include <sstream>
+#include <string>
+#include <system_error>
+
+///
+/// @brief  The size in bytes of a buffer that holds the display string of any of the small
+///         structures in the project.
+///
+#define LEAF_UTIL_DISPLAY_BUFFER_SIZE 64
 
 namespace utl
 {
+    ///
+    /// @brief  Writes a character into a buffer. Like the other format functions, it does nothing
+    ///         if the buffer is null, so calls can be chained and the result checked once.
+    ///
+    /// @param  first   the position in the buffer to write at or null
+    /// @param  last    the end of the buffer
+    /// @param  c       the character to write
+    ///
+    /// @return the position after the character or null if it did not fit
+    ///
+    inline char *format_char(char *first, char *last, char c) noexcept
+    {
+        // Make sure there is room for the character.
+        if (!first || first == last)
+        {
+            return NULL;
+        }
+
+        *first = c;
+        return first + 1;
+    }
+
+    ///
+    /// @brief  Writes a string into a buffer without its null terminator.
+    ///
+    /// @param  first   the position in the buffer to write at or null
+    /// @param  last    the end of the buffer
+    /// @param  str     the null-terminated string to write
+    ///
+    /// @return the position after the string or null if it did not fit
+    ///
+    inline char *format_str(char *first, char *last, const char *str) noexcept
+    {
+        size_t length = strlen(str);
+
+        // Make sure there is room for the whole string.
+        if (!first || (size_t)(last - first) < length)
+        {
+            return NULL;
+        }
+
+        memcpy(first, str, length);
+        return first + length;
+    }
+
+    ///
+    /// @brief  Writes an integer into a buffer in decimal.
+    ///
+    /// @param  first   the position in the buffer to write at or null
+    /// @param  last    the end of the buffer
+    /// @param  integer the integer to write
+    ///
+    /// @return the position after the integer or null if it did not fit
+    ///
+    inline char *format_int(char *first, char *last, long long int integer) noexcept
+    {
+        if (!first)
+        {
+            return NULL;
+        }
+
+        // Convert the integer without consulting the locale.
+        std::to_chars_result result = std::to_chars(first, last, integer);
+        return result.ec == std::errc() ? result.ptr : NULL;
+    }
+
+    ///
+    /// @brief  Writes a pointer into a buffer. Either the hexadecimal value is written or 'NULL' if
+    ///         the value is 0x0.
+    ///
+    /// @param  first   the position in the buffer to write at or null
+    /// @param  last    the end of the buffer
+    /// @param  ptr     the pointer to write
+    ///
+    /// @return the position after the pointer or null if it did not fit
+    ///
+    inline char *format_ptr(char *first, char *last, const void *ptr) noexcept
+    {
+        if (!ptr)
+        {
+            return format_str(first, last, "NULL");
+        }
+
+        // Write the address in hexadecimal with a prefix, as streams do.
+        first = format_str(first, last, "0x");
+
+        if (!first)
+        {
+            return NULL;
+        }
+
+        std::to_chars_result result = std::to_chars(first, last, (uintptr_t)ptr, 16);
+        return result.ec == std::errc() ? result.ptr : NULL;
+    }
+
     /// 
     /// @brief  Converts an integer to a displayable string.
     /// 
@@ -27,14 +135,13 @@ namespace utl
     /// 
     inline std::string int_to_str(long long int integer) noexcept
     {
-        // Create a bufferfed string stream to use for building a string.
-        std::stringstream stream;
-
-        // Insert the number into the string stream.
-        stream << integer;
+        // Format the number into a buffer on the stack. Any integer fits, and the string it is
+        // copied into is short enough not to allocate.
+        char buffer[LEAF_UTIL_DISPLAY_BUFFER_SIZE];
+        char *end = format_int(buffer, buffer + sizeof(buffer), integer);
 
-        // Return the buffer from the string stream.
-        return stream.str();
+        // Return the formatted characters.
+        return std::string(buffer, end);
     }
 
     /// 
@@ -47,22 +154,12 @@ namespace utl
     /// 
     inline std::string ptr_to_str(void *ptr) noexcept
     {
-        // Create a bufferfed string stream to use for building a string.
-        std::stringstream stream;
+        // Format the pointer into a buffer on the stack. Any pointer fits.
+        char buffer[LEAF_UTIL_DISPLAY_BUFFER_SIZE];
+        char *end = format_ptr(buffer, buffer + sizeof(buffer), ptr);
 
-        // If the pointer is not null, insert its value into the string stream. Otherwise, insert
-        // the value 'NULL' into the string stream.
-        if (ptr)
-        {
-            stream << ptr;
-        }
-        else
-        {
-            stream << "NULL";
-        }
-
-        // Return the buffer from the string stream.
-        return stream.str();
+        // Return the formatted characters.
+        return std::string(buffer, end);
     }
 
     /// 
@@ -82,9 +179,18 @@ namespace utl
         inline friend std::ostream &operator<<(
             std::ostream &stream, const displayable &displayable) noexcept
         {
-            // Convert the displayable structure to a string and insert it into the stream. Return
-            // the stream for chaining.
-            return stream << displayable.to_string();
+            // Format the displayable structure into a buffer on the stack and write it into the
+            // stream. Only fall back to a display string if it does not fit.
+            char buffer[LEAF_UTIL_DISPLAY_BUFFER_SIZE];
+            char *end = displayable.format(buffer, buffer + sizeof(buffer));
+
+            if (!end)
+            {
+                return stream << displayable.to_string();
+            }
+
+            // Return the stream for chaining.
+            return stream.write(buffer, end - buffer);
         }
 
         /// 
@@ -94,6 +200,22 @@ namespace utl
         /// 
         virtual std::string to_string(void) const noexcept = 0;
 
+        ///
+        /// @brief  Writes the display string of the structure into a buffer without allocating.
+        ///         By default the display string is created and copied, so structures that
+        ///         format often should override it.
+        ///
+        /// @param  first   the position in the buffer to write at or null
+        /// @param  last    the end of the buffer
+        ///
+        /// @return the position after the display string or null if it did not fit
+        ///
+        virtual char *format(char *first, char *last) const noexcept
+        {
+            // Copy the display string into the buffer.
+            return format_str(first, last, to_string().c_str());
+        }
+
     } displayable_t;
 }
 
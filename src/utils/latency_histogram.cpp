@@ -0,0 +1,155 @@
+///
+/// @file       latency_histogram.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a fixed-size histogram of durations in nanoseconds with
+///             logarithmic buckets, used to summarize latencies without storing every sample.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <cmath>
+#include <cstring>
+#include "latency_histogram.hpp"
+
+namespace utl
+{
+    latency_histogram::latency_histogram(void) noexcept
+    {
+        // Start with no recorded durations.
+        reset();
+    }
+
+    size_t latency_histogram::bucket_index(uint64_t duration_ns) noexcept
+    {
+        // Durations below the number of sub-buckets each have a bucket of their own.
+        if (duration_ns < LEAF_UTIL_LATENCY_HISTOGRAM_SUB_BUCKETS)
+        {
+            return (size_t)duration_ns;
+        }
+
+        // Find the power of 2 the duration falls in, then the sub-bucket from the bits that follow
+        // its highest set bit.
+        uint32_t magnitude = 63 - (uint32_t)__builtin_clzll(duration_ns);
+        uint32_t shift = magnitude - LEAF_UTIL_LATENCY_HISTOGRAM_SUB_BUCKET_BITS;
+        size_t sub_bucket =
+            (size_t)(duration_ns >> shift) & (LEAF_UTIL_LATENCY_HISTOGRAM_SUB_BUCKETS - 1);
+
+        return (shift + 1) * LEAF_UTIL_LATENCY_HISTOGRAM_SUB_BUCKETS + sub_bucket;
+    }
+
+    uint64_t latency_histogram::bucket_upper_bound(size_t index) noexcept
+    {
+        // The exact buckets hold a single duration.
+        if (index < LEAF_UTIL_LATENCY_HISTOGRAM_SUB_BUCKETS)
+        {
+            return (uint64_t)index;
+        }
+
+        // Reverse the index computation to find the lower bound and width of the bucket.
+        uint32_t shift = (uint32_t)(index / LEAF_UTIL_LATENCY_HISTOGRAM_SUB_BUCKETS) - 1;
+        uint64_t sub_bucket = index % LEAF_UTIL_LATENCY_HISTOGRAM_SUB_BUCKETS;
+        uint64_t lower_bound = (LEAF_UTIL_LATENCY_HISTOGRAM_SUB_BUCKETS + sub_bucket) << shift;
+
+        return lower_bound + (((uint64_t)1 << shift) - 1);
+    }
+
+    void latency_histogram::merge(const latency_histogram &other) noexcept
+    {
+        // Add the bucket counts and combine the summary statistics.
+        for (size_t i = 0; i < LEAF_UTIL_LATENCY_HISTOGRAM_BUCKETS; i++)
+        {
+            m_bucket_counts[i] += other.m_bucket_counts[i];
+        }
+
+        m_count += other.m_count;
+        m_sum_ns += other.m_sum_ns;
+
+        if (other.m_min_ns < m_min_ns)
+        {
+            m_min_ns = other.m_min_ns;
+        }
+
+        if (other.m_max_ns > m_max_ns)
+        {
+            m_max_ns = other.m_max_ns;
+        }
+    }
+
+    void latency_histogram::reset(void) noexcept
+    {
+        // Clear every bucket and the summary statistics. The minimum starts at the largest value
+        // so that the first duration replaces it.
+        memset(m_bucket_counts, 0, sizeof(m_bucket_counts));
+        m_count = 0;
+        m_sum_ns = 0;
+        m_min_ns = UINT64_MAX;
+        m_max_ns = 0;
+    }
+
+    uint64_t latency_histogram::count(void) const noexcept
+    {
+        // Return the number of recorded durations.
+        return m_count;
+    }
+
+    uint64_t latency_histogram::min_ns(void) const noexcept
+    {
+        // The minimum is only meaningful once a duration has been recorded.
+        return m_count ? m_min_ns : 0;
+    }
+
+    uint64_t latency_histogram::max_ns(void) const noexcept
+    {
+        // Return the longest recorded duration, which is 0 if none were recorded.
+        return m_max_ns;
+    }
+
+    double latency_histogram::mean_ns(void) const noexcept
+    {
+        // Divide the sum of the durations by their number.
+        return m_count ? (double)m_sum_ns / (double)m_count : 0.0;
+    }
+
+    uint64_t latency_histogram::percentile_ns(double percentile) const noexcept
+    {
+        // With nothing recorded there is no percentile to estimate.
+        if (!m_count)
+        {
+            return 0;
+        }
+
+        // Determine how many durations lie at or below the percentile. At least one does.
+        double clamped = percentile < 0.0 ? 0.0 : (percentile > 100.0 ? 100.0 : percentile);
+        uint64_t rank = (uint64_t)std::ceil(clamped / 100.0 * (double)m_count);
+
+        if (rank == 0)
+        {
+            rank = 1;
+        }
+
+        // Walk the buckets until the rank is reached and report the upper bound of that bucket,
+        // clamped to the recorded range.
+        uint64_t seen = 0;
+
+        for (size_t i = 0; i < LEAF_UTIL_LATENCY_HISTOGRAM_BUCKETS; i++)
+        {
+            seen += m_bucket_counts[i];
+
+            if (seen >= rank)
+            {
+                uint64_t upper_bound = bucket_upper_bound(i);
+
+                if (upper_bound > m_max_ns)
+                {
+                    return m_max_ns;
+                }
+
+                return upper_bound < m_min_ns ? m_min_ns : upper_bound;
+            }
+        }
+
+        return m_max_ns;
+    }
+}
@@ -0,0 +1,172 @@
+///
+/// @file       latency_histogram.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a fixed-size histogram of durations in nanoseconds with logarithmic
+///             buckets, used to summarize latencies without storing every sample.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_UTIL_SRC_LATENCY_HISTOGRAM_HEADER_GUARD
+#define LEAF_UTIL_SRC_LATENCY_HISTOGRAM_HEADER_GUARD
+
+#include <cstddef>
+#include <cstdint>
+
+///
+/// @brief  The base 2 logarithm of the number of linear sub-buckets each power of 2 is split into.
+///         With 2 bits, every bucket is at most 25% wider than its lower bound.
+///
+#define LEAF_UTIL_LATENCY_HISTOGRAM_SUB_BUCKET_BITS 2
+
+///
+/// @brief  The number of linear sub-buckets each power of 2 is split into.
+///
+#define LEAF_UTIL_LATENCY_HISTOGRAM_SUB_BUCKETS (1 << LEAF_UTIL_LATENCY_HISTOGRAM_SUB_BUCKET_BITS)
+
+///
+/// @brief  The number of buckets needed to cover every 64-bit duration.
+///
+#define LEAF_UTIL_LATENCY_HISTOGRAM_BUCKETS \
+    ((64 - LEAF_UTIL_LATENCY_HISTOGRAM_SUB_BUCKET_BITS + 1) \
+        * LEAF_UTIL_LATENCY_HISTOGRAM_SUB_BUCKETS)
+
+namespace utl
+{
+    ///
+    /// @brief  A histogram of durations in nanoseconds. Durations below the number of sub-buckets
+    ///         are counted exactly, every larger power of 2 is split into equally wide sub-buckets,
+    ///         so percentiles are reported with a bounded relative error in constant memory.
+    ///         Recording a duration never allocates.
+    ///
+    class latency_histogram
+    {
+        private:
+            ///
+            /// @brief  The number of durations recorded in each bucket.
+            ///
+            uint64_t m_bucket_counts[LEAF_UTIL_LATENCY_HISTOGRAM_BUCKETS];
+
+            ///
+            /// @brief  The number of durations recorded.
+            ///
+            uint64_t m_count;
+
+            ///
+            /// @brief  The sum of all recorded durations in nanoseconds.
+            ///
+            uint64_t m_sum_ns;
+
+            ///
+            /// @brief  The shortest recorded duration in nanoseconds.
+            ///
+            uint64_t m_min_ns;
+
+            ///
+            /// @brief  The longest recorded duration in nanoseconds.
+            ///
+            uint64_t m_max_ns;
+
+            ///
+            /// @brief  Determines which bucket a duration is counted in.
+            ///
+            /// @param  duration_ns the duration in nanoseconds
+            ///
+            /// @return the index of the bucket
+            ///
+            static size_t bucket_index(uint64_t duration_ns) noexcept;
+
+            ///
+            /// @brief  Determines the longest duration counted in a bucket.
+            ///
+            /// @param  index   the index of the bucket
+            ///
+            /// @return the inclusive upper bound of the bucket in nanoseconds
+            ///
+            static uint64_t bucket_upper_bound(size_t index) noexcept;
+
+        public:
+            ///
+            /// @brief  Creates an empty histogram.
+            ///
+            latency_histogram(void) noexcept;
+
+            ///
+            /// @brief  Records a duration.
+            ///
+            /// @param  duration_ns the duration in nanoseconds
+            ///
+            inline void record(uint64_t duration_ns) noexcept
+            {
+                // Count the duration in its bucket and update the summary statistics.
+                m_bucket_counts[bucket_index(duration_ns)]++;
+                m_count++;
+                m_sum_ns += duration_ns;
+
+                if (duration_ns < m_min_ns)
+                {
+                    m_min_ns = duration_ns;
+                }
+
+                if (duration_ns > m_max_ns)
+                {
+                    m_max_ns = duration_ns;
+                }
+            }
+
+            ///
+            /// @brief  Adds every duration recorded in another histogram to this one.
+            ///
+            /// @param  other   the histogram to merge into this one
+            ///
+            void merge(const latency_histogram &other) noexcept;
+
+            ///
+            /// @brief  Removes every recorded duration.
+            ///
+            void reset(void) noexcept;
+
+            ///
+            /// @brief  Determines how many durations have been recorded.
+            ///
+            /// @return the number of recorded durations
+            ///
+            uint64_t count(void) const noexcept;
+
+            ///
+            /// @brief  Determines the shortest recorded duration.
+            ///
+            /// @return the shortest duration in nanoseconds or 0 if none were recorded
+            ///
+            uint64_t min_ns(void) const noexcept;
+
+            ///
+            /// @brief  Determines the longest recorded duration.
+            ///
+            /// @return the longest duration in nanoseconds or 0 if none were recorded
+            ///
+            uint64_t max_ns(void) const noexcept;
+
+            ///
+            /// @brief  Determines the mean of the recorded durations.
+            ///
+            /// @return the mean duration in nanoseconds or 0 if none were recorded
+            ///
+            double mean_ns(void) const noexcept;
+
+            ///
+            /// @brief  Estimates a percentile of the recorded durations. The estimate is the upper
+            ///         bound of the bucket the percentile falls in, clamped to the recorded range,
+            ///         so it never underestimates.
+            ///
+            /// @param  percentile  the percentile between 0 and 100
+            ///
+            /// @return the estimated duration in nanoseconds or 0 if none were recorded
+            ///
+            uint64_t percentile_ns(double percentile) const noexcept;
+    };
+}
+
+#endif
@@ -0,0 +1,31 @@
+///
+/// @file       log_deferred.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a trait that determines which values the logger may copy and format
+///             later on its background thread.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_UTIL_SRC_LOG_DEFERRED_HEADER_GUARD
+#define LEAF_UTIL_SRC_LOG_DEFERRED_HEADER_GUARD
+
+#include <type_traits>
+
+namespace utl
+{
+    ///
+    /// @brief  Determines whether a logged value may be copied as bytes and formatted later. Only
+    ///         values that own everything they print qualify, since the background thread formats
+    ///         the copy after the caller may have freed anything it points to. Numbers and
+    ///         enumerations qualify by default, and other plain types opt in by specializing it.
+    ///
+    /// @tparam T   the type of the logged value
+    ///
+    template<typename T> struct log_deferred
+        : std::integral_constant<bool, std::is_arithmetic<T>::value || std::is_enum<T>::value> {};
+}
+
+#endif
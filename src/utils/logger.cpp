@@ -0,0 +1,377 @@
+///
+/// @file       logger.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a class with static functionality to log messages
+///             asynchronously.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include "logger.hpp"
+
+using namespace std;
+
+namespace utl
+{
+    // By default every message but debug messages is logged with ANSI style to standard output.
+    atomic<log_severity> logger::f_min_severity(log_severity::info);
+
+    atomic<bool> logger::f_ansi_style_enabled(true);
+
+    mutex logger::f_registry_mutex;
+
+    vector<unique_ptr<logger::thread_buffer_t>> logger::f_thread_buffers;
+
+    mutex logger::f_write_mutex;
+
+    ostream *logger::f_output(&cout);
+
+    vector<log_record_t> logger::f_scratch;
+
+    uint64_t logger::f_reported_dropped_count(0);
+
+    thread logger::f_flusher;
+
+    bool logger::f_is_flusher_running(false);
+
+    condition_variable logger::f_flusher_wake;
+
+    logger::thread_buffer_t *logger::this_thread_buffer(void) noexcept
+    {
+        // The buffer is looked up once per thread and owned by the registry.
+        thread_local thread_buffer_t *buffer = NULL;
+
+        if (buffer)
+        {
+            return buffer;
+        }
+
+        // Register a new buffer and make sure the background thread is running to drain it. If
+        // either fails, messages from this thread are dropped or wait for a flush.
+        try
+        {
+            lock_guard<mutex> lock(f_registry_mutex);
+
+            f_thread_buffers.emplace_back(new thread_buffer_t());
+            buffer = f_thread_buffers.back().get();
+
+            if (!f_flusher.joinable())
+            {
+                f_is_flusher_running = true;
+                f_flusher = thread(run_flusher);
+            }
+        }
+        catch (const exception &) {}
+
+        return buffer;
+    }
+
+    void logger::submit(const log_record_t &record) noexcept
+    {
+        thread_buffer_t *buffer = this_thread_buffer();
+
+        if (!buffer)
+        {
+            return;
+        }
+
+        // Push the record without waiting for the background thread. If it has fallen behind,
+        // write warnings and errors on this thread and drop anything else rather than stall the
+        // caller.
+        if (buffer->records.try_push(record))
+        {
+            return;
+        }
+
+        if (record.severity >= log_severity::warning)
+        {
+            write_record_now(record);
+        }
+        else
+        {
+            buffer->dropped_count.fetch_add(1, memory_order_relaxed);
+        }
+    }
+
+    void logger::submit_text(log_record_t &record, const char *text, size_t length) noexcept
+    {
+        // Write warnings and errors too long for the payload in full rather than truncate them.
+        if (record.severity >= log_severity::warning && length >= LEAF_UTIL_LOG_PAYLOAD_SIZE)
+        {
+            write_now(record.severity, text, length);
+            return;
+        }
+
+        capture_text(record, text, length);
+        submit(record);
+    }
+
+    uint64_t logger::now_ns(void) noexcept
+    {
+        // Use the steady clock so that messages from different threads can be ordered.
+        return (uint64_t)chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void logger::format_text(ostream &stream, const unsigned char *payload)
+    {
+        // The payload holds a null-terminated copy of the text.
+        stream << reinterpret_cast<const char *>(payload);
+    }
+
+    void logger::capture_text(log_record_t &record, const char *text, size_t length) noexcept
+    {
+        // Copy as much of the text as fits with its terminator, and end truncated text with an
+        // ellipsis.
+        size_t copied = min(length, (size_t)LEAF_UTIL_LOG_PAYLOAD_SIZE - 1);
+        memcpy(record.payload, text, copied);
+        record.payload[copied] = '\0';
+
+        if (copied < length)
+        {
+            memcpy(record.payload + copied - 3, "...", 3);
+        }
+
+        record.format = format_text;
+    }
+
+    void logger::begin_message(ostream &output, log_severity severity, bool ansi)
+    {
+        // Label the message with its severity, styled if ANSI style is enabled.
+        static const char *const labels[] = {"Debug:", "Info:", "Warning:", "Error:"};
+        static const char *const colors[] = {"\033[1;90m", "\033[1;96m", "\033[1;93m",
+            "\033[1;91m"};
+
+        if (ansi)
+        {
+            output << colors[(size_t)severity] << labels[(size_t)severity] << "\033[0;1m ";
+        }
+        else
+        {
+            output << labels[(size_t)severity] << ' ';
+        }
+    }
+
+    void logger::end_message(ostream &output, bool ansi)
+    {
+        // Reset the style if ANSI style is enabled and end the line.
+        output << (ansi ? "\033[0m\n" : "\n");
+    }
+
+    void logger::write_record_now(const log_record_t &record) noexcept
+    {
+        // Write the pending messages first so that the record keeps its place among them.
+        lock_guard<mutex> lock(f_write_mutex);
+        write_pending();
+
+        try
+        {
+            bool ansi_style_enabled = f_ansi_style_enabled.load(memory_order_relaxed);
+            begin_message(*f_output, record.severity, ansi_style_enabled);
+            record.format(*f_output, record.payload);
+            end_message(*f_output, ansi_style_enabled);
+            f_output->flush();
+        }
+        catch (const exception &) {}
+    }
+
+    void logger::write_now(log_severity severity, const char *text, size_t length) noexcept
+    {
+        // Write the pending messages first so that the text keeps its place among them.
+        lock_guard<mutex> lock(f_write_mutex);
+        write_pending();
+
+        try
+        {
+            bool ansi_style_enabled = f_ansi_style_enabled.load(memory_order_relaxed);
+            begin_message(*f_output, severity, ansi_style_enabled);
+            f_output->write(text, (streamsize)length);
+            end_message(*f_output, ansi_style_enabled);
+            f_output->flush();
+        }
+        catch (const exception &) {}
+    }
+
+    void logger::write_pending(void) noexcept
+    {
+        uint64_t dropped_count = 0;
+
+        try
+        {
+            // Drain every ring while the list of buffers cannot change.
+            f_scratch.clear();
+
+            {
+                lock_guard<mutex> lock(f_registry_mutex);
+
+                for (const unique_ptr<thread_buffer_t> &buffer : f_thread_buffers)
+                {
+                    log_record_t record;
+
+                    while (buffer->records.try_pop(record))
+                    {
+                        f_scratch.push_back(record);
+                    }
+
+                    dropped_count += buffer->dropped_count.load(memory_order_relaxed);
+                }
+            }
+
+            if (f_scratch.empty() && dropped_count == f_reported_dropped_count)
+            {
+                return;
+            }
+
+            // Interleave the messages of all threads in the order they were logged. Messages of
+            // the same thread keep their order.
+            stable_sort(f_scratch.begin(), f_scratch.end(),
+                [](const log_record_t &a, const log_record_t &b)
+                {
+                    return a.time_ns < b.time_ns;
+                });
+
+            // Format each message with a styled label if ANSI style is enabled, otherwise with a
+            // clean one.
+            bool ansi_style_enabled = f_ansi_style_enabled.load(memory_order_relaxed);
+            ostream &output = *f_output;
+
+            for (const log_record_t &record : f_scratch)
+            {
+                begin_message(output, record.severity, ansi_style_enabled);
+                record.format(output, record.payload);
+                end_message(output, ansi_style_enabled);
+            }
+
+            // Report messages dropped since the last report.
+            if (dropped_count > f_reported_dropped_count)
+            {
+                begin_message(output, log_severity::warning, ansi_style_enabled);
+                output << dropped_count - f_reported_dropped_count << " log messages were dropped.";
+                end_message(output, ansi_style_enabled);
+                f_reported_dropped_count = dropped_count;
+            }
+
+            output.flush();
+        }
+        catch (const exception &) {}
+    }
+
+    void logger::run_flusher(void) noexcept
+    {
+        unique_lock<mutex> lock(f_registry_mutex);
+
+        // Write the logged messages at a fixed interval until stopped. The registry mutex is
+        // released while writing so that threads can keep registering.
+        while (f_is_flusher_running)
+        {
+            f_flusher_wake.wait_for(lock, chrono::milliseconds(LEAF_UTIL_LOG_FLUSH_INTERVAL_MS));
+            lock.unlock();
+
+            {
+                lock_guard<mutex> write_lock(f_write_mutex);
+                write_pending();
+            }
+
+            lock.lock();
+        }
+    }
+
+    log_severity logger::min_severity(void) noexcept
+    {
+        // Return the minimum severity.
+        return f_min_severity.load(memory_order_relaxed);
+    }
+
+    void logger::set_min_severity(log_severity severity) noexcept
+    {
+        // Set the minimum severity.
+        f_min_severity.store(severity, memory_order_relaxed);
+    }
+
+    bool logger::ansi_style_enabled(void) noexcept
+    {
+        // Return whether ANSI style is enabled.
+        return f_ansi_style_enabled.load(memory_order_relaxed);
+    }
+
+    void logger::set_ansi_style_enabled(bool enabled) noexcept
+    {
+        // Set whether ANSI style is enabled.
+        f_ansi_style_enabled.store(enabled, memory_order_relaxed);
+    }
+
+    void logger::set_output(ostream &output) noexcept
+    {
+        // Swap the stream while no messages are being written.
+        lock_guard<mutex> lock(f_write_mutex);
+        f_output = &output;
+    }
+
+    void logger::flush(void) noexcept
+    {
+        // Write the pending messages on the calling thread.
+        lock_guard<mutex> lock(f_write_mutex);
+        write_pending();
+    }
+
+    void logger::stop(void) noexcept
+    {
+        thread flusher;
+
+        // Tell the background thread to stop and take ownership of it so it can be joined
+        // without holding the registry mutex.
+        {
+            lock_guard<mutex> lock(f_registry_mutex);
+            f_is_flusher_running = false;
+            flusher = move(f_flusher);
+        }
+
+        f_flusher_wake.notify_all();
+
+        if (flusher.joinable() && flusher.get_id() != this_thread::get_id())
+        {
+            flusher.join();
+        }
+        else if (flusher.joinable())
+        {
+            flusher.detach();
+        }
+
+        // Write whatever was logged while the thread stopped.
+        flush();
+    }
+
+    uint64_t logger::dropped_count(void)
+    {
+        lock_guard<mutex> lock(f_registry_mutex);
+
+        // Sum the dropped messages of every thread.
+        uint64_t count = 0;
+
+        for (const unique_ptr<thread_buffer_t> &buffer : f_thread_buffers)
+        {
+            count += buffer->dropped_count.load(memory_order_relaxed);
+        }
+
+        return count;
+    }
+
+    ///
+    /// @brief  Stops the logger when the program exits. It is defined after the state of the
+    ///         logger, so it is destroyed before that state.
+    ///
+    static struct logger_shutdown
+    {
+        ~logger_shutdown(void)
+        {
+            // Write the remaining messages and join the background thread.
+            logger::stop();
+        }
+
+    } s_logger_shutdown;
+}
@@ -0,0 +1,470 @@
+///
+/// @file       logger.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a class with static functionality to log messages asynchronously. The
+///             logging thread only copies the message into a ring of its own, and a background
+///             thread formats and writes it.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_UTIL_SRC_LOGGER_HEADER_GUARD
+#define LEAF_UTIL_SRC_LOGGER_HEADER_GUARD
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "log_deferred.hpp"
+#include "spsc_ring.hpp"
+
+///
+/// @brief  The number of bytes a log record can hold its message in. Values that fit are copied
+///         and formatted later. Text is truncated to fit, except that warnings and errors that do
+///         not fit are written immediately in full.
+///
+#define LEAF_UTIL_LOG_PAYLOAD_SIZE 232
+
+///
+/// @brief  The number of messages each thread can log before the background thread writes them.
+///         Messages logged while the ring of a thread is full are dropped and counted, except for
+///         warnings and errors, which are written immediately.
+///
+#define LEAF_UTIL_LOG_RING_CAPACITY 512
+
+///
+/// @brief  The longest time in milliseconds a logged message waits before the background thread
+///         writes it.
+///
+#define LEAF_UTIL_LOG_FLUSH_INTERVAL_MS 10
+
+namespace utl
+{
+    ///
+    /// @brief  The severity of a log message, from least to most severe.
+    ///
+    enum class log_severity : uint8_t
+    {
+        debug,
+        info,
+        warning,
+        error
+    };
+
+    ///
+    /// @brief  A message waiting in a ring to be formatted and written.
+    ///
+    typedef struct log_record
+    {
+        ///
+        /// @brief  The time in nanoseconds the message was logged according to the steady clock.
+        ///
+        uint64_t time_ns;
+
+        ///
+        /// @brief  Formats the payload into a stream.
+        ///
+        void (*format)(std::ostream &stream, const unsigned char *payload);
+
+        ///
+        /// @brief  The severity of the message.
+        ///
+        log_severity severity;
+
+        ///
+        /// @brief  The copied value or text of the message.
+        ///
+        alignas(std::max_align_t) unsigned char payload[LEAF_UTIL_LOG_PAYLOAD_SIZE];
+
+    } log_record_t;
+
+    ///
+    /// @brief  A class with static functionality to log messages without blocking. Each thread
+    ///         copies its messages into a ring of its own without locking, and a background thread
+    ///         started by the first message formats and writes them in the order they were logged.
+    ///         Messages below the minimum severity are discarded before anything is copied.
+    ///
+    ///         Formatting is deferred for values that own everything they print, such as numbers
+    ///         and geometry (see log_deferred). Text is copied and truncated to fit. Any other
+    ///         value is formatted on the logging thread.
+    ///
+    ///         Warnings and errors are never truncated or dropped. If one does not fit a record or
+    ///         the ring of its thread is full, the logging thread writes it itself, along with
+    ///         every message logged before it.
+    ///
+    class logger
+    {
+        private:
+            ///
+            /// @brief  The messages logged by a single thread that have not been written yet.
+            ///
+            typedef struct thread_buffer
+            {
+                ///
+                /// @brief  The logged messages. The owning thread pushes them and the thread that
+                ///         writes them pops them.
+                ///
+                spsc_ring<log_record_t> records;
+
+                ///
+                /// @brief  The number of messages dropped because the ring was full.
+                ///
+                std::atomic<uint64_t> dropped_count;
+
+                ///
+                /// @brief  Creates an empty buffer.
+                ///
+                thread_buffer(void) : records(LEAF_UTIL_LOG_RING_CAPACITY), dropped_count(0) {}
+
+            } thread_buffer_t;
+
+            ///
+            /// @brief  The least severe messages that are logged.
+            ///
+            static std::atomic<log_severity> f_min_severity;
+
+            ///
+            /// @brief  Denotes whether written messages contain ANSI escape sequences for styling.
+            ///
+            static std::atomic<bool> f_ansi_style_enabled;
+
+            ///
+            /// @brief  Guards the list of thread buffers and the background thread.
+            ///
+            static std::mutex f_registry_mutex;
+
+            ///
+            /// @brief  The buffers of every thread that has logged a message. They outlive their
+            ///         threads so that messages logged just before a thread exits are written.
+            ///
+            static std::vector<std::unique_ptr<thread_buffer_t>> f_thread_buffers;
+
+            ///
+            /// @brief  Held while messages are written, so that the rings have a single consumer.
+            ///         It also guards the output stream and the scratch records.
+            ///
+            static std::mutex f_write_mutex;
+
+            ///
+            /// @brief  The stream messages are written to.
+            ///
+            static std::ostream *f_output;
+
+            ///
+            /// @brief  The records drained from every ring before they are sorted and written.
+            ///         They are kept so that writing does not allocate once they have grown.
+            ///
+            static std::vector<log_record_t> f_scratch;
+
+            ///
+            /// @brief  The number of dropped messages that have been reported.
+            ///
+            static uint64_t f_reported_dropped_count;
+
+            ///
+            /// @brief  The background thread that writes messages.
+            ///
+            static std::thread f_flusher;
+
+            ///
+            /// @brief  Denotes whether the background thread should keep running.
+            ///
+            static bool f_is_flusher_running;
+
+            ///
+            /// @brief  Wakes the background thread when it should stop.
+            ///
+            static std::condition_variable f_flusher_wake;
+
+            ///
+            /// @brief  Finds the buffer of the calling thread, creating it and starting the
+            ///         background thread on first use.
+            ///
+            /// @return the buffer of the calling thread or null if it could not be created
+            ///
+            static thread_buffer_t *this_thread_buffer(void) noexcept;
+
+            ///
+            /// @brief  Pushes a record into the ring of the calling thread. If the ring is full,
+            ///         warnings and errors are written immediately and other records are counted as
+            ///         dropped.
+            ///
+            /// @param  record  the record to push
+            ///
+            static void submit(const log_record_t &record) noexcept;
+
+            ///
+            /// @brief  Submits text as the message of a record. Warnings and errors that do not fit
+            ///         the payload are written immediately in full instead of being truncated.
+            ///
+            /// @param  record  the record to fill and submit
+            /// @param  text    the text of the message
+            /// @param  length  the length of the text
+            ///
+            static void submit_text(log_record_t &record, const char *text, size_t length)
+                noexcept;
+
+            ///
+            /// @brief  Writes the label of a message, styled if ANSI style is enabled.
+            ///
+            /// @param  output      the stream to write to
+            /// @param  severity    the severity of the message
+            /// @param  ansi        whether ANSI style is enabled
+            ///
+            static void begin_message(std::ostream &output, log_severity severity, bool ansi);
+
+            ///
+            /// @brief  Ends a message started with begin_message.
+            ///
+            /// @param  output  the stream to write to
+            /// @param  ansi    whether ANSI style is enabled
+            ///
+            static void end_message(std::ostream &output, bool ansi);
+
+            ///
+            /// @brief  Writes a record on the calling thread after every message logged before it.
+            ///
+            /// @param  record  the record to write
+            ///
+            static void write_record_now(const log_record_t &record) noexcept;
+
+            ///
+            /// @brief  Reads the clock messages are stamped with.
+            ///
+            /// @return the time in nanoseconds since an arbitrary point
+            ///
+            static uint64_t now_ns(void) noexcept;
+
+            ///
+            /// @brief  Writes the text in a payload.
+            ///
+            /// @param  stream  the stream to write to
+            /// @param  payload the payload holding a null-terminated string
+            ///
+            static void format_text(std::ostream &stream, const unsigned char *payload);
+
+            ///
+            /// @brief  Writes the value in a payload.
+            ///
+            /// @tparam T       the type of the value
+            /// @param  stream  the stream to write to
+            /// @param  payload the payload holding the value
+            ///
+            template<typename T> static void format_value(std::ostream &stream,
+                const unsigned char *payload)
+            {
+                // The value was copied into the payload bytes, so it can be read in place.
+                stream << *reinterpret_cast<const T *>(payload);
+            }
+
+            ///
+            /// @brief  Copies text into the payload of a record, truncating it to fit.
+            ///
+            /// @param  record  the record to fill
+            /// @param  text    the text to copy
+            /// @param  length  the length of the text
+            ///
+            static void capture_text(log_record_t &record, const char *text, size_t length)
+                noexcept;
+
+            ///
+            /// @brief  Formats every record that has been logged and writes it to the output
+            ///         stream in the order the records were logged. The caller must hold the
+            ///         write mutex.
+            ///
+            static void write_pending(void) noexcept;
+
+            ///
+            /// @brief  Writes messages until the logger is stopped. It runs on the background
+            ///         thread.
+            ///
+            static void run_flusher(void) noexcept;
+
+        public:
+            ///
+            /// @brief  Determines the least severe messages that are logged.
+            ///
+            /// @return the minimum severity
+            ///
+            static log_severity min_severity(void) noexcept;
+
+            ///
+            /// @brief  Sets the least severe messages that are logged. Less severe messages are
+            ///         discarded when they are logged.
+            ///
+            /// @param  severity    the minimum severity
+            ///
+            static void set_min_severity(log_severity severity) noexcept;
+
+            ///
+            /// @brief  Determines whether messages of a severity are logged.
+            ///
+            /// @param  severity    the severity
+            ///
+            /// @return true if and only if messages of the severity are logged
+            ///
+            inline static bool is_logged(log_severity severity) noexcept
+            {
+                // Nothing is ordered by the minimum, so a relaxed load is enough.
+                return severity >= f_min_severity.load(std::memory_order_relaxed);
+            }
+
+            ///
+            /// @brief  Determines whether written messages contain ANSI escape sequences for
+            ///         styling such as color and bold.
+            ///
+            /// @return true if and only if ANSI style is enabled
+            ///
+            static bool ansi_style_enabled(void) noexcept;
+
+            ///
+            /// @brief  Sets whether written messages contain ANSI escape sequences for styling such
+            ///         as color and bold.
+            ///
+            /// @param  enabled true if and only if ANSI style should be enabled
+            ///
+            static void set_ansi_style_enabled(bool enabled) noexcept;
+
+            ///
+            /// @brief  Sets the stream messages are written to. By default it is standard output.
+            ///         Messages already logged but not yet written go to the new stream.
+            ///
+            /// @param  output  the stream to write to, which must outlive its use by the logger
+            ///
+            static void set_output(std::ostream &output) noexcept;
+
+            ///
+            /// @brief  Logs a message. It never blocks on the output and only allocates the first
+            ///         time the calling thread logs, or if the value is formatted immediately.
+            ///
+            /// @tparam T           the type of the value to log as the message
+            /// @param  severity    the severity of the message
+            /// @param  obj         the value to log as the message
+            ///
+            template<typename T> static void log(log_severity severity, const T &obj) noexcept
+            {
+                // Discard the message without doing any work if its severity is filtered out.
+                if (!is_logged(severity))
+                {
+                    return;
+                }
+
+                log_record_t record;
+                record.time_ns = now_ns();
+                record.severity = severity;
+
+                // Copy text, copy values that own everything they print so they can be formatted
+                // later, and format anything else now since it may point at memory the caller
+                // frees.
+                if constexpr (std::is_convertible<const T &, const char *>::value)
+                {
+                    const char *text = obj;
+                    submit_text(record, text, strlen(text));
+                }
+                else if constexpr (std::is_same<T, std::string>::value
+                    || std::is_same<T, std::string_view>::value)
+                {
+                    submit_text(record, obj.data(), obj.size());
+                }
+                else if constexpr (std::is_base_of<std::exception, T>::value)
+                {
+                    const char *text = obj.what();
+                    submit_text(record, text, strlen(text));
+                }
+                else if constexpr (log_deferred<T>::value
+                    && std::is_trivially_copyable<T>::value
+                    && sizeof(T) <= LEAF_UTIL_LOG_PAYLOAD_SIZE
+                    && alignof(T) <= alignof(std::max_align_t))
+                {
+                    memcpy(record.payload, &obj, sizeof(T));
+                    record.format = format_value<T>;
+                    submit(record);
+                }
+                else
+                {
+                    try
+                    {
+                        std::ostringstream stream;
+                        stream << obj;
+                        std::string text = stream.str();
+                        submit_text(record, text.data(), text.size());
+                    }
+                    catch (const std::exception &) {}
+                }
+            }
+
+            ///
+            /// @brief  Logs a message and writes it on the calling thread before returning, after
+            ///         every message logged before it. The message is never truncated or dropped.
+            ///
+            /// @tparam T           the type of the value to log as the message
+            /// @param  severity    the severity of the message
+            /// @param  obj         the value to log as the message
+            ///
+            template<typename T> static void log_now(log_severity severity, const T &obj) noexcept
+            {
+                // Discard the message if its severity is filtered out.
+                if (!is_logged(severity))
+                {
+                    return;
+                }
+
+                // Format the message and write it along with the pending ones.
+                try
+                {
+                    std::ostringstream stream;
+                    stream << obj;
+                    std::string text = stream.str();
+                    write_now(severity, text.data(), text.size());
+                }
+                catch (const std::exception &) {}
+            }
+
+            ///
+            /// @brief  Writes text as a message on the calling thread before returning, after every
+            ///         message logged before it.
+            ///
+            /// @param  severity    the severity of the message
+            /// @param  text        the text of the message
+            /// @param  length      the length of the text
+            ///
+            static void write_now(log_severity severity, const char *text, size_t length) noexcept;
+
+            ///
+            /// @brief  Writes every message that has been logged before returning. Messages logged
+            ///         by other threads while it runs may not be written.
+            ///
+            static void flush(void) noexcept;
+
+            ///
+            /// @brief  Writes every message that has been logged and stops the background thread.
+            ///         Until a thread that has not logged before logs and restarts it, messages are
+            ///         only written by flush. Stopping happens automatically when the program
+            ///         exits.
+            ///
+            static void stop(void) noexcept;
+
+            ///
+            /// @brief  Determines how many messages were dropped because the ring of their thread
+            ///         was full.
+            ///
+            /// @return the number of dropped messages on all threads
+            ///
+            static uint64_t dropped_count(void);
+    };
+}
+
+#endif
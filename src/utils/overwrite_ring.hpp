@@ -0,0 +1,216 @@
+///
+/// @file       overwrite_ring.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a template class that passes values from one thread to another through a
+///             fixed-size ring without locking, overwriting the oldest values when it is full.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_UTIL_SRC_OVERWRITE_RING_HEADER_GUARD
+#define LEAF_UTIL_SRC_OVERWRITE_RING_HEADER_GUARD
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include "spsc_ring.hpp"
+#include "unique.hpp"
+
+namespace utl
+{
+    ///
+    /// @brief  A fixed-size ring that one producer thread pushes values into and one consumer
+    ///         thread drains without locking. Unlike an SPSC ring, a push never fails: once the
+    ///         ring is full, each push overwrites the oldest value, so the ring always holds the
+    ///         most recent values. Values overwritten before they were drained are counted as
+    ///         lost.
+    ///
+    ///         Each slot carries a value as atomic words, so the consumer can read a slot while
+    ///         the producer overwrites it and tell afterwards that the copy may be torn.
+    ///
+    /// @tparam T   the type of the values, which must be trivially copyable and default
+    ///             constructible
+    ///
+    template<typename T> class overwrite_ring : public unique
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "Values of an overwrite ring must be trivially copyable.");
+
+        private:
+            ///
+            /// @brief  The number of 8-byte words a value is stored in.
+            ///
+            static const size_t f_word_count = (sizeof(T) + sizeof(uint64_t) - 1)
+                / sizeof(uint64_t);
+
+            ///
+            /// @brief  A slot holding one value as atomic words.
+            ///
+            typedef struct slot
+            {
+                std::atomic<uint64_t> words[f_word_count];
+
+            } slot_t;
+
+            ///
+            /// @brief  The slots of the ring. Their number is a power of 2.
+            ///
+            std::unique_ptr<slot_t[]> m_slots;
+
+            ///
+            /// @brief  The number of slots minus 1, used to wrap indices.
+            ///
+            size_t m_mask;
+
+            ///
+            /// @brief  The total number of pushes that have started writing their slot. Only the
+            ///         producer writes it.
+            ///
+            alignas(LEAF_UTIL_CACHE_LINE_SIZE) std::atomic<size_t> m_begun;
+
+            ///
+            /// @brief  The total number of pushes that have finished writing their slot. Only the
+            ///         producer writes it.
+            ///
+            std::atomic<size_t> m_head;
+
+            ///
+            /// @brief  The total number of values drained or lost. Only the consumer uses it.
+            ///
+            alignas(LEAF_UTIL_CACHE_LINE_SIZE) size_t m_tail;
+
+            ///
+            /// @brief  The number of values overwritten before they were drained. Only the
+            ///         consumer uses it.
+            ///
+            uint64_t m_lost_count;
+
+        public:
+            ///
+            /// @brief  Creates an empty ring.
+            ///
+            /// @param  capacity    the minimum number of values the ring holds, rounded up to a
+            ///                     power of 2
+            ///
+            overwrite_ring(size_t capacity) : m_begun(0), m_head(0), m_tail(0), m_lost_count(0)
+            {
+                // Round the capacity up to a power of 2 so that indices wrap with a mask.
+                size_t slot_count = 1;
+
+                while (slot_count < capacity)
+                {
+                    slot_count <<= 1;
+                }
+
+                m_slots.reset(new slot_t[slot_count]);
+                m_mask = slot_count - 1;
+            }
+
+            ///
+            /// @brief  Pushes a value into the ring, overwriting the oldest value if it is full.
+            ///         Only the producer thread may call this.
+            ///
+            /// @param  value   the value to push
+            ///
+            inline void push(const T &value) noexcept
+            {
+                uint64_t words[f_word_count] = {};
+                memcpy(words, &value, sizeof(T));
+
+                // Announce the write before touching the slot, so that a consumer that reads any
+                // word of it afterwards also sees the announcement and discards its copy.
+                size_t head = m_begun.load(std::memory_order_relaxed);
+                m_begun.store(head + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+
+                // Fill the slot, then publish it to the consumer.
+                slot_t &slot = m_slots[head & m_mask];
+
+                for (size_t i = 0; i < f_word_count; i++)
+                {
+                    slot.words[i].store(words[i], std::memory_order_relaxed);
+                }
+
+                m_head.store(head + 1, std::memory_order_release);
+            }
+
+            ///
+            /// @brief  Passes every value in the ring to a function, oldest first, and removes
+            ///         them. Only the consumer thread may call this.
+            ///
+            /// @tparam F       the type of the function
+            /// @param  consume the function, called with each value
+            ///
+            /// @return the number of values passed to the function
+            ///
+            template<typename F> size_t drain(F consume)
+            {
+                // The head must be acquired so that the slot contents written by the producer are
+                // visible. Values more than a ring behind it have been overwritten.
+                size_t head = m_head.load(std::memory_order_acquire);
+                size_t count = 0;
+
+                if (head > m_tail + m_mask + 1)
+                {
+                    m_lost_count += head - m_tail - (m_mask + 1);
+                    m_tail = head - (m_mask + 1);
+                }
+
+                while (m_tail < head)
+                {
+                    // Copy the slot, then check that the producer has not started overwriting it.
+                    const slot_t &slot = m_slots[m_tail & m_mask];
+                    uint64_t words[f_word_count];
+
+                    for (size_t i = 0; i < f_word_count; i++)
+                    {
+                        words[i] = slot.words[i].load(std::memory_order_relaxed);
+                    }
+
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    size_t begun = m_begun.load(std::memory_order_relaxed);
+
+                    // If it has, the copy may be torn, and so may every older slot. Skip them. The
+                    // tail can end up past the head, which the next drain catches up with.
+                    if (begun > m_tail + m_mask + 1)
+                    {
+                        m_lost_count += begun - m_tail - (m_mask + 1);
+                        m_tail = begun - (m_mask + 1);
+                        continue;
+                    }
+
+                    T value;
+                    memcpy(&value, words, sizeof(T));
+                    consume(value);
+
+                    m_tail++;
+                    count++;
+                }
+
+                return count;
+            }
+
+            ///
+            /// @brief  Determines how many values were overwritten before they were drained,
+            ///         including those that would be if the ring were drained now. Only the consumer
+            ///         thread may call this.
+            ///
+            /// @return the number of lost values
+            ///
+            inline uint64_t lost_count(void) const noexcept
+            {
+                // Add the values the producer has lapped since the last drain.
+                size_t head = m_head.load(std::memory_order_acquire);
+                size_t lapped = head > m_tail + m_mask + 1 ? head - m_tail - (m_mask + 1) : 0;
+
+                return m_lost_count + lapped;
+            }
+    };
+}
+
+#endif
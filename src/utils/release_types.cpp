@@ -8,7 +8,6 @@
 /// @copyright  Copyright (c) 2023
 /// 
 
-#include <sstream>
 #include "release_types.hpp"
 
 using namespace std;
@@ -21,15 +20,23 @@ namespace utl
 
     string release_version::to_string(void) const noexcept
     {
-        // Create a buffered string stream to build a display string.
-        stringstream stream;
+        // Format the release version into a buffer on the stack. Three bytes always fit.
+        char buffer[LEAF_UTIL_DISPLAY_BUFFER_SIZE];
+        char *end = format(buffer, buffer + sizeof(buffer));
 
-        // Insert the major, minor, and patch numbers into the stream delimitered by commas. Convert
-        // the numbers to integers from unisgned bytes because the bytes would be interpreted as
-        // character codes in the stream.
-        stream << (int)major << '.' << (int)minor << '.' << (int)patch;
+        // Return the formatted characters.
+        return string(buffer, end);
+    }
+
+    char *release_version::format(char *first, char *last) const noexcept
+    {
+        // Write the major, minor, and patch numbers delimited by periods. The bytes are formatted
+        // as integers rather than as character codes.
+        first = format_int(first, last, major);
+        first = format_char(first, last, '.');
+        first = format_int(first, last, minor);
+        first = format_char(first, last, '.');
 
-        // Return the string buffer from the stream.
-        return stream.str();
+        return format_int(first, last, patch);
     }
 }
@@ -68,6 +68,17 @@ namespace utl
         /// 
         virtual std::string to_string(void) const noexcept override;
 
+        ///
+        /// @brief  Writes the display string for the release version into a buffer without
+        ///         allocating.
+        ///
+        /// @param  first   the position in the buffer to write at or null
+        /// @param  last    the end of the buffer
+        ///
+        /// @return the position after the display string or null if it did not fit
+        ///
+        virtual char *format(char *first, char *last) const noexcept override;
+
     } release_version_t;
 }
 
@@ -0,0 +1,148 @@
+///
+/// @file       sample_window.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a template class that keeps the most recent samples of a measurement in
+///             a ring so that percentiles can be computed over a rolling window.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_UTIL_SRC_SAMPLE_WINDOW_HEADER_GUARD
+#define LEAF_UTIL_SRC_SAMPLE_WINDOW_HEADER_GUARD
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace utl
+{
+    ///
+    /// @brief  Keeps the most recent samples of a measurement in a ring. Once the window is full,
+    ///         each new sample replaces the oldest one. The ring only allocates while it grows to
+    ///         its capacity.
+    ///
+    /// @tparam T   the type of the samples, which must be ordered
+    ///
+    template<typename T> class sample_window
+    {
+        private:
+            ///
+            /// @brief  The samples in the window. Until the window is full they are in the order
+            ///         they were added, after that the oldest one is at the next index.
+            ///
+            std::vector<T> m_samples;
+
+            ///
+            /// @brief  The maximum number of samples in the window.
+            ///
+            size_t m_capacity;
+
+            ///
+            /// @brief  The index the next sample is written to once the window is full.
+            ///
+            size_t m_next;
+
+        public:
+            ///
+            /// @brief  Creates an empty window.
+            ///
+            /// @param  capacity    the maximum number of samples in the window, at least 1
+            ///
+            sample_window(size_t capacity) noexcept
+                // Start empty. A capacity of 0 would never hold a sample, so it is raised to 1.
+                : m_capacity(capacity ? capacity : 1), m_next(0) {}
+
+            ///
+            /// @brief  Adds a sample to the window, replacing the oldest one if the window is full.
+            ///
+            /// @param  sample  the sample to add
+            ///
+            inline void push(const T &sample)
+            {
+                // Grow until the capacity is reached, then overwrite the oldest sample.
+                if (m_samples.size() < m_capacity)
+                {
+                    m_samples.push_back(sample);
+                    return;
+                }
+
+                m_samples[m_next] = sample;
+                m_next = (m_next + 1) % m_capacity;
+            }
+
+            ///
+            /// @brief  Removes every sample. The memory of the ring is kept.
+            ///
+            inline void clear(void) noexcept
+            {
+                // Drop the samples and start writing at the front again.
+                m_samples.clear();
+                m_next = 0;
+            }
+
+            ///
+            /// @brief  Determines how many samples are in the window.
+            ///
+            /// @return the number of samples
+            ///
+            inline size_t size(void) const noexcept
+            {
+                // Return the number of samples held.
+                return m_samples.size();
+            }
+
+            ///
+            /// @brief  Determines the maximum number of samples in the window.
+            ///
+            /// @return the capacity of the window
+            ///
+            inline size_t capacity(void) const noexcept
+            {
+                // Return the maximum number of samples.
+                return m_capacity;
+            }
+
+            ///
+            /// @brief  Copies the samples in the window into the given vector in ascending order.
+            ///         Passing the same vector each time avoids allocating once it has grown.
+            ///
+            /// @param  sorted  the vector to replace the contents of
+            ///
+            inline void sorted_samples(std::vector<T> &sorted) const
+            {
+                // Copy the samples, then sort the copy so the ring keeps its order.
+                sorted.assign(m_samples.begin(), m_samples.end());
+                std::sort(sorted.begin(), sorted.end());
+            }
+
+            ///
+            /// @brief  Finds a percentile of samples that are already sorted, using the nearest
+            ///         rank.
+            ///
+            /// @param  sorted      the samples in ascending order
+            /// @param  percentile  the percentile between 0 and 100
+            ///
+            /// @return the sample at the percentile or a default value if there are no samples
+            ///
+            static inline T percentile(const std::vector<T> &sorted, double percentile) noexcept
+            {
+                // With no samples there is no percentile to find.
+                if (sorted.empty())
+                {
+                    return T();
+                }
+
+                // Find the smallest sample that at least the given percentage of samples do not
+                // exceed.
+                double clamped = percentile < 0.0 ? 0.0 : (percentile > 100.0 ? 100.0 : percentile);
+                size_t rank = (size_t)std::ceil(clamped / 100.0 * (double)sorted.size());
+
+                return sorted[rank ? rank - 1 : 0];
+            }
+    };
+}
+
+#endif
@@ -0,0 +1,362 @@
+///
+/// @file       slot_map.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a container that stores values densely and hands out generational
+///             handles to them. A handle remains safe to use after its value is erased; it simply
+///             stops resolving.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_UTIL_SRC_SLOT_MAP_HEADER_GUARD
+#define LEAF_UTIL_SRC_SLOT_MAP_HEADER_GUARD
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace utl
+{
+    ///
+    /// @brief  Represents a generational handle to a value stored in a slot map. The index
+    ///         identifies the slot and the generation identifies which occupant of the slot the
+    ///         handle refers to. A generation of 0 is never issued, so a zeroed handle is null.
+    ///
+    typedef struct slot_handle
+    {
+        ///
+        /// @brief  The index of the slot the value occupies.
+        ///
+        uint32_t index;
+
+        ///
+        /// @brief  The generation of the slot at the time the value was inserted.
+        ///
+        uint32_t generation;
+
+        ///
+        /// @brief  Constructs a null slot handle.
+        ///
+        slot_handle(void) noexcept : index(0), generation(0) {}
+
+        ///
+        /// @brief  Constructs a slot handle given an index and generation.
+        ///
+        /// @param  index       the index of the slot
+        /// @param  generation  the generation of the slot
+        ///
+        slot_handle(uint32_t index, uint32_t generation) noexcept
+            : index(index), generation(generation) {}
+
+        ///
+        /// @brief  Determines whether the handle is null (was never issued by a slot map).
+        ///
+        /// @return true if and only if the handle is null
+        ///
+        inline bool is_null(void) const noexcept
+        {
+            // Generation 0 is reserved for null handles.
+            return generation == 0;
+        }
+
+        ///
+        /// @brief  Determines whether two handles refer to the same slot occupant.
+        ///
+        /// @param  other   the handle to compare against
+        ///
+        /// @return true if and only if both the index and generation match
+        ///
+        inline bool operator==(const slot_handle &other) const noexcept
+        {
+            // Compare both components.
+            return index == other.index && generation == other.generation;
+        }
+
+        ///
+        /// @brief  Determines whether two handles refer to different slot occupants.
+        ///
+        /// @param  other   the handle to compare against
+        ///
+        /// @return true if and only if either the index or generation differ
+        ///
+        inline bool operator!=(const slot_handle &other) const noexcept
+        {
+            // Negate the equality comparison.
+            return !(*this == other);
+        }
+
+    } slot_handle_t;
+
+    ///
+    /// @brief  A container that stores values contiguously and hands out generational handles to
+    ///         them. Insertion, erasure, and handle lookup are constant time. Iteration walks the
+    ///         dense value array directly. Erasure moves the last value into the erased position,
+    ///         so iteration order is not stable across erasures.
+    ///
+    /// @tparam T   the type of value stored
+    ///
+    template<typename T> class slot_map
+    {
+        private:
+            ///
+            /// @brief  Denotes the end of the free slot list.
+            ///
+            static constexpr uint32_t f_no_slot = UINT32_MAX;
+
+            ///
+            /// @brief  Represents a sparse slot. An occupied slot stores the dense index of its
+            ///         value, a free slot stores the index of the next free slot.
+            ///
+            typedef struct slot
+            {
+                ///
+                /// @brief  The current generation of the slot. It is incremented every time the
+                ///         occupant of the slot is erased.
+                ///
+                uint32_t generation;
+
+                ///
+                /// @brief  The dense index of the value if the slot is occupied or the index of the
+                ///         next free slot if it is not.
+                ///
+                uint32_t link;
+
+            } slot_t;
+
+            ///
+            /// @brief  The values stored contiguously.
+            ///
+            std::vector<T> m_values;
+
+            ///
+            /// @brief  The slot index of each value, parallel to the value array.
+            ///
+            std::vector<uint32_t> m_value_slots;
+
+            ///
+            /// @brief  The sparse slots addressed by handles.
+            ///
+            std::vector<slot_t> m_slots;
+
+            ///
+            /// @brief  The index of the first free slot or the end marker if there is none.
+            ///
+            uint32_t m_free_head;
+
+            ///
+            /// @brief  Finds the slot a handle refers to if the handle is still current.
+            ///
+            /// @param  handle  the handle to resolve
+            ///
+            /// @return a pointer to the slot or null if the handle is stale or null
+            ///
+            inline const slot_t *resolve(const slot_handle_t &handle) const noexcept
+            {
+                // Ensure the index addresses a slot and the generations match. A null handle
+                // never matches since generations start at 1.
+                if (handle.index >= m_slots.size()
+                    || m_slots[handle.index].generation != handle.generation)
+                {
+                    return nullptr;
+                }
+
+                // Return a pointer to the slot.
+                return &m_slots[handle.index];
+            }
+
+        public:
+            ///
+            /// @brief  Constructs an empty slot map.
+            ///
+            slot_map(void) noexcept : m_free_head(f_no_slot) {}
+
+            ///
+            /// @brief  Inserts a value and returns a handle to it. The value is moved into the map,
+            ///         so a temporary is never copied.
+            ///
+            /// @param  value   the value to insert
+            ///
+            /// @return a handle to the inserted value
+            ///
+            slot_handle_t insert(T value)
+            {
+                // Take a slot from the free list if one is available, otherwise append a new slot
+                // with a generation of 1.
+                uint32_t slot_index;
+
+                if (m_free_head != f_no_slot)
+                {
+                    slot_index = m_free_head;
+                    m_free_head = m_slots[slot_index].link;
+                }
+                else
+                {
+                    slot_index = (uint32_t)m_slots.size();
+                    m_slots.push_back({1, 0});
+                }
+
+                // Append the value to the dense array and link the slot to it.
+                m_slots[slot_index].link = (uint32_t)m_values.size();
+                m_values.push_back(std::move(value));
+                m_value_slots.push_back(slot_index);
+
+                // Return a handle to the slot at its current generation.
+                return {slot_index, m_slots[slot_index].generation};
+            }
+
+            ///
+            /// @brief  Erases the value a handle refers to. Every handle to the value becomes
+            ///         stale.
+            ///
+            /// @param  handle  the handle to the value to erase
+            ///
+            /// @return true if and only if the handle was current and a value was erased
+            ///
+            bool erase(const slot_handle_t &handle) noexcept
+            {
+                // Ensure the handle is current.
+                if (!resolve(handle))
+                {
+                    return false;
+                }
+
+                // Move the last value into the position of the erased value and relink the slot of
+                // the moved value.
+                slot_t &slot = m_slots[handle.index];
+                uint32_t dense_index = slot.link;
+                uint32_t last_index = (uint32_t)m_values.size() - 1;
+
+                if (dense_index != last_index)
+                {
+                    m_values[dense_index] = std::move(m_values[last_index]);
+                    m_value_slots[dense_index] = m_value_slots[last_index];
+                    m_slots[m_value_slots[dense_index]].link = dense_index;
+                }
+
+                m_values.pop_back();
+                m_value_slots.pop_back();
+
+                // Advance the generation so outstanding handles go stale. Generation 0 is skipped
+                // on wrap-around since it is reserved for null handles.
+                if (++slot.generation == 0)
+                {
+                    slot.generation = 1;
+                }
+
+                // Push the slot onto the free list.
+                slot.link = m_free_head;
+                m_free_head = handle.index;
+
+                // Return true indicating that a value was erased.
+                return true;
+            }
+
+            ///
+            /// @brief  Determines whether a handle still refers to a value in the map.
+            ///
+            /// @param  handle  the handle to check
+            ///
+            /// @return true if and only if the handle is current
+            ///
+            inline bool contains(const slot_handle_t &handle) const noexcept
+            {
+                // The handle is current if it resolves to a slot.
+                return resolve(handle) != nullptr;
+            }
+
+            ///
+            /// @brief  Finds the value a handle refers to.
+            ///
+            /// @param  handle  the handle to resolve
+            ///
+            /// @return a pointer to the value or null if the handle is stale or null
+            ///
+            inline T *get(const slot_handle_t &handle) noexcept
+            {
+                // Resolve the slot and follow its link into the dense array.
+                const slot_t *slot = resolve(handle);
+                return slot ? &m_values[slot->link] : nullptr;
+            }
+
+            ///
+            /// @brief  Finds the value a handle refers to.
+            ///
+            /// @param  handle  the handle to resolve
+            ///
+            /// @return a pointer to the value or null if the handle is stale or null
+            ///
+            inline const T *get(const slot_handle_t &handle) const noexcept
+            {
+                // Resolve the slot and follow its link into the dense array.
+                const slot_t *slot = resolve(handle);
+                return slot ? &m_values[slot->link] : nullptr;
+            }
+
+            ///
+            /// @brief  Determines how many values are stored.
+            ///
+            /// @return the number of values
+            ///
+            inline size_t size(void) const noexcept
+            {
+                // The dense array holds exactly one entry per value.
+                return m_values.size();
+            }
+
+            ///
+            /// @brief  Determines whether no values are stored.
+            ///
+            /// @return true if and only if the map is empty
+            ///
+            inline bool empty(void) const noexcept
+            {
+                // Check the dense array.
+                return m_values.empty();
+            }
+
+            ///
+            /// @brief  Returns an iterator to the first value in the dense array.
+            ///
+            /// @return the iterator
+            ///
+            inline typename std::vector<T>::iterator begin(void) noexcept
+            {
+                return m_values.begin();
+            }
+
+            ///
+            /// @brief  Returns an iterator past the last value in the dense array.
+            ///
+            /// @return the iterator
+            ///
+            inline typename std::vector<T>::iterator end(void) noexcept
+            {
+                return m_values.end();
+            }
+
+            ///
+            /// @brief  Returns an iterator to the first value in the dense array.
+            ///
+            /// @return the iterator
+            ///
+            inline typename std::vector<T>::const_iterator begin(void) const noexcept
+            {
+                return m_values.begin();
+            }
+
+            ///
+            /// @brief  Returns an iterator past the last value in the dense array.
+            ///
+            /// @return the iterator
+            ///
+            inline typename std::vector<T>::const_iterator end(void) const noexcept
+            {
+                return m_values.end();
+            }
+    };
+}
+
+#endif
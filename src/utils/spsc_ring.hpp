@@ -0,0 +1,155 @@
+///
+/// @file       spsc_ring.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a template class that passes values from one thread to another through a
+///             fixed-size ring without locking.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_UTIL_SRC_SPSC_RING_HEADER_GUARD
+#define LEAF_UTIL_SRC_SPSC_RING_HEADER_GUARD
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include "unique.hpp"
+
+///
+/// @brief  The assumed size of a cache line in bytes. The indices of a ring are kept this far
+///         apart so that the producer and the consumer do not contend for the same line.
+///
+#define LEAF_UTIL_CACHE_LINE_SIZE 64
+
+namespace utl
+{
+    ///
+    /// @brief  A fixed-size ring that one producer thread pushes values into and one consumer
+    ///         thread pops values from without locking. Neither side ever blocks or allocates. A
+    ///         push into a full ring fails, so the producer decides whether to drop the value.
+    ///
+    /// @tparam T   the type of the values, which must be default constructible and copyable
+    ///
+    template<typename T> class spsc_ring : public unique
+    {
+        private:
+            ///
+            /// @brief  The slots of the ring. Their number is a power of 2.
+            ///
+            std::unique_ptr<T[]> m_slots;
+
+            ///
+            /// @brief  The number of slots minus 1, used to wrap indices.
+            ///
+            size_t m_mask;
+
+            ///
+            /// @brief  The total number of values pushed. Only the producer writes it.
+            ///
+            alignas(LEAF_UTIL_CACHE_LINE_SIZE) std::atomic<size_t> m_head;
+
+            ///
+            /// @brief  The total number of values popped. Only the consumer writes it.
+            ///
+            alignas(LEAF_UTIL_CACHE_LINE_SIZE) std::atomic<size_t> m_tail;
+
+        public:
+            ///
+            /// @brief  Creates an empty ring.
+            ///
+            /// @param  capacity    the minimum number of values the ring holds, rounded up to a
+            ///                     power of 2
+            ///
+            spsc_ring(size_t capacity) : m_head(0), m_tail(0)
+            {
+                // Round the capacity up to a power of 2 so that indices wrap with a mask.
+                size_t slot_count = 1;
+
+                while (slot_count < capacity)
+                {
+                    slot_count <<= 1;
+                }
+
+                m_slots.reset(new T[slot_count]);
+                m_mask = slot_count - 1;
+            }
+
+            ///
+            /// @brief  Pushes a value into the ring. Only the producer thread may call this.
+            ///
+            /// @param  value   the value to push
+            ///
+            /// @return true if and only if there was room for the value
+            ///
+            inline bool try_push(const T &value) noexcept
+            {
+                // The producer owns the head, so its own view of it is current. The tail must be
+                // acquired so that the slot is not overwritten before the consumer has read it.
+                size_t head = m_head.load(std::memory_order_relaxed);
+
+                if (head - m_tail.load(std::memory_order_acquire) > m_mask)
+                {
+                    return false;
+                }
+
+                // Fill the slot, then publish it to the consumer.
+                m_slots[head & m_mask] = value;
+                m_head.store(head + 1, std::memory_order_release);
+
+                return true;
+            }
+
+            ///
+            /// @brief  Pops the oldest value from the ring. Only the consumer thread may call this.
+            ///
+            /// @param  value   set to the popped value
+            ///
+            /// @return true if and only if there was a value to pop
+            ///
+            inline bool try_pop(T &value) noexcept
+            {
+                // The consumer owns the tail. The head must be acquired so that the slot contents
+                // written by the producer are visible.
+                size_t tail = m_tail.load(std::memory_order_relaxed);
+
+                if (tail == m_head.load(std::memory_order_acquire))
+                {
+                    return false;
+                }
+
+                // Read the slot, then hand it back to the producer.
+                value = m_slots[tail & m_mask];
+                m_tail.store(tail + 1, std::memory_order_release);
+
+                return true;
+            }
+
+            ///
+            /// @brief  Determines how many values are in the ring. The result is only exact when
+            ///         neither side is running.
+            ///
+            /// @return the number of values
+            ///
+            inline size_t size(void) const noexcept
+            {
+                // Subtract the number of popped values from the number of pushed ones.
+                return m_head.load(std::memory_order_acquire)
+                    - m_tail.load(std::memory_order_acquire);
+            }
+
+            ///
+            /// @brief  Determines the maximum number of values in the ring.
+            ///
+            /// @return the capacity of the ring
+            ///
+            inline size_t capacity(void) const noexcept
+            {
+                // Return the number of slots.
+                return m_mask + 1;
+            }
+    };
+}
+
+#endif
@@ -0,0 +1,233 @@
+///
+/// @file       trace.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for scoped trace zones that record when named sections of code run on
+///             each thread, and for exporting the recorded zones as Chrome trace events.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include "trace.hpp"
+
+using namespace std;
+
+namespace utl
+{
+    ///
+    /// @brief  Writes a string as a JSON string literal.
+    ///
+    /// @param  stream  the stream to write to
+    /// @param  str     the string to write
+    ///
+    static void write_json_string(ostream &stream, const char *str)
+    {
+        stream << '"';
+
+        // Escape quotes, backslashes, and control characters.
+        for (const char *c = str; *c; c++)
+        {
+            if (*c == '"' || *c == '\\')
+            {
+                stream << '\\' << *c;
+            }
+            else if ((unsigned char)*c < 0x20)
+            {
+                char escaped[8];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned int)*c);
+                stream << escaped;
+            }
+            else
+            {
+                stream << *c;
+            }
+        }
+
+        stream << '"';
+    }
+
+    ///
+    /// @brief  Writes a time in nanoseconds as the microseconds Chrome trace events are measured
+    ///         in, keeping the nanoseconds as decimals.
+    ///
+    /// @param  stream  the stream to write to
+    /// @param  time_ns the time in nanoseconds
+    ///
+    static void write_json_us(ostream &stream, uint64_t time_ns)
+    {
+        // Format with integer arithmetic so that large timestamps keep full precision.
+        char formatted[32];
+        snprintf(formatted, sizeof(formatted), "%" PRIu64 ".%03" PRIu64, time_ns / 1000,
+            time_ns % 1000);
+        stream << formatted;
+    }
+
+    // By default tracing is disabled.
+    atomic<bool> trace::f_enabled(false);
+
+    mutex trace::f_registry_mutex;
+
+    vector<unique_ptr<trace::thread_buffer_t>> trace::f_thread_buffers;
+
+    trace::thread_buffer_t *trace::this_thread_buffer(void) noexcept
+    {
+        // The buffer is looked up once per thread and owned by the registry.
+        thread_local thread_buffer_t *buffer = NULL;
+
+        if (buffer)
+        {
+            return buffer;
+        }
+
+        // Register a new buffer. Identifiers start at 1 in registration order. If it cannot be
+        // allocated, zones on this thread are dropped.
+        try
+        {
+            lock_guard<mutex> lock(f_registry_mutex);
+
+            uint32_t thread_id = (uint32_t)f_thread_buffers.size() + 1;
+            f_thread_buffers.emplace_back(new thread_buffer_t(thread_id));
+            buffer = f_thread_buffers.back().get();
+        }
+        catch (const exception &) {}
+
+        return buffer;
+    }
+
+    void trace::record(const char *name, uint64_t start_ns, uint64_t end_ns) noexcept
+    {
+        thread_buffer_t *buffer = this_thread_buffer();
+
+        if (!buffer)
+        {
+            return;
+        }
+
+        // Push the zone into the ring of the thread, overwriting the oldest zone if it is full.
+        buffer->events.push({name, start_ns, end_ns - start_ns});
+    }
+
+    void trace::set_enabled(bool enabled) noexcept
+    {
+        // Set whether zones are recorded.
+        f_enabled.store(enabled, memory_order_relaxed);
+    }
+
+    uint64_t trace::now_ns(void) noexcept
+    {
+        // Use the steady clock so that zones on different threads share a time base.
+        return (uint64_t)chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    bool trace::set_thread_name(const string &name) noexcept
+    {
+        thread_buffer_t *buffer = this_thread_buffer();
+
+        if (!buffer)
+        {
+            return false;
+        }
+
+        // Store the name under the registry mutex, since the trace writer reads it.
+        try
+        {
+            lock_guard<mutex> lock(f_registry_mutex);
+            buffer->thread_name = name;
+        }
+        catch (const exception &)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    size_t trace::write_chrome_json(ostream &stream)
+    {
+        // Hold the registry mutex so that the rings have a single consumer and no buffer is added
+        // while they are written.
+        lock_guard<mutex> lock(f_registry_mutex);
+
+        size_t count = 0;
+        uint64_t dropped_count = 0;
+        bool first = true;
+
+        stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+        for (const unique_ptr<thread_buffer_t> &buffer : f_thread_buffers)
+        {
+            // Name the thread with a metadata event if it has a name.
+            if (!buffer->thread_name.empty())
+            {
+                stream << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\","
+                    << "\"pid\":1,\"tid\":" << buffer->thread_id << ",\"args\":{\"name\":";
+                write_json_string(stream, buffer->thread_name.c_str());
+                stream << "}}";
+                first = false;
+            }
+
+            // Drain the ring into complete events.
+            count += buffer->events.drain([&stream, &first, &buffer](const trace_event_t &event)
+            {
+                stream << (first ? "\n" : ",\n") << "{\"name\":";
+                write_json_string(stream, event.name);
+                stream << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->thread_id << ",\"ts\":";
+                write_json_us(stream, event.start_ns);
+                stream << ",\"dur\":";
+                write_json_us(stream, event.duration_ns);
+                stream << "}";
+                first = false;
+            });
+
+            dropped_count += buffer->events.lost_count();
+        }
+
+        // Note how many zones were dropped, so that a trace missing its start can be told apart.
+        stream << "\n],\"otherData\":{\"droppedZones\":" << dropped_count << "}}\n";
+
+        return count;
+    }
+
+    size_t trace::write_chrome_json(const string &path)
+    {
+        ofstream file(path, ios::out | ios::trunc);
+
+        if (!file)
+        {
+            throw runtime_error("Failed to open the trace file \"" + path + "\".");
+        }
+
+        // Write the trace, then make sure it reached the file.
+        size_t count = write_chrome_json(file);
+        file.flush();
+
+        if (!file)
+        {
+            throw runtime_error("Failed to write the trace file \"" + path + "\".");
+        }
+
+        return count;
+    }
+
+    uint64_t trace::dropped_count(void)
+    {
+        lock_guard<mutex> lock(f_registry_mutex);
+
+        // Sum the dropped zones of every thread.
+        uint64_t count = 0;
+
+        for (const unique_ptr<thread_buffer_t> &buffer : f_thread_buffers)
+        {
+            count += buffer->events.lost_count();
+        }
+
+        return count;
+    }
+}
@@ -0,0 +1,271 @@
+///
+/// @file       trace.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for scoped trace zones that record when named sections of code run on each
+///             thread, and for exporting the recorded zones as Chrome trace events.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_UTIL_SRC_TRACE_HEADER_GUARD
+#define LEAF_UTIL_SRC_TRACE_HEADER_GUARD
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "overwrite_ring.hpp"
+#include "unique.hpp"
+
+///
+/// @brief  The number of zones each thread keeps until they are written. Once the ring of a
+///         thread is full, each new zone overwrites the oldest, so a trace written after a long
+///         session shows its most recent zones.
+///
+#define LEAF_UTIL_TRACE_RING_CAPACITY 16384
+
+///
+/// @brief  Joins two tokens after expanding them.
+///
+#define LEAF_TRACE_CONCAT_EXPANDED(a, b) a ## b
+
+///
+/// @brief  Joins two tokens after expanding them, so that __LINE__ becomes a number.
+///
+#define LEAF_TRACE_CONCAT(a, b) LEAF_TRACE_CONCAT_EXPANDED(a, b)
+
+///
+/// @brief  Records a trace zone from this point to the end of the enclosing scope. The name must
+///         have static storage duration, since only the pointer is recorded. Defining
+///         LEAF_TRACE_DISABLED removes every zone at compile time.
+///
+#ifdef LEAF_TRACE_DISABLED
+#define LEAF_TRACE_ZONE(name) ((void)0)
+#else
+#define LEAF_TRACE_ZONE(name) utl::trace_zone LEAF_TRACE_CONCAT(leaf_trace_zone_, __LINE__)(name)
+#endif
+
+namespace utl
+{
+    ///
+    /// @brief  A section of code that ran on a thread.
+    ///
+    typedef struct trace_event
+    {
+        ///
+        /// @brief  The name of the zone, which has static storage duration.
+        ///
+        const char *name;
+
+        ///
+        /// @brief  The time in nanoseconds the zone was entered according to trace::now_ns.
+        ///
+        uint64_t start_ns;
+
+        ///
+        /// @brief  The time in nanoseconds spent in the zone.
+        ///
+        uint64_t duration_ns;
+
+    } trace_event_t;
+
+    ///
+    /// @brief  A class with static functionality to record trace zones and export them. Each thread
+    ///         records zones into a ring of its own without locking, which keeps its most recent
+    ///         zones. Writing the trace drains every ring into Chrome trace event JSON, which can
+    ///         be opened in Perfetto or chrome://tracing. While tracing is disabled a zone costs a
+    ///         single relaxed load.
+    ///
+    class trace
+    {
+        friend class trace_zone;
+
+        private:
+            ///
+            /// @brief  The most recent zones recorded by a single thread that have not been written
+            ///         yet.
+            ///
+            typedef struct thread_buffer
+            {
+                ///
+                /// @brief  The recorded zones. The owning thread pushes them and the thread that
+                ///         writes the trace drains them.
+                ///
+                overwrite_ring<trace_event_t> events;
+
+                ///
+                /// @brief  The identifier of the thread in the trace.
+                ///
+                uint32_t thread_id;
+
+                ///
+                /// @brief  The name of the thread in the trace, or empty if it has none. It is
+                ///         guarded by the registry mutex.
+                ///
+                std::string thread_name;
+
+                ///
+                /// @brief  Creates an empty buffer.
+                ///
+                /// @param  thread_id   the identifier of the thread in the trace
+                ///
+                thread_buffer(uint32_t thread_id)
+                    : events(LEAF_UTIL_TRACE_RING_CAPACITY), thread_id(thread_id) {}
+
+            } thread_buffer_t;
+
+            ///
+            /// @brief  Denotes whether zones are recorded.
+            ///
+            static std::atomic<bool> f_enabled;
+
+            ///
+            /// @brief  Guards the list of thread buffers and the thread names. Writing the trace
+            ///         holds it, so there is only ever one consumer per ring.
+            ///
+            static std::mutex f_registry_mutex;
+
+            ///
+            /// @brief  The buffers of every thread that has recorded a zone or been named. They
+            ///         outlive their threads so that zones recorded just before a thread exits are
+            ///         still written.
+            ///
+            static std::vector<std::unique_ptr<thread_buffer_t>> f_thread_buffers;
+
+            ///
+            /// @brief  Finds the buffer of the calling thread, creating it on first use.
+            ///
+            /// @return the buffer of the calling thread or null if it could not be created
+            ///
+            static thread_buffer_t *this_thread_buffer(void) noexcept;
+
+            ///
+            /// @brief  Records a zone on the calling thread. If the ring of the thread is full, the
+            ///         oldest zone in it is dropped.
+            ///
+            /// @param  name        the name of the zone
+            /// @param  start_ns    the time the zone was entered
+            /// @param  end_ns      the time the zone was left
+            ///
+            static void record(const char *name, uint64_t start_ns, uint64_t end_ns) noexcept;
+
+        public:
+            ///
+            /// @brief  Determines whether zones are recorded.
+            ///
+            /// @return true if and only if tracing is enabled
+            ///
+            inline static bool enabled(void) noexcept
+            {
+                // Nothing is ordered by the flag, so a relaxed load is enough.
+                return f_enabled.load(std::memory_order_relaxed);
+            }
+
+            ///
+            /// @brief  Sets whether zones are recorded. Zones already entered when tracing is
+            ///         disabled are still recorded when they are left.
+            ///
+            /// @param  enabled true if and only if zones should be recorded
+            ///
+            static void set_enabled(bool enabled) noexcept;
+
+            ///
+            /// @brief  Reads the clock zones are timed with.
+            ///
+            /// @return the time in nanoseconds since an arbitrary point
+            ///
+            static uint64_t now_ns(void) noexcept;
+
+            ///
+            /// @brief  Names the calling thread in the trace.
+            ///
+            /// @param  name    the name of the thread
+            ///
+            /// @return true if and only if the thread was named
+            ///
+            static bool set_thread_name(const std::string &name) noexcept;
+
+            ///
+            /// @brief  Writes every recorded zone as Chrome trace event JSON and removes them, so
+            ///         the next write only contains zones recorded after this one. Zones can keep
+            ///         being recorded while the trace is written. The number of zones dropped so far
+            ///         is written as the droppedZones field of otherData.
+            ///
+            /// @param  stream  the stream to write to
+            ///
+            /// @return the number of zones written
+            ///
+            static size_t write_chrome_json(std::ostream &stream);
+
+            ///
+            /// @brief  Writes every recorded zone as Chrome trace event JSON to a file and removes
+            ///         them.
+            ///
+            /// @param  path    the path of the file, which is replaced
+            ///
+            /// @return the number of zones written
+            ///
+            /// @throw  std::runtime_error if the file could not be written
+            ///
+            static size_t write_chrome_json(const std::string &path);
+
+            ///
+            /// @brief  Determines how many zones were dropped because newer zones overwrote them
+            ///         before the trace was written. Writing the trace more often avoids dropping
+            ///         zones.
+            ///
+            /// @return the number of dropped zones on all threads
+            ///
+            static uint64_t dropped_count(void);
+    };
+
+    ///
+    /// @brief  Records the time between its construction and destruction as a trace zone if
+    ///         tracing was enabled when it was constructed. It is normally created with the
+    ///         LEAF_TRACE_ZONE macro.
+    ///
+    class trace_zone : public unique
+    {
+        private:
+            ///
+            /// @brief  The name of the zone or null if tracing was disabled.
+            ///
+            const char *m_name;
+
+            ///
+            /// @brief  The time in nanoseconds the zone was entered.
+            ///
+            uint64_t m_start_ns;
+
+        public:
+            ///
+            /// @brief  Enters a zone.
+            ///
+            /// @param  name    the name of the zone, which must have static storage duration
+            ///
+            inline trace_zone(const char *name) noexcept
+                // Only read the clock if the zone will be recorded.
+                : m_name(trace::enabled() ? name : NULL), m_start_ns(m_name ? trace::now_ns() : 0)
+                {}
+
+            ///
+            /// @brief  Leaves the zone and records it.
+            ///
+            inline ~trace_zone(void) noexcept
+            {
+                // Record the zone only if it was entered while tracing was enabled.
+                if (m_name)
+                {
+                    trace::record(m_name, m_start_ns, trace::now_ns());
+                }
+            }
+    };
+}
+
+#endif
@@ -0,0 +1,197 @@
+///
+/// @file       display_list.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a class that records drawing operations so that they can be
+///             drawn again without repainting.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include "display_list.hpp"
+#include "../graphics/rect_ops.hpp"
+
+namespace leaf
+{
+    void display_list::record(const draw_command_t &command) noexcept
+    {
+        // Record the operation. If the list cannot grow, the operation is lost rather than
+        // failing the paint.
+        try
+        {
+            m_commands.push_back(command);
+        }
+        catch (const std::exception &) {}
+    }
+
+    void display_list::replay_commands(canvas_i &canvas, const pos2_t &offset,
+        const rect2_t *clip) const noexcept
+    {
+        // Remember whether a recorded clip must be reset once the replay is done.
+        bool is_clipped = clip != NULL;
+
+        if (clip)
+        {
+            canvas.set_clip(*clip);
+        }
+
+        // Make each operation on the canvas, moved by the offset.
+        for (const draw_command_t &command : m_commands)
+        {
+            rect2_t rect = translate(command.rect, offset);
+
+            switch (command.type)
+            {
+                case draw_command_type::fill_rect:
+                    canvas.fill_rect(rect, command.color);
+                    break;
+
+                case draw_command_type::fill_rounded_rect:
+                    canvas.fill_rounded_rect(rect, command.radius, command.color);
+                    break;
+
+                case draw_command_type::stroke_rect:
+                    canvas.stroke_rect(rect, command.width, command.radius, command.color);
+                    break;
+
+                // A recorded clip can only narrow the clip rectangle.
+                case draw_command_type::set_clip:
+                    canvas.set_clip(clip ? intersect(rect, *clip) : rect);
+                    is_clipped = true;
+                    break;
+
+                case draw_command_type::reset_clip:
+                    if (clip)
+                    {
+                        canvas.set_clip(*clip);
+                    }
+                    else
+                    {
+                        canvas.reset_clip();
+                    }
+
+                    break;
+
+                case draw_command_type::draw_text:
+                    canvas.draw_text(rect.pos(), m_runs[command.run], command.color);
+                    break;
+
+                case draw_command_type::draw_atlas_image:
+                    canvas.draw_atlas_image(rect, command.image, command.color);
+                    break;
+
+                case draw_command_type::draw_nine_patch:
+                    canvas.draw_nine_patch(rect, command.image, command.insets, command.color);
+                    break;
+            }
+        }
+
+        // Do not let a clip carry over to whatever is drawn next.
+        if (is_clipped)
+        {
+            canvas.reset_clip();
+        }
+    }
+
+    void display_list::fill_rect(const rect2_t &rect, uint32_t color) noexcept
+    {
+        // Record the operation.
+        record({draw_command_type::fill_rect, rect, color, 0, 0, 0});
+    }
+
+    void display_list::fill_rounded_rect(const rect2_t &rect, px_t radius, uint32_t color)
+        noexcept
+    {
+        // Record the operation.
+        record({draw_command_type::fill_rounded_rect, rect, color, radius, 0, 0});
+    }
+
+    void display_list::stroke_rect(const rect2_t &rect, px_t width, px_t radius, uint32_t color)
+        noexcept
+    {
+        // Record the operation.
+        record({draw_command_type::stroke_rect, rect, color, radius, width, 0});
+    }
+
+    void display_list::set_clip(const rect2_t &clip) noexcept
+    {
+        // Record the operation.
+        record({draw_command_type::set_clip, clip, 0, 0, 0, 0});
+    }
+
+    void display_list::reset_clip(void) noexcept
+    {
+        // Record the operation.
+        record({draw_command_type::reset_clip, rect2_t(0, 0, 0, 0), 0, 0, 0, 0});
+    }
+
+    void display_list::draw_text(const pos2_t &origin, const std::shared_ptr<const text_run_t> &run,
+        uint32_t color) noexcept
+    {
+        if (!run)
+        {
+            return;
+        }
+
+        // Keep the text alive as long as the operation is recorded.
+        try
+        {
+            m_runs.push_back(run);
+        }
+        catch (const std::exception &)
+        {
+            return;
+        }
+
+        record({draw_command_type::draw_text, rect2_t(origin, run->bounds), color, 0, 0,
+            (uint32_t)(m_runs.size() - 1)});
+    }
+
+    void display_list::draw_atlas_image(const rect2_t &rect, const utl::slot_handle_t &image,
+        uint32_t tint) noexcept
+    {
+        // Record the operation.
+        record({draw_command_type::draw_atlas_image, rect, tint, 0, 0, 0, image,
+            border_t(0, 0, 0, 0)});
+    }
+
+    void display_list::draw_nine_patch(const rect2_t &rect, const utl::slot_handle_t &image,
+        const border_t &insets, uint32_t tint) noexcept
+    {
+        // Record the operation.
+        record({draw_command_type::draw_nine_patch, rect, tint, 0, 0, 0, image, insets});
+    }
+
+    void display_list::clear(void) noexcept
+    {
+        // Drop the operations and release their text but keep the memory.
+        m_commands.clear();
+        m_runs.clear();
+    }
+
+    size_t display_list::size(void) const noexcept
+    {
+        // Return the number of recorded operations.
+        return m_commands.size();
+    }
+
+    bool display_list::empty(void) const noexcept
+    {
+        // Determine whether there are any recorded operations.
+        return m_commands.empty();
+    }
+
+    void display_list::replay(canvas_i &canvas, const pos2_t &offset) const noexcept
+    {
+        // Replay without a clip rectangle.
+        replay_commands(canvas, offset, NULL);
+    }
+
+    void display_list::replay(canvas_i &canvas, const pos2_t &offset, const rect2_t &clip) const
+        noexcept
+    {
+        // Replay inside the clip rectangle.
+        replay_commands(canvas, offset, &clip);
+    }
+}
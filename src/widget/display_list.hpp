@@ -0,0 +1,240 @@
+///
+/// @file       display_list.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a class that records drawing operations so that they can be drawn again
+///             without repainting.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_DISPLAY_LIST_HEADER_GUARD
+#define LEAF_SRC_DISPLAY_LIST_HEADER_GUARD
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "../graphics/graphics_types.hpp"
+#include "../graphics/render/canvas_i.hpp"
+
+namespace leaf
+{
+    ///
+    /// @brief  Identifies a kind of recorded drawing operation.
+    ///
+    enum class draw_command_type : uint8_t
+    {
+        fill_rect,
+        fill_rounded_rect,
+        stroke_rect,
+        set_clip,
+        reset_clip,
+        draw_text,
+        draw_atlas_image,
+        draw_nine_patch
+    };
+
+    ///
+    /// @brief  Represents a recorded drawing operation.
+    ///
+    typedef struct draw_command
+    {
+        ///
+        /// @brief  The kind of operation.
+        ///
+        draw_command_type type;
+
+        ///
+        /// @brief  The rectangle the operation covers.
+        ///
+        rect2_t rect;
+
+        ///
+        /// @brief  The color of the operation.
+        ///
+        uint32_t color;
+
+        ///
+        /// @brief  The radius of the corners of the operation in pixels.
+        ///
+        px_t radius;
+
+        ///
+        /// @brief  The width of the border of the operation in pixels.
+        ///
+        px_t width;
+
+        ///
+        /// @brief  The index of the laid out text of the operation in the list.
+        ///
+        uint32_t run;
+
+        ///
+        /// @brief  The handle to the atlas image of the operation.
+        ///
+        utl::slot_handle_t image;
+
+        ///
+        /// @brief  The size of the corners and edges of the nine-patch of the operation.
+        ///
+        border_t insets;
+
+    } draw_command_t;
+
+    ///
+    /// @brief  A canvas that records the drawing operations made on it, so that they can be
+    ///         replayed onto another canvas any number of times. The recorded coordinates can be
+    ///         offset when they are replayed, so a widget records its painting relative to its own
+    ///         corner and can be moved without repainting.
+    ///
+    class display_list : public canvas_i
+    {
+        private:
+            ///
+            /// @brief  The recorded operations in order.
+            ///
+            std::vector<draw_command_t> m_commands;
+
+            ///
+            /// @brief  The laid out text of the recorded operations, kept alive until the list is
+            ///         cleared.
+            ///
+            std::vector<std::shared_ptr<const text_run_t>> m_runs;
+
+            ///
+            /// @brief  Records an operation. If the list cannot grow, the operation is lost rather
+            ///         than failing the paint.
+            ///
+            /// @param  command the operation
+            ///
+            void record(const draw_command_t &command) noexcept;
+
+            ///
+            /// @brief  Makes the recorded operations onto another canvas in order, cut to a clip
+            ///         rectangle if there is one. A recorded clip is cut to the clip rectangle as
+            ///         well, and resetting it restores the clip rectangle.
+            ///
+            /// @param  canvas  the canvas to draw onto
+            /// @param  offset  the offset added to every recorded coordinate
+            /// @param  clip    the rectangle to draw inside of or null to draw everything
+            ///
+            void replay_commands(canvas_i &canvas, const pos2_t &offset, const rect2_t *clip) const
+                noexcept;
+
+        public:
+            ///
+            /// @brief  Records a rectangle fill.
+            ///
+            /// @param  rect    the rectangle to fill
+            /// @param  color   the color to fill with
+            ///
+            virtual void fill_rect(const rect2_t &rect, uint32_t color) noexcept override;
+
+            ///
+            /// @brief  Records a fill of a rectangle with rounded corners.
+            ///
+            /// @param  rect    the rectangle to fill
+            /// @param  radius  the radius of the corners in pixels
+            /// @param  color   the color to fill with
+            ///
+            virtual void fill_rounded_rect(const rect2_t &rect, px_t radius, uint32_t color)
+                noexcept override;
+
+            ///
+            /// @brief  Records a border along the inside of a rectangle.
+            ///
+            /// @param  rect    the outer edge of the border
+            /// @param  width   the width of the border in pixels
+            /// @param  radius  the radius of the outer corners in pixels
+            /// @param  color   the color of the border
+            ///
+            virtual void stroke_rect(const rect2_t &rect, px_t width, px_t radius, uint32_t color)
+                noexcept override;
+
+            ///
+            /// @brief  Records a change of the clip rectangle.
+            ///
+            /// @param  clip    the rectangle to draw inside of
+            ///
+            virtual void set_clip(const rect2_t &clip) noexcept override;
+
+            ///
+            /// @brief  Records that the clip rectangle is reset.
+            ///
+            virtual void reset_clip(void) noexcept override;
+
+            ///
+            /// @brief  Records a draw of laid out text.
+            ///
+            /// @param  origin  the position of the top-left corner of the text
+            /// @param  run     the laid out text
+            /// @param  color   the color of the text
+            ///
+            virtual void draw_text(const pos2_t &origin,
+                const std::shared_ptr<const text_run_t> &run, uint32_t color) noexcept override;
+
+            ///
+            /// @brief  Records a draw of an atlas image.
+            ///
+            /// @param  rect    the rectangle to draw into
+            /// @param  image   the handle to the image in the atlas
+            /// @param  tint    the color the image is multiplied with
+            ///
+            virtual void draw_atlas_image(const rect2_t &rect, const utl::slot_handle_t &image,
+                uint32_t tint) noexcept override;
+
+            ///
+            /// @brief  Records a draw of an atlas image as a nine-patch.
+            ///
+            /// @param  rect    the rectangle to draw into
+            /// @param  image   the handle to the image in the atlas
+            /// @param  insets  the size of the corners and edges in pixels of the image
+            /// @param  tint    the color the image is multiplied with
+            ///
+            virtual void draw_nine_patch(const rect2_t &rect, const utl::slot_handle_t &image,
+                const border_t &insets, uint32_t tint) noexcept override;
+
+            ///
+            /// @brief  Removes every recorded operation. The memory of the list is kept so that
+            ///         recording again does not allocate.
+            ///
+            void clear(void) noexcept;
+
+            ///
+            /// @brief  Determines how many operations are recorded.
+            ///
+            /// @return the number of operations
+            ///
+            size_t size(void) const noexcept;
+
+            ///
+            /// @brief  Determines whether no operations are recorded.
+            ///
+            /// @return true if and only if the list is empty
+            ///
+            bool empty(void) const noexcept;
+
+            ///
+            /// @brief  Makes the recorded operations onto another canvas in order.
+            ///
+            /// @param  canvas  the canvas to draw onto
+            /// @param  offset  the offset added to every recorded coordinate
+            ///
+            void replay(canvas_i &canvas, const pos2_t &offset) const noexcept;
+
+            ///
+            /// @brief  Makes the recorded operations onto another canvas in order, cut to a clip
+            ///         rectangle. The clip of the canvas is reset afterwards.
+            ///
+            /// @param  canvas  the canvas to draw onto
+            /// @param  offset  the offset added to every recorded coordinate
+            /// @param  clip    the rectangle to draw inside of, in the coordinates of the canvas
+            ///
+            void replay(canvas_i &canvas, const pos2_t &offset, const rect2_t &clip) const
+                noexcept;
+    };
+}
+
+#endif
@@ -0,0 +1,339 @@
+///
+/// @file       flex_box.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a widget that arranges its children in a row or a column.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <algorithm>
+#include <cmath>
+#include "flex_box.hpp"
+#include "../graphics/rect_ops.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    ///
+    /// @brief  Determines the length of a size along the main axis.
+    ///
+    /// @param  size        the size
+    /// @param  direction   the main axis
+    ///
+    /// @return the length along the main axis
+    ///
+    static inline int32_t main_of(const bounds2_t &size, flex_direction direction) noexcept
+    {
+        // Rows are placed along the width and columns along the height.
+        return direction == flex_direction::row ? size.width : size.height;
+    }
+
+    ///
+    /// @brief  Determines the length of a size along the cross axis.
+    ///
+    /// @param  size        the size
+    /// @param  direction   the main axis
+    ///
+    /// @return the length along the cross axis
+    ///
+    static inline int32_t cross_of(const bounds2_t &size, flex_direction direction) noexcept
+    {
+        // The cross axis is the other one.
+        return direction == flex_direction::row ? size.height : size.width;
+    }
+
+    ///
+    /// @brief  Builds a size from its lengths along the main and cross axes.
+    ///
+    /// @param  main        the length along the main axis
+    /// @param  cross       the length along the cross axis
+    /// @param  direction   the main axis
+    ///
+    /// @return the size, limited to the pixel type
+    ///
+    static inline bounds2_t from_axes(int32_t main, int32_t cross, flex_direction direction)
+        noexcept
+    {
+        // Swap the lengths back for columns.
+        return direction == flex_direction::row ? bounds2_t(clamp_px(main), clamp_px(cross))
+            : bounds2_t(clamp_px(cross), clamp_px(main));
+    }
+
+    flex_box::flex_box(flex_direction direction) noexcept
+        // Place from the start and stretch across, with no gap or padding.
+        : m_direction(direction), m_justify(flex_justify::start), m_align(flex_align::stretch),
+        m_gap(0), m_padding(0, 0, 0, 0) {}
+
+    size_constraints_t flex_box::child_constraints(px_t cross_min, px_t cross_max) const noexcept
+    {
+        // Leave the main axis unbounded so the children report the length they want. It then
+        // only changes when the cross axis does, which keeps the measurements valid while the box
+        // is resized along its main axis.
+        if (m_direction == flex_direction::row)
+        {
+            return size_constraints_t(0, LEAF_LAYOUT_UNBOUNDED, cross_min, cross_max);
+        }
+
+        return size_constraints_t(cross_min, cross_max, 0, LEAF_LAYOUT_UNBOUNDED);
+    }
+
+    void flex_box::layout(void) noexcept
+    {
+        bool is_row = m_direction == flex_direction::row;
+        const rect2_t &frame = this->frame();
+
+        // Find the space inside the padding.
+        int32_t inner_width = max(0, (int32_t)frame.width - m_padding.left - m_padding.right);
+        int32_t inner_height = max(0, (int32_t)frame.height - m_padding.top - m_padding.bottom);
+        int32_t inner_main = is_row ? inner_width : inner_height;
+        int32_t inner_cross = is_row ? inner_height : inner_width;
+
+        // Stretched children are given exactly the cross length, others at most that.
+        px_t cross_max = clamp_px(inner_cross);
+        px_t cross_min = m_align == flex_align::stretch ? cross_max : 0;
+        size_constraints_t constraints = child_constraints(cross_min, cross_max);
+
+        // Measure the visible children. Children whose constraints did not change return their
+        // remembered measurements.
+        int32_t total_main = 0;
+        float total_grow = 0;
+        float total_shrink = 0;
+        m_child_sizes.clear();
+
+        for (size_t i = 0; i < child_count(); i++)
+        {
+            widget *item = child(i);
+
+            if (!item->is_visible())
+            {
+                continue;
+            }
+
+            bounds2_t size = item->measured_size(constraints);
+            m_child_sizes.push_back(size);
+
+            total_main += main_of(size, m_direction);
+            total_grow += item->grow();
+            total_shrink += item->shrink() * main_of(size, m_direction);
+        }
+
+        if (m_child_sizes.empty())
+        {
+            return;
+        }
+
+        // Find the space left over or missing once the children and the gaps are placed. Space
+        // left over that no child grows into is distributed by the justification.
+        int32_t count = (int32_t)m_child_sizes.size();
+        int32_t free_space = inner_main - total_main - m_gap * (count - 1);
+        bool is_growing = free_space > 0 && total_grow > 0;
+        bool is_shrinking = free_space < 0 && total_shrink > 0;
+        float leftover = is_growing ? 0 : (float)max(free_space, 0);
+        float spacing = m_gap;
+        float pos = 0;
+
+        if (m_justify == flex_justify::center)
+        {
+            pos = leftover / 2;
+        }
+        else if (m_justify == flex_justify::end)
+        {
+            pos = leftover;
+        }
+        else if (m_justify == flex_justify::space_between && count > 1)
+        {
+            spacing += leftover / (count - 1);
+        }
+
+        // Place the children. A child whose size does not change keeps its layout and painting.
+        size_t index = 0;
+
+        for (size_t i = 0; i < child_count(); i++)
+        {
+            widget *item = child(i);
+
+            if (!item->is_visible())
+            {
+                continue;
+            }
+
+            const bounds2_t &size = m_child_sizes[index++];
+            float main = main_of(size, m_direction);
+
+            if (is_growing)
+            {
+                main += free_space * item->grow() / total_grow;
+            }
+            else if (is_shrinking)
+            {
+                main += free_space * item->shrink() * main_of(size, m_direction) / total_shrink;
+            }
+
+            // Round the edges rather than the lengths, so that rounding does not add up along
+            // the row or column.
+            main = max(main, 0.0f);
+            int32_t main_start = (int32_t)lround(pos);
+            int32_t main_length = (int32_t)lround(pos + main) - main_start;
+            pos += main + spacing;
+
+            // Place the child across.
+            int32_t cross = m_align == flex_align::stretch ? inner_cross
+                : min(cross_of(size, m_direction), inner_cross);
+            int32_t cross_start = 0;
+
+            if (m_align == flex_align::center)
+            {
+                cross_start = (inner_cross - cross) / 2;
+            }
+            else if (m_align == flex_align::end)
+            {
+                cross_start = inner_cross - cross;
+            }
+
+            int32_t x = m_padding.left + (is_row ? main_start : cross_start);
+            int32_t y = m_padding.top + (is_row ? cross_start : main_start);
+            bounds2_t bounds = from_axes(main_length, cross, m_direction);
+
+            item->set_frame(rect2_t(clamp_px(x), clamp_px(y), bounds.width, bounds.height));
+        }
+    }
+
+    bounds2_t flex_box::measure(const size_constraints_t &constraints) noexcept
+    {
+        bool is_row = m_direction == flex_direction::row;
+        int32_t padding_main = is_row ? m_padding.left + m_padding.right
+            : m_padding.top + m_padding.bottom;
+        int32_t padding_cross = is_row ? m_padding.top + m_padding.bottom
+            : m_padding.left + m_padding.right;
+
+        // Pass the cross constraints on to the children without the padding. Stretched children
+        // are given the smallest cross length as well, so that they are measured the same way
+        // they are arranged when the box is given exactly one length.
+        int32_t min_cross = is_row ? constraints.min_height : constraints.min_width;
+        int32_t max_cross = is_row ? constraints.max_height : constraints.max_width;
+        px_t child_max = max_cross == LEAF_LAYOUT_UNBOUNDED ? LEAF_LAYOUT_UNBOUNDED
+            : clamp_px(max(0, max_cross - padding_cross));
+        px_t child_min = m_align == flex_align::stretch
+            ? min(clamp_px(max(0, min_cross - padding_cross)), child_max) : 0;
+        size_constraints_t child_constraints = this->child_constraints(child_min, child_max);
+
+        // Add up the children along the main axis and take the largest across.
+        int32_t total_main = 0;
+        int32_t largest_cross = 0;
+        int32_t count = 0;
+
+        for (size_t i = 0; i < child_count(); i++)
+        {
+            widget *item = child(i);
+
+            if (!item->is_visible())
+            {
+                continue;
+            }
+
+            bounds2_t size = item->measured_size(child_constraints);
+            total_main += main_of(size, m_direction);
+            largest_cross = max(largest_cross, cross_of(size, m_direction));
+            count++;
+        }
+
+        int32_t gaps = count > 1 ? m_gap * (count - 1) : 0;
+
+        return from_axes(total_main + gaps + padding_main, largest_cross + padding_cross,
+            m_direction);
+    }
+
+    flex_direction flex_box::direction(void) const noexcept
+    {
+        // Return the direction.
+        return m_direction;
+    }
+
+    flex_box *flex_box::set_direction(flex_direction direction) noexcept
+    {
+        // The size the box wants depends on the direction.
+        if (direction != m_direction)
+        {
+            m_direction = direction;
+            invalidate_measure();
+        }
+
+        return this;
+    }
+
+    flex_justify flex_box::justify(void) const noexcept
+    {
+        // Return the justification.
+        return m_justify;
+    }
+
+    flex_box *flex_box::set_justify(flex_justify justify) noexcept
+    {
+        // The justification only moves the children.
+        if (justify != m_justify)
+        {
+            m_justify = justify;
+            invalidate_layout();
+        }
+
+        return this;
+    }
+
+    flex_align flex_box::align(void) const noexcept
+    {
+        // Return the alignment.
+        return m_align;
+    }
+
+    flex_box *flex_box::set_align(flex_align align) noexcept
+    {
+        // Stretched children are measured with different constraints.
+        if (align != m_align)
+        {
+            m_align = align;
+            invalidate_measure();
+        }
+
+        return this;
+    }
+
+    px_t flex_box::gap(void) const noexcept
+    {
+        // Return the gap.
+        return m_gap;
+    }
+
+    flex_box *flex_box::set_gap(px_t gap) noexcept
+    {
+        // The size the box wants depends on the gap.
+        if (gap != m_gap)
+        {
+            m_gap = gap;
+            invalidate_measure();
+        }
+
+        return this;
+    }
+
+    const border_t &flex_box::padding(void) const noexcept
+    {
+        // Return the padding.
+        return m_padding;
+    }
+
+    flex_box *flex_box::set_padding(const border_t &padding) noexcept
+    {
+        // The size the box wants depends on the padding.
+        if (padding.left != m_padding.left || padding.top != m_padding.top
+            || padding.right != m_padding.right || padding.bottom != m_padding.bottom)
+        {
+            m_padding = padding;
+            invalidate_measure();
+        }
+
+        return this;
+    }
+}
@@ -0,0 +1,190 @@
+///
+/// @file       flex_box.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a widget that arranges its children in a row or a column, in the manner
+///             of a single-line CSS flexbox.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_FLEX_BOX_HEADER_GUARD
+#define LEAF_SRC_FLEX_BOX_HEADER_GUARD
+
+#include <cstdint>
+#include <vector>
+#include "../graphics/graphics_types.hpp"
+#include "layout_types.hpp"
+#include "widget.hpp"
+
+namespace leaf
+{
+    ///
+    /// @brief  Arranges its visible children one after another along a main axis, in the manner
+    ///         of a single-line CSS flexbox. Each child is measured without a limit along the main
+    ///         axis, then grows into the space left over or shrinks to fit according to its grow
+    ///         and shrink factors.
+    ///
+    ///         The children are measured through their remembered measurements, so arranging the
+    ///         box again after it was resized only measures the children whose constraints changed.
+    ///         A child whose size does not change is not laid out again either.
+    ///
+    class flex_box : public widget
+    {
+        private:
+            ///
+            /// @brief  The axis the children are placed along.
+            ///
+            flex_direction m_direction;
+
+            ///
+            /// @brief  How the space left over along the main axis is distributed.
+            ///
+            flex_justify m_justify;
+
+            ///
+            /// @brief  How the children are placed along the cross axis.
+            ///
+            flex_align m_align;
+
+            ///
+            /// @brief  The space between adjacent children in pixels.
+            ///
+            px_t m_gap;
+
+            ///
+            /// @brief  The space between the frame and the children in pixels.
+            ///
+            border_t m_padding;
+
+            ///
+            /// @brief  The sizes of the visible children measured by the last layout. The memory
+            ///         is reused between layouts.
+            ///
+            std::vector<bounds2_t> m_child_sizes;
+
+            ///
+            /// @brief  Determines the constraints the children are measured with.
+            ///
+            /// @param  cross_min   the smallest size allowed along the cross axis
+            /// @param  cross_max   the largest size allowed along the cross axis
+            ///
+            /// @return the constraints, unbounded along the main axis
+            ///
+            size_constraints_t child_constraints(px_t cross_min, px_t cross_max) const noexcept;
+
+        protected:
+            ///
+            /// @brief  Measures the visible children and places them inside the padding.
+            ///
+            virtual void layout(void) noexcept override;
+
+            ///
+            /// @brief  Measures the size the children want placed one after another, including the
+            ///         gaps and the padding.
+            ///
+            /// @param  constraints the range of sizes allowed
+            ///
+            /// @return the size the box wants
+            ///
+            virtual bounds2_t measure(const size_constraints_t &constraints) noexcept override;
+
+        public:
+            ///
+            /// @brief  Constructs an empty flex box that places its children from the start and
+            ///         stretches them across, with no gap or padding.
+            ///
+            /// @param  direction   the axis the children are placed along
+            ///
+            flex_box(flex_direction direction = flex_direction::row) noexcept;
+
+            ///
+            /// @brief  Returns the axis the children are placed along.
+            ///
+            /// @return the direction
+            ///
+            flex_direction direction(void) const noexcept;
+
+            ///
+            /// @brief  Sets the axis the children are placed along. This invalidates the
+            ///         measurements if the direction changes.
+            ///
+            /// @param  direction   the direction
+            ///
+            /// @return a pointer to this flex box for chaining
+            ///
+            flex_box *set_direction(flex_direction direction) noexcept;
+
+            ///
+            /// @brief  Returns how the space left over along the main axis is distributed.
+            ///
+            /// @return the justification
+            ///
+            flex_justify justify(void) const noexcept;
+
+            ///
+            /// @brief  Sets how the space left over along the main axis is distributed. This
+            ///         invalidates the layout if the justification changes.
+            ///
+            /// @param  justify the justification
+            ///
+            /// @return a pointer to this flex box for chaining
+            ///
+            flex_box *set_justify(flex_justify justify) noexcept;
+
+            ///
+            /// @brief  Returns how the children are placed along the cross axis.
+            ///
+            /// @return the alignment
+            ///
+            flex_align align(void) const noexcept;
+
+            ///
+            /// @brief  Sets how the children are placed along the cross axis. This invalidates the
+            ///         measurements if the alignment changes, since stretched children are measured
+            ///         with different constraints.
+            ///
+            /// @param  align   the alignment
+            ///
+            /// @return a pointer to this flex box for chaining
+            ///
+            flex_box *set_align(flex_align align) noexcept;
+
+            ///
+            /// @brief  Returns the space between adjacent children.
+            ///
+            /// @return the gap in pixels
+            ///
+            px_t gap(void) const noexcept;
+
+            ///
+            /// @brief  Sets the space between adjacent children. This invalidates the measurements
+            ///         if the gap changes.
+            ///
+            /// @param  gap the gap in pixels
+            ///
+            /// @return a pointer to this flex box for chaining
+            ///
+            flex_box *set_gap(px_t gap) noexcept;
+
+            ///
+            /// @brief  Returns the space between the frame and the children.
+            ///
+            /// @return the padding in pixels
+            ///
+            const border_t &padding(void) const noexcept;
+
+            ///
+            /// @brief  Sets the space between the frame and the children. This invalidates the
+            ///         measurements if the padding changes.
+            ///
+            /// @param  padding the padding in pixels
+            ///
+            /// @return a pointer to this flex box for chaining
+            ///
+            flex_box *set_padding(const border_t &padding) noexcept;
+    };
+}
+
+#endif
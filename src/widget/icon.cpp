@@ -0,0 +1,105 @@
+///
+/// @file       icon.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a widget that shows an image from a texture atlas.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <stdexcept>
+#include "icon.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    void icon::paint(canvas_i &canvas) noexcept
+    {
+        // Fill the background first.
+        widget::paint(canvas);
+
+        rect2_t rect(0, 0, frame().width, frame().height);
+
+        if (m_is_nine_patch)
+        {
+            canvas.draw_nine_patch(rect, m_image, m_insets, m_tint);
+        }
+        else
+        {
+            canvas.draw_atlas_image(rect, m_image, m_tint);
+        }
+    }
+
+    bounds2_t icon::measure(const size_constraints_t &constraints) noexcept
+    {
+        // A preferred size overrides the size of the image.
+        bounds2_t size = preferred_size();
+
+        if (size.width == 0 && size.height == 0)
+        {
+            m_atlas->image_size(m_image, size);
+        }
+
+        return size;
+    }
+
+    icon::icon(texture_atlas *atlas, const utl::slot_handle_t &image, uint32_t tint)
+        // Stretch the image until a nine-patch is set.
+        : m_atlas(atlas), m_image(image), m_insets(0, 0, 0, 0), m_is_nine_patch(false),
+        m_tint(tint)
+    {
+        if (!atlas)
+        {
+            throw runtime_error("An icon must be given a texture atlas.");
+        }
+    }
+
+    const utl::slot_handle_t &icon::image(void) const noexcept
+    {
+        // Return the handle.
+        return m_image;
+    }
+
+    icon *icon::set_image(const utl::slot_handle_t &image) noexcept
+    {
+        // Only measure again if the image changes.
+        if (image != m_image)
+        {
+            m_image = image;
+            invalidate_measure();
+            invalidate_paint();
+        }
+
+        return this;
+    }
+
+    icon *icon::set_nine_patch(const border_t &insets) noexcept
+    {
+        // Draw the image in nine patches from now on.
+        m_insets = insets;
+        m_is_nine_patch = true;
+        invalidate_paint();
+
+        return this;
+    }
+
+    uint32_t icon::tint(void) const noexcept
+    {
+        // Return the tint.
+        return m_tint;
+    }
+
+    icon *icon::set_tint(uint32_t tint) noexcept
+    {
+        // Only repaint if the tint changes.
+        if (tint != m_tint)
+        {
+            m_tint = tint;
+            invalidate_paint();
+        }
+
+        return this;
+    }
+}
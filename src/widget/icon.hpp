@@ -0,0 +1,132 @@
+///
+/// @file       icon.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a widget that shows an image from a texture atlas.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_ICON_HEADER_GUARD
+#define LEAF_SRC_ICON_HEADER_GUARD
+
+#include <cstdint>
+#include "../utils/slot_map.hpp"
+#include "../graphics/graphics_types.hpp"
+#include "../graphics/render/texture_atlas.hpp"
+#include "layout_types.hpp"
+#include "widget.hpp"
+
+namespace leaf
+{
+    ///
+    /// @brief  Shows an image from a texture atlas stretched over its frame, or as a nine-patch
+    ///         whose corners keep their size. Icons of the same atlas drawn one after another share
+    ///         a texture, so their quads are merged into one draw.
+    ///
+    class icon : public widget
+    {
+        private:
+            ///
+            /// @brief  The atlas the image is in.
+            ///
+            texture_atlas *m_atlas;
+
+            ///
+            /// @brief  The handle to the image.
+            ///
+            utl::slot_handle_t m_image;
+
+            ///
+            /// @brief  The size of the corners and edges of the nine-patch in pixels of the image.
+            ///
+            border_t m_insets;
+
+            ///
+            /// @brief  Whether the image is drawn as a nine-patch.
+            ///
+            bool m_is_nine_patch;
+
+            ///
+            /// @brief  The color the image is multiplied with.
+            ///
+            uint32_t m_tint;
+
+        protected:
+            ///
+            /// @brief  Fills the frame with the background color, if there is one, and draws the
+            ///         image over the frame.
+            ///
+            /// @param  canvas  the canvas to paint onto
+            ///
+            virtual void paint(canvas_i &canvas) noexcept override;
+
+            ///
+            /// @brief  Measures the image, or the preferred size if one was set.
+            ///
+            /// @param  constraints the range of sizes allowed
+            ///
+            /// @return the size of the image
+            ///
+            virtual bounds2_t measure(const size_constraints_t &constraints) noexcept override;
+
+        public:
+            ///
+            /// @brief  Constructs an icon that stretches an image over its frame.
+            ///
+            /// @param  atlas   the atlas the image is in, which must outlive the icon
+            /// @param  image   the handle to the image
+            /// @param  tint    the color the image is multiplied with
+            ///
+            /// @throw  runtime_error if the atlas is null
+            ///
+            icon(texture_atlas *atlas, const utl::slot_handle_t &image,
+                uint32_t tint = 0xffffffff);
+
+            ///
+            /// @brief  Returns the handle to the image.
+            ///
+            /// @return the handle
+            ///
+            const utl::slot_handle_t &image(void) const noexcept;
+
+            ///
+            /// @brief  Sets the image. This invalidates the measurements of the icon if the image
+            ///         changes.
+            ///
+            /// @param  image   the handle to the new image
+            ///
+            /// @return a pointer to this icon for chaining
+            ///
+            icon *set_image(const utl::slot_handle_t &image) noexcept;
+
+            ///
+            /// @brief  Draws the image as a nine-patch. This invalidates the painting of the icon.
+            ///
+            /// @param  insets  the size of the corners and edges in pixels of the image
+            ///
+            /// @return a pointer to this icon for chaining
+            ///
+            icon *set_nine_patch(const border_t &insets) noexcept;
+
+            ///
+            /// @brief  Returns the color the image is multiplied with.
+            ///
+            /// @return the tint
+            ///
+            uint32_t tint(void) const noexcept;
+
+            ///
+            /// @brief  Sets the color the image is multiplied with. This only invalidates the
+            ///         painting of the icon.
+            ///
+            /// @param  tint    the new tint
+            ///
+            /// @return a pointer to this icon for chaining
+            ///
+            icon *set_tint(uint32_t tint) noexcept;
+    };
+}
+
+#endif
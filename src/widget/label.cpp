@@ -0,0 +1,124 @@
+///
+/// @file       label.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a widget that shows text.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <stdexcept>
+#include "label.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    shared_ptr<const text_run_t> label::layout_text(px_t max_width) noexcept
+    {
+        // Keep the text on one line if it fits, so that every width it fits shares one layout.
+        shared_ptr<const text_run_t> run = m_cache->layout(m_text, m_font, m_size);
+
+        if (run && run->bounds.width > max_width)
+        {
+            run = m_cache->layout(m_text, m_font, m_size, max_width);
+        }
+
+        return run;
+    }
+
+    void label::paint(canvas_i &canvas) noexcept
+    {
+        // Fill the background first.
+        widget::paint(canvas);
+
+        shared_ptr<const text_run_t> run = layout_text(frame().width);
+
+        if (run)
+        {
+            canvas.draw_text(pos2_t(0, 0), run, m_color);
+        }
+    }
+
+    bounds2_t label::measure(const size_constraints_t &constraints) noexcept
+    {
+        // Want the size of the text, which is limited to the constraints by the caller.
+        shared_ptr<const text_run_t> run = layout_text(constraints.max_width);
+
+        return run ? run->bounds : bounds2_t(0, 0);
+    }
+
+    label::label(text_layout_cache *cache, const string &text, const shared_ptr<const font> &face,
+        px_t size, uint32_t color)
+        // Initialize the text and how it looks.
+        : m_cache(cache), m_text(text), m_font(face), m_size(size), m_color(color)
+    {
+        if (!cache)
+        {
+            throw runtime_error("A label must be given a text layout cache.");
+        }
+
+        if (!face)
+        {
+            throw runtime_error("A label must be given a font.");
+        }
+    }
+
+    const string &label::text(void) const noexcept
+    {
+        // Return the text.
+        return m_text;
+    }
+
+    label *label::set_text(const string &text)
+    {
+        // Only measure again if the text changes. A new size is painted again by the layout, but
+        // text of the same size must be painted here.
+        if (text != m_text)
+        {
+            m_text = text;
+            invalidate_measure();
+            invalidate_paint();
+        }
+
+        return this;
+    }
+
+    px_t label::size(void) const noexcept
+    {
+        // Return the size.
+        return m_size;
+    }
+
+    label *label::set_size(px_t size) noexcept
+    {
+        // Only measure again if the size changes.
+        if (size != m_size)
+        {
+            m_size = size;
+            invalidate_measure();
+            invalidate_paint();
+        }
+
+        return this;
+    }
+
+    uint32_t label::color(void) const noexcept
+    {
+        // Return the color.
+        return m_color;
+    }
+
+    label *label::set_color(uint32_t color) noexcept
+    {
+        // Only repaint if the color changes.
+        if (color != m_color)
+        {
+            m_color = color;
+            invalidate_paint();
+        }
+
+        return this;
+    }
+}
@@ -0,0 +1,154 @@
+///
+/// @file       label.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a widget that shows text.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_LABEL_HEADER_GUARD
+#define LEAF_SRC_LABEL_HEADER_GUARD
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "../graphics/graphics_types.hpp"
+#include "../graphics/text/font.hpp"
+#include "../graphics/text/text_layout_cache.hpp"
+#include "layout_types.hpp"
+#include "widget.hpp"
+
+namespace leaf
+{
+    ///
+    /// @brief  Shows text in one font, size, and color. The text is laid out through a text layout
+    ///         cache on one line, and is wrapped at spaces when it does not fit the width it is
+    ///         given. Measuring and painting a label whose text did not change only looks up the
+    ///         layout in the cache.
+    ///
+    class label : public widget
+    {
+        private:
+            ///
+            /// @brief  The cache the text is laid out through.
+            ///
+            text_layout_cache *m_cache;
+
+            ///
+            /// @brief  The text in UTF-8.
+            ///
+            std::string m_text;
+
+            ///
+            /// @brief  The font of the text.
+            ///
+            std::shared_ptr<const font> m_font;
+
+            ///
+            /// @brief  The height of a line in pixels.
+            ///
+            px_t m_size;
+
+            ///
+            /// @brief  The color of the text.
+            ///
+            uint32_t m_color;
+
+            ///
+            /// @brief  Lays out the text to fit a width, only wrapping it if it does not fit on one
+            ///         line.
+            ///
+            /// @param  max_width   the width to fit the text to
+            ///
+            /// @return the layout, or null if there was not enough memory
+            ///
+            std::shared_ptr<const text_run_t> layout_text(px_t max_width) noexcept;
+
+        protected:
+            ///
+            /// @brief  Fills the frame with the background color, if there is one, and draws the
+            ///         text wrapped to the width of the frame.
+            ///
+            /// @param  canvas  the canvas to paint onto
+            ///
+            virtual void paint(canvas_i &canvas) noexcept override;
+
+            ///
+            /// @brief  Measures the text wrapped to the largest width allowed.
+            ///
+            /// @param  constraints the range of sizes allowed
+            ///
+            /// @return the size of the text
+            ///
+            virtual bounds2_t measure(const size_constraints_t &constraints) noexcept override;
+
+        public:
+            ///
+            /// @brief  Constructs a label.
+            ///
+            /// @param  cache   the cache to lay out the text through, which must outlive the label
+            /// @param  text    the text in UTF-8
+            /// @param  face    the font of the text
+            /// @param  size    the height of a line in pixels
+            /// @param  color   the color of the text
+            ///
+            /// @throw  runtime_error if the cache or the font is null
+            ///
+            label(text_layout_cache *cache, const std::string &text,
+                const std::shared_ptr<const font> &face, px_t size, uint32_t color = 0xffffffff);
+
+            ///
+            /// @brief  Returns the text.
+            ///
+            /// @return the text in UTF-8
+            ///
+            const std::string &text(void) const noexcept;
+
+            ///
+            /// @brief  Sets the text. This invalidates the measurements of the label if the text
+            ///         changes.
+            ///
+            /// @param  text    the new text in UTF-8
+            ///
+            /// @return a pointer to this label for chaining
+            ///
+            label *set_text(const std::string &text);
+
+            ///
+            /// @brief  Returns the height of a line.
+            ///
+            /// @return the size in pixels
+            ///
+            px_t size(void) const noexcept;
+
+            ///
+            /// @brief  Sets the height of a line. This invalidates the measurements of the label if
+            ///         the size changes.
+            ///
+            /// @param  size    the new size in pixels
+            ///
+            /// @return a pointer to this label for chaining
+            ///
+            label *set_size(px_t size) noexcept;
+
+            ///
+            /// @brief  Returns the color of the text.
+            ///
+            /// @return the color
+            ///
+            uint32_t color(void) const noexcept;
+
+            ///
+            /// @brief  Sets the color of the text. This only invalidates the painting of the label.
+            ///
+            /// @param  color   the new color
+            ///
+            /// @return a pointer to this label for chaining
+            ///
+            label *set_color(uint32_t color) noexcept;
+    };
+}
+
+#endif
@@ -0,0 +1,150 @@
+///
+/// @file       layout_types.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for the types that describe how widgets are measured and arranged.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_LAYOUT_TYPES_HEADER_GUARD
+#define LEAF_SRC_LAYOUT_TYPES_HEADER_GUARD
+
+#include <cstdint>
+#include "../graphics/graphics_types.hpp"
+
+///
+/// @brief  The largest size a constraint can allow, meaning there is no limit.
+///
+#define LEAF_LAYOUT_UNBOUNDED (leaf::px_t)INT16_MAX
+
+namespace leaf
+{
+    ///
+    /// @brief  Represents the range of sizes a widget may take when it is measured. A widget is
+    ///         only measured again when it is given different constraints or its content changes.
+    ///
+    typedef struct size_constraints
+    {
+        ///
+        /// @brief  The smallest width allowed in pixels.
+        ///
+        px_t min_width;
+
+        ///
+        /// @brief  The largest width allowed in pixels, or unbounded.
+        ///
+        px_t max_width;
+
+        ///
+        /// @brief  The smallest height allowed in pixels.
+        ///
+        px_t min_height;
+
+        ///
+        /// @brief  The largest height allowed in pixels, or unbounded.
+        ///
+        px_t max_height;
+
+        ///
+        /// @brief  Constructs a new size constraints structure.
+        ///
+        /// @note   This implementation is set to default; it just allocates the space but does not
+        ///         update the memory content.
+        ///
+        size_constraints(void) noexcept = default;
+
+        ///
+        /// @brief  Constructs a new size constraints structure.
+        ///
+        /// @param  min_width   the smallest width allowed
+        /// @param  max_width   the largest width allowed
+        /// @param  min_height  the smallest height allowed
+        /// @param  max_height  the largest height allowed
+        ///
+        size_constraints(px_t min_width, px_t max_width, px_t min_height, px_t max_height)
+            noexcept
+            // Initialize each field within the structure.
+            : min_width(min_width), max_width(max_width), min_height(min_height),
+            max_height(max_height) {}
+
+        ///
+        /// @brief  Limits a size to the allowed range.
+        ///
+        /// @param  size    the size
+        ///
+        /// @return the closest allowed size
+        ///
+        inline bounds2 constrain(const bounds2 &size) const noexcept
+        {
+            // Clamp each dimension, letting the minimum win if the range is inverted.
+            px_t width = size.width > max_width ? max_width : size.width;
+            px_t height = size.height > max_height ? max_height : size.height;
+
+            return bounds2(width < min_width ? min_width : width,
+                height < min_height ? min_height : height);
+        }
+
+        ///
+        /// @brief  Determines whether two constraints allow the same sizes.
+        ///
+        /// @param  other   the other constraints
+        ///
+        /// @return true if and only if the constraints are equal
+        ///
+        inline bool operator==(const size_constraints &other) const noexcept
+        {
+            // Compare each field.
+            return min_width == other.min_width && max_width == other.max_width
+                && min_height == other.min_height && max_height == other.max_height;
+        }
+
+        ///
+        /// @brief  Determines whether two constraints allow different sizes.
+        ///
+        /// @param  other   the other constraints
+        ///
+        /// @return true if and only if the constraints are not equal
+        ///
+        inline bool operator!=(const size_constraints &other) const noexcept
+        {
+            // Negate the equality.
+            return !(*this == other);
+        }
+
+    } size_constraints_t;
+
+    ///
+    /// @brief  The axis along which a flex box places its children.
+    ///
+    enum class flex_direction
+    {
+        row,
+        column
+    };
+
+    ///
+    /// @brief  How a flex box distributes the space left over along its main axis.
+    ///
+    enum class flex_justify
+    {
+        start,
+        center,
+        end,
+        space_between
+    };
+
+    ///
+    /// @brief  How a flex box places its children along its cross axis.
+    ///
+    enum class flex_align
+    {
+        start,
+        center,
+        end,
+        stretch
+    };
+}
+
+#endif
@@ -0,0 +1,340 @@
+///
+/// @file       widget.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a class that represents a node of a retained widget tree.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <stdexcept>
+#include "widget.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    widget::widget(void) noexcept
+        // Start as a visible root with no frame that needs layout and painting.
+        : m_parent(NULL), m_frame(0, 0, 0, 0), m_background(0), m_is_visible(true),
+        m_dirty_flags(LEAF_WIDGET_NEEDS_LAYOUT | LEAF_WIDGET_NEEDS_PAINT), m_drawn_rect(0, 0, 0, 0),
+        m_preferred_size(0, 0), m_grow(0), m_shrink(1), m_measurement_count(0),
+        m_next_measurement(0) {}
+
+    void widget::mark_ancestors(widget_dirty_flags_t flag) noexcept
+    {
+        // Walk up until an ancestor is already marked. Its own ancestors are marked as well, since
+        // marks are always set along the whole path to the root.
+        for (widget *ancestor = m_parent; ancestor && !(ancestor->m_dirty_flags & flag);
+            ancestor = ancestor->m_parent)
+        {
+            ancestor->m_dirty_flags |= flag;
+        }
+    }
+
+    void widget::layout(void) noexcept {}
+
+    void widget::paint(canvas_i &canvas) noexcept
+    {
+        // Fill the frame with the background color, if there is one.
+        if (m_background)
+        {
+            canvas.fill_rect(rect2_t(0, 0, m_frame.width, m_frame.height), m_background);
+        }
+    }
+
+    bounds2_t widget::measure(const size_constraints_t &constraints) noexcept
+    {
+        // Want the preferred size. It is limited to the constraints by the caller.
+        return m_preferred_size;
+    }
+
+    widget *widget::parent(void) const noexcept
+    {
+        // Return the parent.
+        return m_parent;
+    }
+
+    size_t widget::child_count(void) const noexcept
+    {
+        // Return the number of children.
+        return m_children.size();
+    }
+
+    widget *widget::child(size_t index) const noexcept
+    {
+        // Return the child if the index is in range.
+        return index < m_children.size() ? m_children[index].get() : NULL;
+    }
+
+    widget *widget::add_child(unique_ptr<widget> child)
+    {
+        if (!child)
+        {
+            throw runtime_error("Cannot add a null widget as a child.");
+        }
+
+        if (child->m_parent)
+        {
+            throw runtime_error("Cannot add a widget that already has a parent as a child.");
+        }
+
+        // Take ownership of the child and adopt it.
+        widget *added = child.get();
+        m_children.push_back(move(child));
+        added->m_parent = this;
+
+        // The child may carry dirty flags from before it was added, so make sure the path to it
+        // is marked.
+        if (added->m_dirty_flags & (LEAF_WIDGET_NEEDS_LAYOUT | LEAF_WIDGET_DESCENDANT_NEEDS_LAYOUT))
+        {
+            added->mark_ancestors(LEAF_WIDGET_DESCENDANT_NEEDS_LAYOUT);
+        }
+
+        if (added->m_dirty_flags & (LEAF_WIDGET_NEEDS_PAINT | LEAF_WIDGET_DESCENDANT_NEEDS_PAINT))
+        {
+            added->mark_ancestors(LEAF_WIDGET_DESCENDANT_NEEDS_PAINT);
+        }
+
+        // The new child changes the size this widget wants and how it is arranged.
+        invalidate_measure();
+
+        return added;
+    }
+
+    unique_ptr<widget> widget::remove_child(widget *child) noexcept
+    {
+        // Find the child and give up ownership of it.
+        for (auto iter = m_children.begin(); iter != m_children.end(); iter++)
+        {
+            if (iter->get() == child)
+            {
+                unique_ptr<widget> removed = move(*iter);
+                m_children.erase(iter);
+                removed->m_parent = NULL;
+
+                // The size this widget wants may change and the remaining children may need to
+                // be arranged differently. Painting again damages the area the child left.
+                invalidate_measure();
+                invalidate_paint();
+
+                return removed;
+            }
+        }
+
+        return NULL;
+    }
+
+    const rect2_t &widget::frame(void) const noexcept
+    {
+        // Return the frame.
+        return m_frame;
+    }
+
+    widget *widget::set_frame(const rect2_t &frame) noexcept
+    {
+        // A new size changes how the children are arranged and what is painted. A new position
+        // alone only changes where the painting is replayed.
+        bool is_resized = frame.width != m_frame.width || frame.height != m_frame.height;
+        bool is_moved = frame.x != m_frame.x || frame.y != m_frame.y;
+        m_frame = frame;
+
+        if (is_resized)
+        {
+            invalidate_layout();
+        }
+        else if (is_moved)
+        {
+            m_dirty_flags |= LEAF_WIDGET_MOVED;
+            mark_ancestors(LEAF_WIDGET_DESCENDANT_NEEDS_PAINT);
+        }
+
+        return this;
+    }
+
+    bounds2_t widget::measured_size(const size_constraints_t &constraints) noexcept
+    {
+        // Reuse a remembered measurement for the same constraints.
+        for (uint8_t i = 0; i < m_measurement_count; i++)
+        {
+            if (m_measurements[i].constraints == constraints)
+            {
+                return m_measurements[i].size;
+            }
+        }
+
+        // Measure and remember the size, replacing the oldest measurement once all are used.
+        bounds2_t size = constraints.constrain(measure(constraints));
+        uint8_t index = m_measurement_count;
+
+        if (m_measurement_count < LEAF_WIDGET_MEASURE_CACHE_SIZE)
+        {
+            m_measurement_count++;
+        }
+        else
+        {
+            index = m_next_measurement;
+            m_next_measurement = (m_next_measurement + 1) % LEAF_WIDGET_MEASURE_CACHE_SIZE;
+        }
+
+        m_measurements[index].constraints = constraints;
+        m_measurements[index].size = size;
+
+        return size;
+    }
+
+    const bounds2_t &widget::preferred_size(void) const noexcept
+    {
+        // Return the preferred size.
+        return m_preferred_size;
+    }
+
+    widget *widget::set_preferred_size(const bounds2_t &preferred_size) noexcept
+    {
+        // Only measure again if the size changes.
+        if (preferred_size.width != m_preferred_size.width
+            || preferred_size.height != m_preferred_size.height)
+        {
+            m_preferred_size = preferred_size;
+            invalidate_measure();
+        }
+
+        return this;
+    }
+
+    float widget::grow(void) const noexcept
+    {
+        // Return the grow factor.
+        return m_grow;
+    }
+
+    widget *widget::set_grow(float grow) noexcept
+    {
+        // The factor only matters to how the parent arranges its children.
+        if (grow != m_grow)
+        {
+            m_grow = grow;
+
+            if (m_parent)
+            {
+                m_parent->invalidate_layout();
+            }
+        }
+
+        return this;
+    }
+
+    float widget::shrink(void) const noexcept
+    {
+        // Return the shrink factor.
+        return m_shrink;
+    }
+
+    widget *widget::set_shrink(float shrink) noexcept
+    {
+        // The factor only matters to how the parent arranges its children.
+        if (shrink != m_shrink)
+        {
+            m_shrink = shrink;
+
+            if (m_parent)
+            {
+                m_parent->invalidate_layout();
+            }
+        }
+
+        return this;
+    }
+
+    uint32_t widget::background(void) const noexcept
+    {
+        // Return the background color.
+        return m_background;
+    }
+
+    widget *widget::set_background(uint32_t background) noexcept
+    {
+        // Only repaint if the color changes.
+        if (background != m_background)
+        {
+            m_background = background;
+            invalidate_paint();
+        }
+
+        return this;
+    }
+
+    bool widget::is_visible(void) const noexcept
+    {
+        // Return whether the widget is visible.
+        return m_is_visible;
+    }
+
+    widget *widget::set_visible(bool is_visible) noexcept
+    {
+        // Showing or hiding the widget changes what the frame looks like, so paint it again when
+        // it changes. Painting a hidden widget is skipped until it is shown.
+        if (is_visible != m_is_visible)
+        {
+            m_is_visible = is_visible;
+            invalidate_paint();
+
+            // Containers leave hidden children out, so the parent wants a different size.
+            if (m_parent)
+            {
+                m_parent->invalidate_measure();
+            }
+        }
+
+        // Updates skip hidden subtrees without clearing their dirty flags, but they do clear the
+        // marks of the ancestors. Mark the path again so the subtree is laid out once shown.
+        if (is_visible
+            && (m_dirty_flags & (LEAF_WIDGET_NEEDS_LAYOUT | LEAF_WIDGET_DESCENDANT_NEEDS_LAYOUT)))
+        {
+            mark_ancestors(LEAF_WIDGET_DESCENDANT_NEEDS_LAYOUT);
+        }
+
+        return this;
+    }
+
+    widget_dirty_flags_t widget::dirty_flags(void) const noexcept
+    {
+        // Return the dirty flags.
+        return m_dirty_flags;
+    }
+
+    void widget::invalidate_layout(void) noexcept
+    {
+        // Arranging the children can change what is painted, so painting is invalidated as well.
+        m_dirty_flags |= LEAF_WIDGET_NEEDS_LAYOUT;
+        mark_ancestors(LEAF_WIDGET_DESCENDANT_NEEDS_LAYOUT);
+        invalidate_paint();
+    }
+
+    void widget::invalidate_paint(void) noexcept
+    {
+        // Mark the widget and the path to it.
+        m_dirty_flags |= LEAF_WIDGET_NEEDS_PAINT;
+        mark_ancestors(LEAF_WIDGET_DESCENDANT_NEEDS_PAINT);
+    }
+
+    void widget::invalidate_measure(void) noexcept
+    {
+        // The widget arranges its content again.
+        m_measurement_count = 0;
+        m_next_measurement = 0;
+        m_dirty_flags |= LEAF_WIDGET_NEEDS_LAYOUT;
+        mark_ancestors(LEAF_WIDGET_DESCENDANT_NEEDS_LAYOUT);
+
+        // The size an ancestor wants depends on the sizes its descendants want, so forget the
+        // measurements along the path and arrange each ancestor again. The siblings keep their
+        // measurements, so arranging them again is cheap.
+        for (widget *ancestor = m_parent; ancestor; ancestor = ancestor->m_parent)
+        {
+            ancestor->m_measurement_count = 0;
+            ancestor->m_next_measurement = 0;
+            ancestor->m_dirty_flags |= LEAF_WIDGET_NEEDS_LAYOUT;
+        }
+    }
+}
@@ -0,0 +1,427 @@
+///
+/// @file       widget.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a class that represents a node of a retained widget tree. A widget
+///             remembers how it was laid out and painted, and is only laid out or painted again
+///             once it has been invalidated.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_WIDGET_HEADER_GUARD
+#define LEAF_SRC_WIDGET_HEADER_GUARD
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "../utils/unique.hpp"
+#include "../graphics/graphics_types.hpp"
+#include "../graphics/render/canvas_i.hpp"
+#include "display_list.hpp"
+#include "layout_types.hpp"
+
+///
+/// @brief  The dirty flag set when a widget must arrange its children again.
+///
+#define LEAF_WIDGET_NEEDS_LAYOUT (leaf::widget_dirty_flags_t)0x01
+
+///
+/// @brief  The dirty flag set when a widget must record its painting again.
+///
+#define LEAF_WIDGET_NEEDS_PAINT (leaf::widget_dirty_flags_t)0x02
+
+///
+/// @brief  The dirty flag set when a descendant of a widget needs layout.
+///
+#define LEAF_WIDGET_DESCENDANT_NEEDS_LAYOUT (leaf::widget_dirty_flags_t)0x04
+
+///
+/// @brief  The dirty flag set when a descendant of a widget needs painting.
+///
+#define LEAF_WIDGET_DESCENDANT_NEEDS_PAINT (leaf::widget_dirty_flags_t)0x08
+
+///
+/// @brief  The dirty flag set when a widget moved without being painted again, so that the area
+///         it left and the area it moved to are drawn again. It marks ancestors like painting.
+///
+#define LEAF_WIDGET_MOVED (leaf::widget_dirty_flags_t)0x10
+
+///
+/// @brief  The number of measurements a widget remembers. A container usually measures a child
+///         with one set of constraints to size itself and another to arrange the child, so a few
+///         entries keep both cached.
+///
+#define LEAF_WIDGET_MEASURE_CACHE_SIZE 4
+
+namespace leaf
+{
+    ///
+    /// @brief  A set of dirty flags of a widget.
+    ///
+    typedef uint8_t widget_dirty_flags_t;
+
+    ///
+    /// @brief  A size a widget measured for a set of constraints.
+    ///
+    typedef struct widget_measurement
+    {
+        ///
+        /// @brief  The constraints the widget was measured with.
+        ///
+        size_constraints_t constraints;
+
+        ///
+        /// @brief  The size the widget measured.
+        ///
+        bounds2_t size;
+
+    } widget_measurement_t;
+
+    ///
+    /// @brief  Represents a node of a retained widget tree. Each widget owns its children and has
+    ///         a frame relative to its parent. It paints relative to its own top-left corner into a
+    ///         display list that is replayed every frame, so it is only painted again when it is
+    ///         invalidated, not when it moves.
+    ///
+    ///         Invalidating a widget sets its dirty flags and marks each ancestor as having a dirty
+    ///         descendant, stopping at the first ancestor that is already marked. The widget tree
+    ///         only descends into marked subtrees when it updates.
+    ///
+    class widget : public utl::unique
+    {
+        friend class widget_tree;
+
+        private:
+            ///
+            /// @brief  The widget that owns this one, or null if this is a root.
+            ///
+            widget *m_parent;
+
+            ///
+            /// @brief  The children in drawing order. Later children are drawn over earlier ones.
+            ///
+            std::vector<std::unique_ptr<widget>> m_children;
+
+            ///
+            /// @brief  The position relative to the parent and the size.
+            ///
+            rect2_t m_frame;
+
+            ///
+            /// @brief  The color the widget is filled with before it paints, or 0 for none.
+            ///
+            uint32_t m_background;
+
+            ///
+            /// @brief  Denotes whether the widget and its children are drawn.
+            ///
+            bool m_is_visible;
+
+            ///
+            /// @brief  The dirty flags of the widget.
+            ///
+            widget_dirty_flags_t m_dirty_flags;
+
+            ///
+            /// @brief  The painting of the widget recorded the last time it was painted.
+            ///
+            display_list m_display_list;
+
+            ///
+            /// @brief  The rectangle in window coordinates the widget was last drawn in, or an
+            ///         empty rectangle if it is not on screen.
+            ///
+            rect2_t m_drawn_rect;
+
+            ///
+            /// @brief  The size the widget prefers when it is measured, unless it measures its
+            ///         content instead.
+            ///
+            bounds2_t m_preferred_size;
+
+            ///
+            /// @brief  The share of the space left over in a container the widget grows into.
+            ///
+            float m_grow;
+
+            ///
+            /// @brief  The share of the missing space in a container the widget gives up.
+            ///
+            float m_shrink;
+
+            ///
+            /// @brief  The measurements remembered since the content last changed.
+            ///
+            widget_measurement_t m_measurements[LEAF_WIDGET_MEASURE_CACHE_SIZE];
+
+            ///
+            /// @brief  The number of remembered measurements.
+            ///
+            uint8_t m_measurement_count;
+
+            ///
+            /// @brief  The index of the measurement that is replaced next once all are used.
+            ///
+            uint8_t m_next_measurement;
+
+            ///
+            /// @brief  Marks the parent and its ancestors with a flag until an ancestor that
+            ///         already has it.
+            ///
+            /// @param  flag    the descendant flag to set
+            ///
+            void mark_ancestors(widget_dirty_flags_t flag) noexcept;
+
+        protected:
+            ///
+            /// @brief  Arranges the children inside the frame. It is called when the widget needs
+            ///         layout, before its children are laid out. By default the children keep the
+            ///         frames they were given.
+            ///
+            virtual void layout(void) noexcept;
+
+            ///
+            /// @brief  Paints the widget onto a canvas relative to its own top-left corner. The
+            ///         painting is recorded and replayed until the widget is invalidated. By
+            ///         default it fills the frame with the background color, if it has one.
+            ///
+            /// @param  canvas  the canvas to paint onto
+            ///
+            virtual void paint(canvas_i &canvas) noexcept;
+
+            ///
+            /// @brief  Measures the size the widget wants within some constraints. It is only
+            ///         called when no measurement for the constraints is remembered, so it may be
+            ///         expensive, such as measuring text. By default it returns the preferred
+            ///         size.
+            ///
+            /// @param  constraints the range of sizes allowed
+            ///
+            /// @return the size the widget wants, which is limited to the constraints afterwards
+            ///
+            virtual bounds2_t measure(const size_constraints_t &constraints) noexcept;
+
+        public:
+            ///
+            /// @brief  Constructs an empty, visible widget with no frame. It starts dirty so that
+            ///         it is laid out and painted in the first update.
+            ///
+            widget(void) noexcept;
+
+            ///
+            /// @brief  Destroys the widget and its children. The destructor is declared default to
+            ///         ensure that it is virtual.
+            ///
+            virtual ~widget() noexcept = default;
+
+            ///
+            /// @brief  Returns the widget that owns this one.
+            ///
+            /// @return the parent or null if this is a root
+            ///
+            widget *parent(void) const noexcept;
+
+            ///
+            /// @brief  Determines how many children the widget has.
+            ///
+            /// @return the number of children
+            ///
+            size_t child_count(void) const noexcept;
+
+            ///
+            /// @brief  Returns a child by its index in drawing order.
+            ///
+            /// @param  index   the index of the child
+            ///
+            /// @return the child or null if the index is out of range
+            ///
+            widget *child(size_t index) const noexcept;
+
+            ///
+            /// @brief  Adds a child after the existing ones. The widget needs layout afterwards.
+            ///
+            /// @param  child   the child, which must not already have a parent
+            ///
+            /// @return the child
+            ///
+            /// @throw  std::runtime_error if the child is null or already has a parent
+            ///
+            widget *add_child(std::unique_ptr<widget> child);
+
+            ///
+            /// @brief  Constructs a child and adds it after the existing ones.
+            ///
+            /// @tparam W       the type of the child
+            /// @tparam A       the types of the constructor arguments
+            /// @param  args    the constructor arguments
+            ///
+            /// @return the child
+            ///
+            template<typename W, typename... A> W *emplace_child(A &&...args)
+            {
+                // Construct the child, then add it as any other child.
+                W *child = new W(std::forward<A>(args)...);
+                add_child(std::unique_ptr<widget>(child));
+
+                return child;
+            }
+
+            ///
+            /// @brief  Removes a child and gives up ownership of it. The widget needs layout
+            ///         afterwards.
+            ///
+            /// @param  child   the child
+            ///
+            /// @return the child or null if it is not a child of this widget
+            ///
+            std::unique_ptr<widget> remove_child(widget *child) noexcept;
+
+            ///
+            /// @brief  Returns the position relative to the parent and the size.
+            ///
+            /// @return the frame
+            ///
+            const rect2_t &frame(void) const noexcept;
+
+            ///
+            /// @brief  Sets the position relative to the parent and the size. Changing the size
+            ///         invalidates the layout, changing only the position does not repaint the
+            ///         widget since the painting is relative to it, but damages the area it left
+            ///         and the area it moved to.
+            ///
+            /// @param  frame   the new frame
+            ///
+            /// @return a pointer to this widget for chaining
+            ///
+            widget *set_frame(const rect2_t &frame) noexcept;
+
+            ///
+            /// @brief  Determines the size the widget wants within some constraints, measuring it
+            ///         only if the constraints were not seen since the content last changed.
+            ///
+            /// @param  constraints the range of sizes allowed
+            ///
+            /// @return the size the widget wants within the constraints
+            ///
+            bounds2_t measured_size(const size_constraints_t &constraints) noexcept;
+
+            ///
+            /// @brief  Returns the size the widget prefers when it is measured.
+            ///
+            /// @return the preferred size
+            ///
+            const bounds2_t &preferred_size(void) const noexcept;
+
+            ///
+            /// @brief  Sets the size the widget prefers when it is measured. This invalidates the
+            ///         measurements if the size changes.
+            ///
+            /// @param  preferred_size  the preferred size
+            ///
+            /// @return a pointer to this widget for chaining
+            ///
+            widget *set_preferred_size(const bounds2_t &preferred_size) noexcept;
+
+            ///
+            /// @brief  Returns the share of the space left over in a container the widget grows
+            ///         into.
+            ///
+            /// @return the grow factor, 0 if the widget does not grow
+            ///
+            float grow(void) const noexcept;
+
+            ///
+            /// @brief  Sets the share of the space left over in a container the widget grows into.
+            ///         This invalidates the layout of the parent if the factor changes.
+            ///
+            /// @param  grow    the grow factor, 0 if the widget should not grow
+            ///
+            /// @return a pointer to this widget for chaining
+            ///
+            widget *set_grow(float grow) noexcept;
+
+            ///
+            /// @brief  Returns the share of the missing space in a container the widget gives up.
+            ///
+            /// @return the shrink factor, 0 if the widget does not shrink
+            ///
+            float shrink(void) const noexcept;
+
+            ///
+            /// @brief  Sets the share of the missing space in a container the widget gives up. This
+            ///         invalidates the layout of the parent if the factor changes.
+            ///
+            /// @param  shrink  the shrink factor, 0 if the widget should not shrink
+            ///
+            /// @return a pointer to this widget for chaining
+            ///
+            widget *set_shrink(float shrink) noexcept;
+
+            ///
+            /// @brief  Returns the color the widget is filled with before it paints.
+            ///
+            /// @return the RGBA background color or 0 for none
+            ///
+            uint32_t background(void) const noexcept;
+
+            ///
+            /// @brief  Sets the color the widget is filled with before it paints. This invalidates
+            ///         the painting if the color changes.
+            ///
+            /// @param  background  the RGBA background color or 0 for none
+            ///
+            /// @return a pointer to this widget for chaining
+            ///
+            widget *set_background(uint32_t background) noexcept;
+
+            ///
+            /// @brief  Determines whether the widget and its children are drawn.
+            ///
+            /// @return true if and only if the widget is visible
+            ///
+            bool is_visible(void) const noexcept;
+
+            ///
+            /// @brief  Sets whether the widget and its children are drawn. Hidden subtrees keep
+            ///         their dirty flags and are only updated once they are shown.
+            ///
+            /// @param  is_visible  true if and only if the widget should be visible
+            ///
+            /// @return a pointer to this widget for chaining
+            ///
+            widget *set_visible(bool is_visible) noexcept;
+
+            ///
+            /// @brief  Returns the dirty flags of the widget.
+            ///
+            /// @return the dirty flags
+            ///
+            widget_dirty_flags_t dirty_flags(void) const noexcept;
+
+            ///
+            /// @brief  Marks the widget as needing layout and painting, so that it arranges its
+            ///         children and paints again in the next update.
+            ///
+            void invalidate_layout(void) noexcept;
+
+            ///
+            /// @brief  Marks the widget as needing painting, so that it paints again in the next
+            ///         update.
+            ///
+            void invalidate_paint(void) noexcept;
+
+            ///
+            /// @brief  Forgets the measurements of the widget and its ancestors, since the content
+            ///         changed the size it wants. The widget and its ancestors need layout, but the
+            ///         measurements of other widgets are kept. Nothing is painted again unless a
+            ///         widget ends up with a different size.
+            ///
+            void invalidate_measure(void) noexcept;
+    };
+}
+
+#endif
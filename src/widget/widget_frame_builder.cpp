@@ -0,0 +1,222 @@
+///
+/// @file       widget_frame_builder.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a frame builder that draws a widget tree with a quad batcher.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <stdexcept>
+#include <utility>
+#include "widget_frame_builder.hpp"
+#include "../utils/trace.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    widget_frame_builder::widget_frame_builder(widget_tree *tree, const string &shader_dir,
+        glyph_atlas_mode text_mode)
+        // Nothing is published until the tree is first drawn, and the frame buffer is created by
+        // the first frame, which asks for a drawing of the whole tree.
+        : m_tree(tree), m_glyph_atlas(LEAF_GLYPH_ATLAS_SIZE, text_mode), m_batcher(shader_dir),
+        m_is_pending(false), m_is_pending_full(false), m_requested_full_draws(1),
+        m_answered_full_draws(0), m_frame_buffer(BGFX_INVALID_HANDLE),
+        m_frame_buffer_bounds({0, 0}), m_awaits_full_draw(true), m_stats({0, 0, 0, 0, 0}),
+        m_glyph_stats({0, 0, 0, 0})
+    {
+        if (!tree)
+        {
+            throw runtime_error("A widget frame builder must be given a widget tree.");
+        }
+
+        // Draw text and images from the atlases of this frame builder.
+        m_batcher.set_glyph_atlas(&m_glyph_atlas)->set_texture_atlas(&m_texture_atlas);
+    }
+
+    bool widget_frame_builder::publish(void) noexcept
+    {
+        LEAF_TRACE_ZONE("widget_frame_builder::publish");
+
+        bool is_changed = m_tree->update();
+        uint64_t requested_full_draws;
+
+        {
+            lock_guard<mutex> lock(m_mutex);
+            requested_full_draws = m_requested_full_draws;
+        }
+
+        // Draw the whole tree if the frame buffer does not show it or the damage is unknown,
+        // otherwise only the damage. Keep the published drawing if nothing looks different.
+        bool is_full = requested_full_draws != m_answered_full_draws || m_tree->is_damage_lost();
+
+        if (!is_full && !is_changed && m_tree->damage().empty())
+        {
+            return false;
+        }
+
+        m_recording.clear();
+
+        if (is_full)
+        {
+            m_tree->draw(m_recording);
+        }
+        else if (!m_tree->draw_damage(m_recording))
+        {
+            return false;
+        }
+
+        // Hand the drawing to the API thread. A drawing of the whole tree replaces one it has not
+        // drawn yet, and a drawing of the damage is appended to it, since the frame buffer must
+        // receive both. Swapping only exchanges the memory of the lists.
+        {
+            lock_guard<mutex> lock(m_mutex);
+
+            if (is_full || !m_is_pending)
+            {
+                swap(m_published, m_recording);
+                m_is_pending_full = is_full;
+            }
+            else
+            {
+                m_recording.replay(m_published, pos2_t(0, 0));
+            }
+
+            m_is_pending = true;
+        }
+
+        if (is_full)
+        {
+            m_answered_full_draws = requested_full_draws;
+        }
+
+        return true;
+    }
+
+    void widget_frame_builder::build_frame(bgfx::ViewId view_id, bgfx::ViewId offscreen_view_id,
+        const bounds2_t &bounds) noexcept
+    {
+        LEAF_TRACE_ZONE("widget_frame_builder::build_frame");
+
+        // A surface without pixels has nothing to show and no frame buffer can be created for it.
+        if (bounds.width <= 0 || bounds.height <= 0)
+        {
+            return;
+        }
+
+        // The lock is held only while the drawing is batched, not while the tree is updated.
+        lock_guard<mutex> lock(m_mutex);
+
+        // Keep the frame buffer the size of the surface. A new frame buffer shows nothing, so it
+        // is cleared and waits for a drawing of the whole tree.
+        bool is_new = false;
+
+        if (!bgfx::isValid(m_frame_buffer) || m_frame_buffer_bounds.width != bounds.width
+            || m_frame_buffer_bounds.height != bounds.height)
+        {
+            if (bgfx::isValid(m_frame_buffer))
+            {
+                bgfx::destroy(m_frame_buffer);
+            }
+
+            m_frame_buffer = bgfx::createFrameBuffer((uint16_t)bounds.width,
+                (uint16_t)bounds.height, bgfx::TextureFormat::RGBA8,
+                BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP | BGFX_SAMPLER_MIN_POINT
+                | BGFX_SAMPLER_MAG_POINT);
+            m_frame_buffer_bounds = bounds;
+            is_new = true;
+
+            if (!m_awaits_full_draw)
+            {
+                m_awaits_full_draw = true;
+                m_requested_full_draws++;
+            }
+        }
+
+        // A drawing of the damage cannot be drawn onto a frame buffer that does not show the tree.
+        if (m_is_pending && m_awaits_full_draw && !m_is_pending_full)
+        {
+            m_is_pending = false;
+        }
+
+        // Draw into the frame buffer without clearing it, unless it is new, so that everything
+        // outside the damage stays as it was.
+        bgfx::setViewFrameBuffer(offscreen_view_id, m_frame_buffer);
+        bgfx::setViewRect(offscreen_view_id, 0, 0, bounds.width, bounds.height);
+        bgfx::setViewClear(offscreen_view_id, is_new ? BGFX_CLEAR_COLOR : BGFX_CLEAR_NONE, 0);
+
+        quad_batcher_stats_t stats = {0, 0, 0, 0, 0};
+
+        if (is_new)
+        {
+            bgfx::touch(offscreen_view_id);
+        }
+
+        if (m_is_pending)
+        {
+            m_batcher.begin(offscreen_view_id, bounds);
+            m_published.replay(m_batcher, pos2_t(0, 0));
+            m_batcher.end();
+
+            stats = m_batcher.stats();
+            m_is_pending = false;
+            m_awaits_full_draw = false;
+        }
+
+        // Show the frame buffer on the surface. Frame buffers of renderers whose origin is at the
+        // bottom left are read upside down.
+        float v_top = bgfx::getCaps()->originBottomLeft ? 1.0f : 0.0f;
+
+        m_batcher.begin(view_id, bounds);
+        m_batcher.draw_image(rect2_t(0, 0, bounds.width, bounds.height),
+            bgfx::getTexture(m_frame_buffer), 0.0f, v_top, 1.0f, 1.0f - v_top);
+        m_batcher.end();
+
+        const quad_batcher_stats_t &show_stats = m_batcher.stats();
+        stats.draw_calls += show_stats.draw_calls;
+        stats.quads += show_stats.quads;
+        stats.vertices += show_stats.vertices;
+        stats.indices += show_stats.indices;
+        stats.dropped_quads += show_stats.dropped_quads;
+
+        m_stats = stats;
+        m_glyph_stats = m_glyph_atlas.stats();
+    }
+
+    void widget_frame_builder::destroy_resources(void) noexcept
+    {
+        // Only the frame buffer, the batcher, and the atlases are bgfx resources. A frame buffer
+        // created again shows nothing, so it asks for a drawing of the whole tree.
+        if (bgfx::isValid(m_frame_buffer))
+        {
+            bgfx::destroy(m_frame_buffer);
+            m_frame_buffer = BGFX_INVALID_HANDLE;
+        }
+
+        m_batcher.destroy_resources();
+        m_glyph_atlas.destroy_resources();
+        m_texture_atlas.destroy_resources();
+    }
+
+    quad_batcher_stats_t widget_frame_builder::stats(void) const noexcept
+    {
+        // Copy the statistics while the API thread cannot change them.
+        lock_guard<mutex> lock(m_mutex);
+        return m_stats;
+    }
+
+    glyph_atlas_stats_t widget_frame_builder::glyph_stats(void) const noexcept
+    {
+        // Copy the counters while the API thread cannot change them.
+        lock_guard<mutex> lock(m_mutex);
+        return m_glyph_stats;
+    }
+
+    texture_atlas *widget_frame_builder::textures(void) noexcept
+    {
+        // Return the texture atlas.
+        return &m_texture_atlas;
+    }
+}
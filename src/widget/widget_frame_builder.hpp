@@ -0,0 +1,200 @@
+///
+/// @file       widget_frame_builder.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a frame builder that draws a widget tree with a quad batcher.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_WIDGET_FRAME_BUILDER_HEADER_GUARD
+#define LEAF_SRC_WIDGET_FRAME_BUILDER_HEADER_GUARD
+
+#include <mutex>
+#include <string>
+#include "../utils/unique.hpp"
+#include "../graphics/render/frame_builder_i.hpp"
+#include "../graphics/render/quad_batcher.hpp"
+#include "../graphics/render/texture_atlas.hpp"
+#include "display_list.hpp"
+#include "widget_tree.hpp"
+
+namespace leaf
+{
+    ///
+    /// @brief  A frame builder that draws a widget tree into the view of its surface. The tree
+    ///         belongs to the thread that polls window events, so that thread publishes the
+    ///         drawing of the tree as a display list, and the renderer's API thread replays it
+    ///         into a quad batcher. The tree is never touched by the API thread.
+    ///
+    ///         The API thread draws into a frame buffer of the frame builder that keeps its
+    ///         content across frames, and shows it on the surface with a single quad every frame.
+    ///         Only the damage of the tree is published and drawn again, cut to each damaged
+    ///         rectangle. The whole tree is only drawn when the frame buffer is new, such as after
+    ///         the surface was resized, or when the tree lost its damage.
+    ///
+    class widget_frame_builder : public utl::unique, public frame_builder_i
+    {
+        private:
+            ///
+            /// @brief  The tree to draw.
+            ///
+            widget_tree *m_tree;
+
+            ///
+            /// @brief  The atlas the batcher draws text from. It is only used on the API thread.
+            ///
+            glyph_atlas m_glyph_atlas;
+
+            ///
+            /// @brief  The atlas the batcher draws icons and nine-patches from. Images can be added
+            ///         to it from any thread.
+            ///
+            texture_atlas m_texture_atlas;
+
+            ///
+            /// @brief  The batcher the published drawing is replayed into. It is only used on the
+            ///         API thread.
+            ///
+            quad_batcher m_batcher;
+
+            ///
+            /// @brief  Guards the published drawing and the statistics.
+            ///
+            mutable std::mutex m_mutex;
+
+            ///
+            /// @brief  The drawing the API thread has yet to draw into the frame buffer. Drawings
+            ///         of the damage that are published before it is drawn are appended to it.
+            ///
+            display_list m_published;
+
+            ///
+            /// @brief  The drawing being recorded by the event thread. It is swapped with the
+            ///         published drawing once it is complete, so both keep their memory.
+            ///
+            display_list m_recording;
+
+            ///
+            /// @brief  Whether the published drawing has yet to be drawn.
+            ///
+            bool m_is_pending;
+
+            ///
+            /// @brief  Whether the published drawing covers the whole tree rather than its damage.
+            ///
+            bool m_is_pending_full;
+
+            ///
+            /// @brief  The number of times the API thread asked for a drawing of the whole tree.
+            ///
+            uint64_t m_requested_full_draws;
+
+            ///
+            /// @brief  The number of requests for a drawing of the whole tree the event thread has
+            ///         answered. It is only used on the event thread.
+            ///
+            uint64_t m_answered_full_draws;
+
+            ///
+            /// @brief  The frame buffer the tree is drawn into. It is only used on the API thread.
+            ///
+            bgfx::FrameBufferHandle m_frame_buffer;
+
+            ///
+            /// @brief  The bounds of the frame buffer. It is only used on the API thread.
+            ///
+            bounds2_t m_frame_buffer_bounds;
+
+            ///
+            /// @brief  Whether the frame buffer waits for a drawing of the whole tree, since it
+            ///         does not show the tree yet. Drawings of the damage are dropped until then.
+            ///         It is only used on the API thread.
+            ///
+            bool m_awaits_full_draw;
+
+            ///
+            /// @brief  How the batcher drew the last frame.
+            ///
+            quad_batcher_stats_t m_stats;
+
+            ///
+            /// @brief  How often the glyph atlas found the glyphs of the frames drawn so far.
+            ///
+            glyph_atlas_stats_t m_glyph_stats;
+
+        public:
+            ///
+            /// @brief  Constructs a frame builder for a widget tree.
+            ///
+            /// @param  tree        the tree to draw, which must outlive the frame builder
+            /// @param  shader_dir  the directory the compiled quad shaders are loaded from
+            /// @param  text_mode   what the glyph atlas stores, distance fields suiting text that
+            ///                     is drawn at many sizes or scales
+            ///
+            /// @throw  runtime_error if the tree is null
+            ///
+            widget_frame_builder(widget_tree *tree,
+                const std::string &shader_dir = LEAF_QUAD_BATCHER_SHADER_DIR,
+                glyph_atlas_mode text_mode = glyph_atlas_mode::bitmap);
+
+            ///
+            /// @brief  Updates the tree and publishes the drawing of its damage if it changed, or
+            ///         of the whole tree if the API thread asked for it. This must be called on the
+            ///         thread that polls window events, such as once each time events were
+            ///         handled.
+            ///
+            /// @return true if and only if a new drawing was published
+            ///
+            bool publish(void) noexcept;
+
+            ///
+            /// @brief      Draws the published drawing into the frame buffer through the offscreen
+            ///             view, if there is one, and shows the frame buffer in the view.
+            ///
+            /// @param      view_id             the bgfx view that draws to the surface
+            /// @param      offscreen_view_id   the bgfx view that draws to the frame buffer
+            /// @param      bounds              the bounds of the surface in pixels
+            ///
+            /// @warning    This is called on the renderer's API thread.
+            ///
+            virtual void build_frame(bgfx::ViewId view_id, bgfx::ViewId offscreen_view_id,
+                const bounds2_t &bounds) noexcept override;
+
+            ///
+            /// @brief      Destroys the frame buffer and the bgfx resources of the batcher and the
+            ///             atlases.
+            ///
+            /// @warning    This is called on the renderer's API thread.
+            ///
+            virtual void destroy_resources(void) noexcept override;
+
+            ///
+            /// @brief  Returns how the last frame was drawn, including its draw calls and
+            ///         vertices, counting both the drawing into the frame buffer and the quad that
+            ///         shows it. It can be called from any thread.
+            ///
+            /// @return the statistics of the last frame
+            ///
+            quad_batcher_stats_t stats(void) const noexcept;
+
+            ///
+            /// @brief  Returns how often the glyph atlas found the glyphs of the frames drawn so
+            ///         far. It can be called from any thread.
+            ///
+            /// @return the counters of the glyph atlas
+            ///
+            glyph_atlas_stats_t glyph_stats(void) const noexcept;
+
+            ///
+            /// @brief  Returns the atlas that icons and nine-patches are drawn from, so that images
+            ///         can be added to it. It can be called from any thread.
+            ///
+            /// @return the texture atlas
+            ///
+            texture_atlas *textures(void) noexcept;
+    };
+}
+
+#endif
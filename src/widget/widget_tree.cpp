@@ -0,0 +1,414 @@
+///
+/// @file       widget_tree.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a class that represents a retained tree of widgets attached to a
+///             managed window.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <algorithm>
+#include <stdexcept>
+#include "widget_tree.hpp"
+#include "../graphics/rect_ops.hpp"
+#include "../utils/trace.hpp"
+#include "../window/window_event_manager.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    widget_tree::widget_tree(managed_window *window)
+        // Start with an empty root and no counted work.
+        : m_window(window), m_root(new widget()), m_counters(), m_is_damage_lost(false),
+        m_background(LEAF_WIDGET_TREE_DEFAULT_BACKGROUND)
+    {
+        if (!window || !window->is_alive())
+        {
+            throw runtime_error("A widget tree can only be attached to a living window.");
+        }
+
+        // Size the root to the window and follow the window from now on.
+        bounds2_t bounds = window->bounds();
+        m_root->set_frame(rect2_t(0, 0, bounds.width, bounds.height));
+
+        window->event_manager()->subscribe(this,
+            window_event_mask(window_event_type::closed)
+            | window_event_mask(window_event_type::resized));
+    }
+
+    widget_tree::~widget_tree() noexcept
+    {
+        // Stop receiving events if the window still exists.
+        if (m_window)
+        {
+            m_window->event_manager()->unsubscribe(this);
+        }
+    }
+
+    void widget_tree::closed(void) noexcept
+    {
+        // The window is gone, so there is nothing to unsubscribe from later.
+        m_window = NULL;
+    }
+
+    void widget_tree::user_requested_close(void) noexcept {}
+
+    void widget_tree::resized(const bounds2_t &new_bounds) noexcept
+    {
+        // Keep the root filling the window. This invalidates the root layout if the size changed.
+        m_root->set_frame(rect2_t(0, 0, new_bounds.width, new_bounds.height));
+    }
+
+    managed_window *widget_tree::window(void) const noexcept
+    {
+        // Return the window.
+        return m_window;
+    }
+
+    widget *widget_tree::root(void) const noexcept
+    {
+        // Return the root widget.
+        return m_root.get();
+    }
+
+    widget *widget_tree::set_root(unique_ptr<widget> root)
+    {
+        if (!root)
+        {
+            throw runtime_error("Cannot use a null widget as the root.");
+        }
+
+        if (root->m_parent)
+        {
+            throw runtime_error("Cannot use a widget that has a parent as the root.");
+        }
+
+        // Size the new root like the old one, which follows the window, and arrange it.
+        root->set_frame(m_root->m_frame);
+        root->invalidate_layout();
+        m_root = move(root);
+
+        return m_root.get();
+    }
+
+    void widget_tree::invalidate_subtree(widget *node) noexcept
+    {
+        // Set every flag, since every descendant is marked as well.
+        node->m_dirty_flags = LEAF_WIDGET_NEEDS_LAYOUT | LEAF_WIDGET_NEEDS_PAINT
+            | LEAF_WIDGET_DESCENDANT_NEEDS_LAYOUT | LEAF_WIDGET_DESCENDANT_NEEDS_PAINT;
+        node->m_measurement_count = 0;
+        node->m_next_measurement = 0;
+
+        for (const unique_ptr<widget> &child : node->m_children)
+        {
+            invalidate_subtree(child.get());
+        }
+    }
+
+    void widget_tree::invalidate_all(void) noexcept
+    {
+        // Start from the root.
+        invalidate_subtree(m_root.get());
+    }
+
+    void widget_tree::layout_subtree(widget *node) noexcept
+    {
+        m_counters.layout_visits++;
+
+        // Clear each flag before acting on it, so that a widget invalidated while the pass runs
+        // stays marked for the next update.
+        if (node->m_dirty_flags & LEAF_WIDGET_NEEDS_LAYOUT)
+        {
+            node->m_dirty_flags &= ~LEAF_WIDGET_NEEDS_LAYOUT;
+            node->layout();
+            m_counters.layouts++;
+        }
+
+        if (!(node->m_dirty_flags & LEAF_WIDGET_DESCENDANT_NEEDS_LAYOUT))
+        {
+            return;
+        }
+
+        node->m_dirty_flags &= ~LEAF_WIDGET_DESCENDANT_NEEDS_LAYOUT;
+
+        // Only descend into visible children that need layout themselves or below.
+        for (const unique_ptr<widget> &child : node->m_children)
+        {
+            if (child->m_is_visible && (child->m_dirty_flags
+                & (LEAF_WIDGET_NEEDS_LAYOUT | LEAF_WIDGET_DESCENDANT_NEEDS_LAYOUT)))
+            {
+                layout_subtree(child.get());
+            }
+        }
+    }
+
+    void widget_tree::add_damage(const rect2_t &rect) noexcept
+    {
+        // If the damage cannot grow, draw the whole window next time rather than too little.
+        try
+        {
+            m_damage.unite(rect);
+        }
+        catch (const exception &)
+        {
+            m_is_damage_lost = true;
+        }
+    }
+
+    void widget_tree::paint_subtree(widget *node, const pos2_t &offset) noexcept
+    {
+        m_counters.paint_visits++;
+        pos2_t pos(offset.x + node->m_frame.x, offset.y + node->m_frame.y);
+
+        // A widget that looks different or moved damages the area it was drawn in and the area it
+        // is drawn in next. Its children are inside both.
+        if (node->m_dirty_flags & (LEAF_WIDGET_NEEDS_PAINT | LEAF_WIDGET_MOVED))
+        {
+            node->m_dirty_flags &= ~LEAF_WIDGET_MOVED;
+            add_damage(node->m_drawn_rect);
+            add_damage(rect2_t(pos, node->m_frame.bounds()));
+        }
+
+        // Record the painting of the widget again, reusing the memory of the old recording.
+        if (node->m_dirty_flags & LEAF_WIDGET_NEEDS_PAINT)
+        {
+            node->m_dirty_flags &= ~LEAF_WIDGET_NEEDS_PAINT;
+            node->m_display_list.clear();
+            node->paint(node->m_display_list);
+            m_counters.paints++;
+        }
+
+        if (!(node->m_dirty_flags & LEAF_WIDGET_DESCENDANT_NEEDS_PAINT))
+        {
+            return;
+        }
+
+        node->m_dirty_flags &= ~LEAF_WIDGET_DESCENDANT_NEEDS_PAINT;
+
+        // Only descend into visible children that need painting themselves or below. A child that
+        // was hidden since it was drawn damages the area it left.
+        for (const unique_ptr<widget> &child : node->m_children)
+        {
+            bool needs_visit = child->m_dirty_flags & (LEAF_WIDGET_NEEDS_PAINT
+                | LEAF_WIDGET_DESCENDANT_NEEDS_PAINT | LEAF_WIDGET_MOVED);
+
+            if (child->m_is_visible && needs_visit)
+            {
+                paint_subtree(child.get(), pos);
+            }
+            else if (!child->m_is_visible && !is_empty(child->m_drawn_rect))
+            {
+                add_damage(child->m_drawn_rect);
+                child->m_drawn_rect = rect2_t(0, 0, 0, 0);
+            }
+        }
+    }
+
+    void widget_tree::draw_subtree(widget *node, canvas_i &canvas, const pos2_t &offset,
+        const rect2_t *clips, size_t clip_count) noexcept
+    {
+        // Remember where the widget is drawn, whether or not it is inside a clip rectangle.
+        pos2_t pos(offset.x + node->m_frame.x, offset.y + node->m_frame.y);
+        node->m_drawn_rect = rect2_t(pos, node->m_frame.bounds());
+
+        // Replay the widget in each clip rectangle it overlaps, or uncut if there are none, then
+        // its children over it.
+        bool is_drawn = clips == NULL;
+
+        if (!clips)
+        {
+            node->m_display_list.replay(canvas, pos);
+        }
+
+        for (size_t i = 0; i < clip_count; i++)
+        {
+            if (!is_empty(intersect(node->m_drawn_rect, clips[i])))
+            {
+                node->m_display_list.replay(canvas, pos, clips[i]);
+                is_drawn = true;
+            }
+        }
+
+        m_counters.draws += is_drawn;
+
+        for (const unique_ptr<widget> &child : node->m_children)
+        {
+            if (child->m_is_visible)
+            {
+                draw_subtree(child.get(), canvas, pos, clips, clip_count);
+            }
+        }
+    }
+
+    bool widget_tree::update(void) noexcept
+    {
+        LEAF_TRACE_ZONE("widget_tree::update");
+
+        // Count only the work of this update.
+        m_counters.layout_visits = 0;
+        m_counters.layouts = 0;
+        m_counters.paint_visits = 0;
+        m_counters.paints = 0;
+
+        if (!m_root->m_is_visible)
+        {
+            return false;
+        }
+
+        // Lay out before painting, since painting depends on the frames.
+        if (m_root->m_dirty_flags
+            & (LEAF_WIDGET_NEEDS_LAYOUT | LEAF_WIDGET_DESCENDANT_NEEDS_LAYOUT))
+        {
+            layout_subtree(m_root.get());
+        }
+
+        if (m_root->m_dirty_flags
+            & (LEAF_WIDGET_NEEDS_PAINT | LEAF_WIDGET_DESCENDANT_NEEDS_PAINT | LEAF_WIDGET_MOVED))
+        {
+            paint_subtree(m_root.get(), pos2_t(0, 0));
+        }
+
+        // Nothing outside the window is drawn, and a few larger rectangles are drawn faster than
+        // many small ones.
+        m_damage.intersect(m_root->m_frame)->coalesce(LEAF_WIDGET_TREE_MAX_DAMAGE_RECTS);
+
+        return m_counters.layouts || m_counters.paints;
+    }
+
+    void widget_tree::draw(canvas_i &canvas) noexcept
+    {
+        LEAF_TRACE_ZONE("widget_tree::draw");
+
+        // Draw the whole window uncut, which covers any damage. The canvas keeps drawing inside
+        // the window.
+        rect2_t window_rect = m_root->m_frame;
+        m_damage.clear();
+        m_is_damage_lost = false;
+
+        // Count only the widgets and pixels of this draw.
+        m_counters.draws = 0;
+        m_counters.damage_rects = 1;
+        m_counters.repainted_pixels = (uint64_t)max(window_rect.width, (px_t)0)
+            * (uint64_t)max(window_rect.height, (px_t)0);
+
+        // Cover whatever the canvas showed before under the widgets.
+        canvas.fill_rect(window_rect, m_background);
+
+        if (m_root->m_is_visible)
+        {
+            draw_subtree(m_root.get(), canvas, pos2_t(0, 0), NULL, 0);
+        }
+    }
+
+    bool widget_tree::draw_damage(canvas_i &canvas) noexcept
+    {
+        // Fall back to drawing everything if some damage was lost.
+        if (m_is_damage_lost)
+        {
+            draw(canvas);
+            return true;
+        }
+
+        LEAF_TRACE_ZONE("widget_tree::draw_damage");
+
+        // Count only the widgets and pixels of this draw.
+        m_counters.draws = 0;
+        m_counters.damage_rects = m_damage.count();
+        m_counters.repainted_pixels = m_damage.area();
+
+        if (m_damage.empty())
+        {
+            return false;
+        }
+
+        // Cover the last draw inside the damage, so that widgets that are not opaque do not
+        // blend over what they looked like before.
+        for (const rect2_t &rect : m_damage.rects())
+        {
+            canvas.fill_rect(rect, m_background);
+        }
+
+        if (m_root->m_is_visible)
+        {
+            draw_subtree(m_root.get(), canvas, pos2_t(0, 0), m_damage.rects().data(),
+                m_damage.count());
+        }
+
+        m_damage.clear();
+
+        return true;
+    }
+
+    const region &widget_tree::damage(void) const noexcept
+    {
+        // Return the damage.
+        return m_damage;
+    }
+
+    bool widget_tree::is_damage_lost(void) const noexcept
+    {
+        // Return whether damage was lost.
+        return m_is_damage_lost;
+    }
+
+    uint32_t widget_tree::background(void) const noexcept
+    {
+        // Return the background color.
+        return m_background;
+    }
+
+    widget_tree *widget_tree::set_background(uint32_t background) noexcept
+    {
+        // The whole window looks different with another background.
+        if (background != m_background)
+        {
+            m_background = background;
+            add_damage(m_root->m_frame);
+        }
+
+        // Return a pointer to the tree for chaining.
+        return this;
+    }
+
+    widget *widget_tree::hit_test(const pos2_t &point) const noexcept
+    {
+        widget *hit = NULL;
+        widget *node = m_root.get();
+        pos2_t offset(0, 0);
+
+        // Descend from the root into the topmost visible child that contains the point, as long
+        // as there is one.
+        while (node && node->m_is_visible
+            && contains(rect2_t(offset.x + node->m_frame.x, offset.y + node->m_frame.y,
+                node->m_frame.width, node->m_frame.height), point))
+        {
+            hit = node;
+            offset = pos2_t(offset.x + node->m_frame.x, offset.y + node->m_frame.y);
+            node = NULL;
+
+            for (size_t i = hit->m_children.size(); i > 0; i--)
+            {
+                const widget *child = hit->m_children[i - 1].get();
+                rect2_t child_frame(offset.x + child->m_frame.x, offset.y + child->m_frame.y,
+                    child->m_frame.width, child->m_frame.height);
+
+                if (child->m_is_visible && contains(child_frame, point))
+                {
+                    node = hit->m_children[i - 1].get();
+                    break;
+                }
+            }
+        }
+
+        return hit;
+    }
+
+    const widget_tree_counters_t &widget_tree::counters(void) const noexcept
+    {
+        // Return the counters.
+        return m_counters;
+    }
+}
@@ -0,0 +1,328 @@
+///
+/// @file       widget_tree.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a class that represents a retained tree of widgets attached to a managed
+///             window. Only the subtrees that were invalidated are laid out and painted again.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_WIDGET_TREE_HEADER_GUARD
+#define LEAF_SRC_WIDGET_TREE_HEADER_GUARD
+
+#include <cstdint>
+#include <memory>
+#include "../utils/unique.hpp"
+#include "../event_handler/window_event_handler_i.hpp"
+#include "../graphics/graphics_types.hpp"
+#include "../graphics/region.hpp"
+#include "../graphics/render/canvas_i.hpp"
+#include "../window/managed/managed_window.hpp"
+#include "widget.hpp"
+
+///
+/// @brief  The largest number of rectangles the damage of a widget tree is kept in. More damaged
+///         rectangles are merged into their bounds, since drawing many small rectangles one at a
+///         time costs more than drawing a few pixels too many.
+///
+#define LEAF_WIDGET_TREE_MAX_DAMAGE_RECTS 16
+
+///
+/// @brief  The color a widget tree fills the window with under its widgets by default, in RGBA
+///         format.
+///
+#define LEAF_WIDGET_TREE_DEFAULT_BACKGROUND 0x303030ff
+
+namespace leaf
+{
+    ///
+    /// @brief  Counts the widgets an update and a draw of a widget tree went through. The number
+    ///         of visited widgets grows with the number of invalidated subtrees, not with the size
+    ///         of the tree.
+    ///
+    typedef struct widget_tree_counters
+    {
+        ///
+        /// @brief  The number of widgets the layout pass visited.
+        ///
+        uint64_t layout_visits;
+
+        ///
+        /// @brief  The number of widgets that were laid out.
+        ///
+        uint64_t layouts;
+
+        ///
+        /// @brief  The number of widgets the paint pass visited.
+        ///
+        uint64_t paint_visits;
+
+        ///
+        /// @brief  The number of widgets that were painted.
+        ///
+        uint64_t paints;
+
+        ///
+        /// @brief  The number of widgets whose recorded painting was replayed by the last draw.
+        ///
+        uint64_t draws;
+
+        ///
+        /// @brief  The number of rectangles the last draw was cut to.
+        ///
+        uint64_t damage_rects;
+
+        ///
+        /// @brief  The number of pixels the last draw covered. A draw of the whole window covers
+        ///         every pixel of it, a draw of the damage only the damaged pixels.
+        ///
+        uint64_t repainted_pixels;
+
+    } widget_tree_counters_t;
+
+    ///
+    /// @brief  Represents a retained tree of widgets attached to a managed window. The root widget
+    ///         always fills the window and is resized with it. Each update lays out and paints only
+    ///         the invalidated subtrees, and each draw replays the recorded painting of every
+    ///         visible widget onto a canvas.
+    ///
+    ///         Each update also adds the areas that look different to the damage of the window,
+    ///         so that a draw of the damage only replays the painting inside those areas. Damage
+    ///         assumes that widgets paint inside their frames and that children stay inside their
+    ///         parents.
+    ///
+    ///         The tree subscribes to the resized and closed events of the window. It must be
+    ///         destroyed before the window, unless the window has already closed.
+    ///
+    class widget_tree : public utl::unique, virtual public window_event_handler_i
+    {
+        private:
+            ///
+            /// @brief  The window the tree is attached to, or null once it has closed.
+            ///
+            managed_window *m_window;
+
+            ///
+            /// @brief  The root widget, which fills the window.
+            ///
+            std::unique_ptr<widget> m_root;
+
+            ///
+            /// @brief  The counters of the last update and draw.
+            ///
+            widget_tree_counters_t m_counters;
+
+            ///
+            /// @brief  The area of the window that must be drawn again, in window coordinates.
+            ///
+            region m_damage;
+
+            ///
+            /// @brief  Denotes whether damage could not be recorded, so that the whole window must
+            ///         be drawn again.
+            ///
+            bool m_is_damage_lost;
+
+            ///
+            /// @brief  The color the window is filled with under the widgets.
+            ///
+            uint32_t m_background;
+
+            ///
+            /// @brief  Adds a rectangle to the damage.
+            ///
+            /// @param  rect    the rectangle in window coordinates
+            ///
+            void add_damage(const rect2_t &rect) noexcept;
+
+            ///
+            /// @brief  Lays out a widget if it needs layout, then descends into the children if
+            ///         any of its descendants need layout.
+            ///
+            /// @param  node    the widget
+            ///
+            void layout_subtree(widget *node) noexcept;
+
+            ///
+            /// @brief  Paints a widget if it needs painting, then descends into the children if any
+            ///         of its descendants need painting. Widgets that were painted, moved or hidden
+            ///         are added to the damage.
+            ///
+            /// @param  node    the widget
+            /// @param  offset  the position of the parent in the window
+            ///
+            void paint_subtree(widget *node, const pos2_t &offset) noexcept;
+
+            ///
+            /// @brief  Replays the recorded painting of a visible widget and its visible
+            ///         descendants, cut to clip rectangles that do not overlap. Each widget also
+            ///         remembers where it was drawn.
+            ///
+            /// @param  node        the widget
+            /// @param  canvas      the canvas to draw onto
+            /// @param  offset      the position of the parent in the window
+            /// @param  clips       the clip rectangles in window coordinates, or null to leave the
+            ///                     painting uncut
+            /// @param  clip_count  the number of clip rectangles
+            ///
+            void draw_subtree(widget *node, canvas_i &canvas, const pos2_t &offset,
+                const rect2_t *clips, size_t clip_count) noexcept;
+
+            ///
+            /// @brief  Marks a widget and its descendants as needing layout and painting and
+            ///         forgets their measurements.
+            ///
+            /// @param  node    the widget
+            ///
+            void invalidate_subtree(widget *node) noexcept;
+
+        public:
+            ///
+            /// @brief  Attaches an empty tree to a window. The root widget is sized to the window.
+            ///
+            /// @param  window  the window to attach to
+            ///
+            /// @throw  std::runtime_error if the window is null or not alive
+            ///
+            widget_tree(managed_window *window);
+
+            ///
+            /// @brief  Detaches the tree from its window if it is still alive.
+            ///
+            ~widget_tree() noexcept;
+
+            ///
+            /// @brief  Stops using the window, since it no longer exists.
+            ///
+            virtual void closed(void) noexcept override;
+
+            ///
+            /// @brief  Does nothing, the tree does not decide whether the window closes.
+            ///
+            virtual void user_requested_close(void) noexcept override;
+
+            ///
+            /// @brief  Resizes the root widget to the new bounds of the window.
+            ///
+            /// @param  new_bounds  the new bounds of the window
+            ///
+            virtual void resized(const bounds2_t &new_bounds) noexcept override;
+
+            ///
+            /// @brief  Returns the window the tree is attached to.
+            ///
+            /// @return the window or null if it has closed
+            ///
+            managed_window *window(void) const noexcept;
+
+            ///
+            /// @brief  Returns the root widget. Widgets are added to the tree as its descendants.
+            ///
+            /// @return the root widget
+            ///
+            widget *root(void) const noexcept;
+
+            ///
+            /// @brief  Replaces the root widget, such as with a flex box that arranges the window.
+            ///         The new root is sized to the window.
+            ///
+            /// @param  root    the new root, which must not have a parent
+            ///
+            /// @return the new root
+            ///
+            /// @throw  std::runtime_error if the root is null or has a parent
+            ///
+            widget *set_root(std::unique_ptr<widget> root);
+
+            ///
+            /// @brief  Marks every widget as needing layout and painting and forgets every
+            ///         measurement, so that the next update lays out the whole tree from scratch.
+            ///         It is meant for changes that affect every widget, such as a new scale.
+            ///
+            void invalidate_all(void) noexcept;
+
+            ///
+            /// @brief  Lays out and paints the invalidated subtrees. Hidden subtrees are skipped
+            ///         and keep their dirty flags.
+            ///
+            /// @return true if and only if any widget was laid out or painted, meaning the window
+            ///         looks different when it is drawn next
+            ///
+            bool update(void) noexcept;
+
+            ///
+            /// @brief  Returns the color the window is filled with under the widgets.
+            ///
+            /// @return the background color in RGBA format
+            ///
+            uint32_t background(void) const noexcept;
+
+            ///
+            /// @brief  Sets the color the window is filled with under the widgets. It should be
+            ///         opaque, since the damage is drawn over what the canvas showed before.
+            ///
+            /// @param  background  the background color in RGBA format
+            ///
+            /// @return a pointer to the tree
+            ///
+            widget_tree *set_background(uint32_t background) noexcept;
+
+            ///
+            /// @brief  Fills the window with the background, then replays the recorded painting
+            ///         of every visible widget onto a canvas in drawing order, in window
+            ///         coordinates. The damage is cleared, since the whole window is drawn.
+            ///
+            /// @param  canvas  the canvas to draw onto
+            ///
+            void draw(canvas_i &canvas) noexcept;
+
+            ///
+            /// @brief  Fills the damage with the background, then replays the recorded painting
+            ///         of the visible widgets onto a canvas cut to the damage, and clears the
+            ///         damage. The canvas must still show the last draw outside the damage. Each
+            ///         pixel of the damage is drawn in drawing order, as the rectangles of the
+            ///         damage do not overlap. If damage was lost, the whole window is drawn.
+            ///
+            /// @param  canvas  the canvas to draw onto
+            ///
+            /// @return true if and only if anything was drawn
+            ///
+            bool draw_damage(canvas_i &canvas) noexcept;
+
+            ///
+            /// @brief  Returns the area of the window that must be drawn again since the last draw,
+            ///         such as to set a scissor for each of its rectangles.
+            ///
+            /// @return the damage in window coordinates
+            ///
+            const region &damage(void) const noexcept;
+
+            ///
+            /// @brief  Determines whether damage could not be recorded, in which case the next draw
+            ///         of the damage draws the whole window.
+            ///
+            /// @return true if and only if damage was lost since the last draw
+            ///
+            bool is_damage_lost(void) const noexcept;
+
+            ///
+            /// @brief  Finds the topmost visible widget that contains a point.
+            ///
+            /// @param  point   the point in window coordinates
+            ///
+            /// @return the widget or null if the point is outside the root
+            ///
+            widget *hit_test(const pos2_t &point) const noexcept;
+
+            ///
+            /// @brief  Returns the counters of the last update and draw.
+            ///
+            /// @return the counters
+            ///
+            const widget_tree_counters_t &counters(void) const noexcept;
+    };
+}
+
+#endif
@@ -0,0 +1,196 @@
+///
+/// @file       headless.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a class that represents a window manager without a windowing
+///             system. Windows only exist in memory and events are synthetic, so the library can be
+///             exercised and measured on machines without a display. The class creates a singleton
+///             object, i.e. only one headless window manager object can be created.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <chrono>
+#include "headless.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    // Initialize the headless window manager instance.
+    headless headless::instance;
+
+    // Initially, no events are queued and the window manager has not been woken.
+    headless::headless(void) noexcept : m_is_woken(false) {}
+
+    headless::~headless() noexcept
+    {
+        // Ensure that all windows are closed.
+        close_all_windows();
+    }
+
+    bool headless::register_headless_window(headless_window *window)
+    {
+        // Register the window with the generic window manager.
+        return register_window(window);
+    }
+
+    bool headless::unregister_headless_window(headless_window *window)
+    {
+        // Unregister the window with the generic window manager. If it was not being managed,
+        // there is nothing else to forget.
+        if (!unregister_window(window))
+        {
+            return false;
+        }
+
+        // If the window has deferred events, forget it so that they are not flushed.
+        for (headless_window *&deferring_window : m_windows_with_deferred_events)
+        {
+            if (deferring_window == window)
+            {
+                deferring_window = NULL;
+            }
+        }
+
+        // Return true indicating that the window is no longer being managed.
+        return true;
+    }
+
+    void headless::deliver_events(void) noexcept
+    {
+        // Take the queued events so that the lock is not held while handlers run. Events posted by
+        // handlers are delivered in the next cycle.
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_delivering_events.swap(m_events);
+        }
+
+        // Deliver each event to the window it is addressed to. Events for windows that have since
+        // been unregistered no longer resolve and are discarded. Only headless windows are
+        // registered with this manager, so the downcast is safe.
+        for (const headless_event_t &event : m_delivering_events)
+        {
+            headless_window *window = static_cast<headless_window *>(this->window(event.window));
+
+            if (window && window->handle_event(event))
+            {
+                m_windows_with_deferred_events.push_back(window);
+            }
+        }
+
+        m_delivering_events.clear();
+
+        // Notify the handlers of each window with deferred events. The list is walked by index
+        // since a handler may destroy a window, which nulls its entry.
+        for (size_t i = 0; i < m_windows_with_deferred_events.size(); i++)
+        {
+            if (m_windows_with_deferred_events[i])
+            {
+                m_windows_with_deferred_events[i]->flush_deferred_events();
+            }
+        }
+
+        // Start the next poll cycle with no windows deferring events.
+        m_windows_with_deferred_events.clear();
+    }
+
+    void headless::post_event(const headless_event_t &event)
+    {
+        // Queue the event.
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_events.push_back(event);
+        }
+
+        // Wake a waiting thread so the event is delivered.
+        m_condition.notify_one();
+    }
+
+    size_t headless::queued_event_count(void) noexcept
+    {
+        lock_guard<mutex> lock(m_mutex);
+
+        // Return the number of queued events.
+        return m_events.size();
+    }
+
+    bool headless::poll_events(void) noexcept
+    {
+        // Execute a frame that is already available, if any, without waiting. This does nothing if
+        // no frame hook is set.
+        run_frame_hook(0);
+
+        // Deliver the queued events and flush the deferred ones.
+        deliver_events();
+
+        // Poll all managed windows and return whether any are still alive.
+        return poll_windows();
+    }
+
+    bool headless::wait_events(int32_t timeout_ms) noexcept
+    {
+        // Poll the managed windows first so that windows flagged to close since the last update
+        // are destroyed without waiting for an event. If no living windows remain, there is
+        // nothing to wait for.
+        if (!poll_windows())
+        {
+            return false;
+        }
+
+        // If a frame hook is set, this thread must keep executing the frames it provides. Wait for
+        // the next frame instead of for an event, bounded as the SDL window manager does so that
+        // queued events are still delivered promptly. The frame wait cannot be interrupted, so a
+        // wake is only handled once it ends.
+        if (has_frame_hook())
+        {
+            if (timeout_ms == LEAF_WINDOW_MANAGER_WAIT_FOREVER
+                || timeout_ms > LEAF_WINDOW_MANAGER_FRAME_WAIT_MS)
+            {
+                timeout_ms = LEAF_WINDOW_MANAGER_FRAME_WAIT_MS;
+            }
+
+            run_frame_hook(timeout_ms);
+
+            // Consume the wake, which the frame wait has outlasted.
+            lock_guard<mutex> lock(m_mutex);
+            m_is_woken = false;
+        }
+        else
+        {
+            // Sleep until an event is queued, the window manager is woken, or the timeout elapses.
+            // Consume the wake so that the next wait sleeps again.
+            unique_lock<mutex> lock(m_mutex);
+            auto is_ready = [this](void) { return !m_events.empty() || m_is_woken; };
+
+            if (timeout_ms == LEAF_WINDOW_MANAGER_WAIT_FOREVER)
+            {
+                m_condition.wait(lock, is_ready);
+            }
+            else
+            {
+                m_condition.wait_for(lock, chrono::milliseconds(timeout_ms), is_ready);
+            }
+
+            m_is_woken = false;
+        }
+
+        // Deliver whatever was queued and poll the managed windows.
+        return poll_events();
+    }
+
+    bool headless::wake(void) noexcept
+    {
+        // Flag the wake so that it is not lost if no thread is waiting yet.
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_is_woken = true;
+        }
+
+        // Wake a waiting thread. A flagged wake is never lost.
+        m_condition.notify_one();
+
+        return true;
+    }
+}
@@ -0,0 +1,169 @@
+///
+/// @file       headless.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a class that represents a window manager without a windowing system.
+///             Windows only exist in memory and events are synthetic, so the library can be
+///             exercised and measured on machines without a display. The class creates a singleton
+///             object, i.e. only one headless window manager object can be created.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_HEADLESS_HEADER_GUARD
+#define LEAF_SRC_HEADLESS_HEADER_GUARD
+
+// The class must be forward declared because there are circular includes between the headless
+// window manager and headless window classes.
+namespace leaf
+{
+    class headless;
+}
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+#include "../window_manager.hpp"
+#include "headless_event_types.hpp"
+#include "headless_window.hpp"
+
+namespace leaf
+{
+    ///
+    /// @brief  Represents a window manager without a windowing system. Windows only exist in
+    ///         memory and events are synthetic. Events can be queued from any thread and are
+    ///         delivered to their windows when events are polled. The class creates a singleton
+    ///         object, i.e. only one headless window manager object can be created.
+    ///
+    class headless : public window_manager
+    {
+        // Headless windows must be able to access hidden functionality of the window manager.
+        friend class headless_window;
+
+        public:
+            ///
+            /// @brief  One single instance of the headless window manager will be created. This
+            ///         instance should be used externally to make all API calls.
+            ///
+            static headless instance;
+
+        private:
+            ///
+            /// @brief  Guards the event queue and the wake flag.
+            ///
+            std::mutex m_mutex;
+
+            ///
+            /// @brief  Signaled when an event is queued or the window manager is woken.
+            ///
+            std::condition_variable m_condition;
+
+            ///
+            /// @brief  The synthetic events that have not yet been delivered, in order.
+            ///
+            std::vector<headless_event_t> m_events;
+
+            ///
+            /// @brief  The events being delivered during the current poll cycle. It is kept as a
+            ///         member so that its storage is reused between cycles.
+            ///
+            std::vector<headless_event_t> m_delivering_events;
+
+            ///
+            /// @brief  Denotes whether the window manager was woken since it last waited.
+            ///
+            bool m_is_woken;
+
+            ///
+            /// @brief  The headless windows with events deferred during the current poll cycle.
+            ///         Each window appears at most once. Entries of windows unregistered during the
+            ///         cycle are set to null.
+            ///
+            std::vector<headless_window *> m_windows_with_deferred_events;
+
+            ///
+            /// @brief  Delivers every queued event to its window, then notifies the event handlers
+            ///         of every window with deferred events. This is a full poll cycle excluding
+            ///         the polling of the windows.
+            ///
+            void deliver_events(void) noexcept;
+
+        protected:
+            ///
+            /// @brief  Creates the headless window manager.
+            ///
+            headless(void) noexcept;
+
+            ///
+            /// @brief  Closes every window and destroys the headless window manager.
+            ///
+            virtual ~headless() noexcept;
+
+            ///
+            /// @brief  Adds the given headless window to the set of managed windows.
+            ///
+            /// @param  window  a pointer to the headless window to start managing
+            ///
+            /// @return true if and only if the window was not already being managed
+            ///
+            bool register_headless_window(headless_window *window);
+
+            ///
+            /// @brief  Removes the given headless window from the set of managed windows. Events
+            ///         still queued for it are discarded when they are delivered.
+            ///
+            /// @param  window  a pointer to the headless window to stop managing
+            ///
+            /// @return true if and only if the window was being managed
+            ///
+            bool unregister_headless_window(headless_window *window);
+
+        public:
+            ///
+            /// @brief  Queues a synthetic event for delivery the next time events are polled and
+            ///         wakes a thread waiting for events. This is safe to call from any thread.
+            ///
+            /// @param  event   the event to queue
+            ///
+            void post_event(const headless_event_t &event);
+
+            ///
+            /// @brief  Determines the number of events queued but not yet delivered.
+            ///
+            /// @return the number of queued events
+            ///
+            size_t queued_event_count(void) noexcept;
+
+            ///
+            /// @brief  Executes an available frame if a frame hook is set, delivers every queued
+            ///         event to its window, and polls the events of each living managed window.
+            ///
+            /// @return true if and only if at least one living window is under management
+            ///
+            virtual bool poll_events(void) noexcept override;
+
+            ///
+            /// @brief  Waits until at least one event is queued, the timeout elapses, or the
+            ///         window manager is woken, then performs the same updates as polling events.
+            ///         If a frame hook is set, it waits for the next frame instead, for at most
+            ///         LEAF_WINDOW_MANAGER_FRAME_WAIT_MS milliseconds.
+            ///
+            /// @param  timeout_ms  the maximum number of milliseconds to wait or
+            ///                     LEAF_WINDOW_MANAGER_WAIT_FOREVER to wait without a timeout
+            ///
+            /// @return true if and only if at least one living window is under management
+            ///
+            virtual bool wait_events(int32_t timeout_ms) noexcept override;
+
+            ///
+            /// @brief  Wakes a thread that is waiting for events. This is safe to call from any
+            ///         thread.
+            ///
+            /// @return true, since a wake is flagged even if no thread is waiting yet
+            ///
+            virtual bool wake(void) noexcept override;
+    };
+}
+
+#endif
@@ -0,0 +1,74 @@
+///
+/// @file       headless_event_types.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for defining the synthetic events that the headless window manager queues
+///             and delivers to headless windows in place of events from a windowing system.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_HEADLESS_EVENT_TYPES_HEADER_GUARD
+#define LEAF_SRC_HEADLESS_EVENT_TYPES_HEADER_GUARD
+
+#include <cstdint>
+#include "../../../utils/slot_map.hpp"
+#include "../../../graphics/graphics_types.hpp"
+
+namespace leaf
+{
+    ///
+    /// @brief  Identifies a kind of synthetic headless window event. Each corresponds to an event a
+    ///         windowing system would report.
+    ///
+    enum class headless_event_type : uint8_t
+    {
+        close_requested,
+        resized,
+        moved,
+        shown,
+        hidden,
+        minimized,
+        maximized,
+        focus_gained,
+        focus_lost
+    };
+
+    ///
+    /// @brief  Represents a synthetic headless window event.
+    ///
+    typedef struct headless_event
+    {
+        ///
+        /// @brief  The handle of the window the event is addressed to.
+        ///
+        utl::slot_handle_t window;
+
+        ///
+        /// @brief  The kind of event.
+        ///
+        headless_event_type type;
+
+        ///
+        /// @brief  The first data component: the new width for a resize or the new x-position for
+        ///         a move. It is unused by other events.
+        ///
+        px_t data1;
+
+        ///
+        /// @brief  The second data component: the new height for a resize or the new y-position
+        ///         for a move. It is unused by other events.
+        ///
+        px_t data2;
+
+        ///
+        /// @brief  The time in nanoseconds the event was posted at, read from the monotonic clock
+        ///         window event managers use by default.
+        ///
+        uint64_t time_ns;
+
+    } headless_event_t;
+}
+
+#endif
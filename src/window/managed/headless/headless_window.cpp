@@ -0,0 +1,399 @@
+///
+/// @file       headless_window.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a class that represents a window without a windowing system. Its
+///             state only exists in memory and its events are synthetic. A window is immediately
+///             alive (open) upon its object's construction, however, it may be closed before its
+///             object's destruction.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include "headless_window.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    void headless_window::post_event(headless_event_type type, px_t data1, px_t data2) const
+    {
+        // Address the event to this window's handle, stamp it with the time it occured, and queue
+        // it with the window manager.
+        headless::instance.post_event({handle(), type, data1, data2, m_event_manager->now_ns()});
+    }
+
+    headless_window::headless_window(void)
+        // Delegate to the constructor with explicit parameters.
+        : headless_window("", LEAF_HEADLESS_WINDOW_DEFAULT_WIDTH,
+            LEAF_HEADLESS_WINDOW_DEFAULT_HEIGHT) {}
+
+    headless_window::headless_window(const string &title, px_t width, px_t height)
+        // Delegate to the constructor with explicit parameters.
+        : headless_window(title, 0, 0, width, height) {}
+
+    headless_window::headless_window(const string &title, px_t x, px_t y, px_t width, px_t height)
+        // Upon creation, the window should not be flagged to close. It will not be resizable by the
+        // user. Like an SDL window it starts hidden, unfocused, and framed.
+        : m_should_close(false), m_is_user_resizable(false),
+        m_event_manager(new headless_window_event_manager(this)), m_bounds(width, height),
+        m_pos(x, y), m_is_visible(false), m_has_focus(false), m_framed(true), m_title(title),
+        m_has_pending_resize(false), m_has_pending_move(false)
+    {
+        // Register the window with the headless window manager.
+        headless::instance.register_headless_window(this);
+    }
+
+    headless_window::~headless_window() noexcept
+    {
+        // Unregister the window with the headless window manager.
+        headless::instance.unregister_headless_window(this);
+
+        // Ensure that the window is closed.
+        destroy();
+
+        // Destroy the event manager.
+        delete m_event_manager;
+    }
+
+    bool headless_window::destroy(void) noexcept
+    {
+        // Try to update the flag indicating that the window was closed. If the window has already
+        // been closed, do nothing and return false indicating that no close was needed.
+        if (!flag_as_closed())
+        {
+            return false;
+        }
+
+        // Notify the handlers of the close.
+        m_event_manager->notify_closed();
+
+        // Return true indicating that the window was successfully closed.
+        return true;
+    }
+
+    bool headless_window::should_close(void) const noexcept
+    {
+        // Return the flag indicating whether the window should close.
+        return m_should_close;
+    }
+
+    managed_window *headless_window::set_should_close(bool should_close) noexcept
+    {
+        // Set the flag to the new value.
+        m_should_close = should_close;
+
+        // Return a pointer to the window for chaining.
+        return this;
+    }
+
+    bool headless_window::poll_events(void) noexcept
+    {
+        // If the window is not alive return false immediately.
+        if (!is_alive())
+        {
+            return false;
+        }
+
+        // Check if the window should close and destroy it if necessary.
+        if (m_should_close)
+        {
+            destroy();
+            return false;
+        }
+
+        // Return true indicating that the window is still alive.
+        return true;
+    }
+
+    bool headless_window::handle_event(const headless_event_t &event) noexcept
+    {
+        // Mirror the change the event carries into the window's state before handlers are
+        // notified, as a windowing system would have already applied it.
+        switch (event.type)
+        {
+            case headless_event_type::resized:
+                m_bounds = {event.data1, event.data2};
+                break;
+
+            case headless_event_type::moved:
+                m_pos = {event.data1, event.data2};
+                break;
+
+            case headless_event_type::shown:
+                m_is_visible = true;
+                break;
+
+            case headless_event_type::hidden:
+                m_is_visible = false;
+                break;
+
+            case headless_event_type::focus_gained:
+                m_has_focus = true;
+                break;
+
+            case headless_event_type::focus_lost:
+                m_has_focus = false;
+                break;
+
+            // Other events do not affect the window's state.
+            default:
+                break;
+        }
+
+        // Forward the event to the window's event manager. Return whether the event manager now
+        // has deferred events to flush.
+        return m_event_manager->handle_event(event);
+    }
+
+    void headless_window::flush_deferred_events(void) noexcept
+    {
+        // Instruct the window's event manager to notify handlers of its deferred events.
+        m_event_manager->flush_deferred_events();
+    }
+
+    void headless_window::apply_update(void) noexcept
+    {
+        // Queue one event per kind of geometry change made during the update.
+        if (m_has_pending_resize)
+        {
+            post_event(headless_event_type::resized, m_bounds.width, m_bounds.height);
+        }
+
+        if (m_has_pending_move)
+        {
+            post_event(headless_event_type::moved, m_pos.x, m_pos.y);
+        }
+
+        // Start the next update with no pending changes.
+        m_has_pending_resize = false;
+        m_has_pending_move = false;
+    }
+
+    bounds2_t headless_window::bounds(void) const noexcept
+    {
+        // Return the bounds.
+        return m_bounds;
+    }
+
+    headless_window *headless_window::set_width(px_t width) noexcept
+    {
+        // Keep the current height.
+        return set_size(width, m_bounds.height);
+    }
+
+    headless_window *headless_window::set_height(px_t height) noexcept
+    {
+        // Keep the current width.
+        return set_size(m_bounds.width, height);
+    }
+
+    headless_window *headless_window::set_size(px_t width, px_t height) noexcept
+    {
+        // A windowing system does not report a resize to the same size.
+        if (width == m_bounds.width && height == m_bounds.height)
+        {
+            return this;
+        }
+
+        // Store the size. Report the resize now or, during a batched update, once on commit.
+        m_bounds = {width, height};
+
+        if (is_updating())
+        {
+            m_has_pending_resize = true;
+        }
+        else
+        {
+            post_event(headless_event_type::resized, width, height);
+        }
+
+        // Return a pointer to the window for chaining.
+        return this;
+    }
+
+    bool headless_window::is_visible(void) const noexcept
+    {
+        // Return the visibility flag.
+        return m_is_visible;
+    }
+
+    headless_window *headless_window::set_visible(bool is_visible) noexcept
+    {
+        // Store the visibility and report the change if there was one.
+        if (is_visible != m_is_visible)
+        {
+            m_is_visible = is_visible;
+            post_event(is_visible ? headless_event_type::shown : headless_event_type::hidden);
+        }
+
+        // Return a pointer to the window for chaining.
+        return this;
+    }
+
+    pos2_t headless_window::pos(void) const noexcept
+    {
+        // Return the position.
+        return m_pos;
+    }
+
+    headless_window *headless_window::set_x(px_t x) noexcept
+    {
+        // Keep the current y-position.
+        return set_pos(x, m_pos.y);
+    }
+
+    headless_window *headless_window::set_y(px_t y) noexcept
+    {
+        // Keep the current x-position.
+        return set_pos(m_pos.x, y);
+    }
+
+    headless_window *headless_window::set_pos(px_t x, px_t y) noexcept
+    {
+        // A windowing system does not report a move to the same position.
+        if (x == m_pos.x && y == m_pos.y)
+        {
+            return this;
+        }
+
+        // Store the position. Report the move now or, during a batched update, once on commit.
+        m_pos = {x, y};
+
+        if (is_updating())
+        {
+            m_has_pending_move = true;
+        }
+        else
+        {
+            post_event(headless_event_type::moved, x, y);
+        }
+
+        // Return a pointer to the window for chaining.
+        return this;
+    }
+
+    bool headless_window::is_user_resizable(void) const noexcept
+    {
+        // Return the flag denoting whether the window is user-resizable.
+        return m_is_user_resizable;
+    }
+
+    headless_window *headless_window::set_user_resizable(bool is_user_resizable) noexcept
+    {
+        // Set the flag to the new value.
+        m_is_user_resizable = is_user_resizable;
+
+        // Return a pointer to the window for chaining.
+        return this;
+    }
+
+    string headless_window::title(void) const noexcept
+    {
+        // Return the title.
+        return m_title;
+    }
+
+    headless_window *headless_window::set_title(const string &title) noexcept
+    {
+        // Store the title.
+        m_title = title;
+
+        // Return a pointer to the window for chaining.
+        return this;
+    }
+
+    bool headless_window::has_focus(void) const noexcept
+    {
+        // Return the focus flag.
+        return m_has_focus;
+    }
+
+    headless_window *headless_window::focus(void) noexcept
+    {
+        // Take focus and report the change if there was one.
+        if (!m_has_focus)
+        {
+            m_has_focus = true;
+            post_event(headless_event_type::focus_gained);
+        }
+
+        // Return a pointer to the window for chaining.
+        return this;
+    }
+
+    bool headless_window::framed(void) const noexcept
+    {
+        // Return the frame flag.
+        return m_framed;
+    }
+
+    headless_window *headless_window::set_framed(bool framed) noexcept
+    {
+        // Set the flag to the new value.
+        m_framed = framed;
+
+        // Return a pointer to the window for chaining.
+        return this;
+    }
+
+    border_t headless_window::frame_border(void) const noexcept
+    {
+        // A framed window only has a title bar, a frameless window has no border.
+        return {0, m_framed ? LEAF_HEADLESS_WINDOW_TITLE_BAR_HEIGHT : (px_t)0, 0, 0};
+    }
+
+    pos2_t headless_window::frame_pos(void) const noexcept
+    {
+        // The frame extends above the surface by the height of the title bar.
+        border_t frame_border = this->frame_border();
+
+        return {
+            (px_t)(m_pos.x - frame_border.left),
+            (px_t)(m_pos.y - frame_border.top)
+        };
+    }
+
+    headless_window_event_manager *headless_window::event_manager(void) const noexcept
+    {
+        // Return a pointer to the window's event manager.
+        return m_event_manager;
+    }
+
+    void headless_window::inject_close_request(void) const
+    {
+        // Queue a close request.
+        post_event(headless_event_type::close_requested);
+    }
+
+    void headless_window::inject_resize(px_t width, px_t height) const
+    {
+        // Queue a resize carrying the new size.
+        post_event(headless_event_type::resized, width, height);
+    }
+
+    void headless_window::inject_move(px_t x, px_t y) const
+    {
+        // Queue a move carrying the new position.
+        post_event(headless_event_type::moved, x, y);
+    }
+
+    void headless_window::inject_minimize(void) const
+    {
+        // Queue a minimization.
+        post_event(headless_event_type::minimized);
+    }
+
+    void headless_window::inject_maximize(void) const
+    {
+        // Queue a maximization.
+        post_event(headless_event_type::maximized);
+    }
+
+    void headless_window::inject_focus(bool has_focus) const
+    {
+        // Queue a focus change.
+        post_event(has_focus ? headless_event_type::focus_gained : headless_event_type::focus_lost);
+    }
+}
@@ -0,0 +1,452 @@
+///
+/// @file       headless_window.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a class that represents a window without a windowing system. Its state
+///             only exists in memory and its events are synthetic. A window is immediately alive
+///             (open) upon its object's construction, however, it may be closed before its
+///             object's destruction.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_HEADLESS_WINDOW_HEADER_GUARD
+#define LEAF_SRC_HEADLESS_WINDOW_HEADER_GUARD
+
+// The class must be forward declared because there are circular includes between the headless
+// window manager and headless window classes.
+namespace leaf
+{
+    class headless_window;
+}
+
+#include <string>
+#include "../managed_window.hpp"
+#include "headless.hpp"
+#include "headless_event_types.hpp"
+#include "headless_window_event_manager.hpp"
+
+///
+/// @brief  The default width of a headless window.
+///
+#define LEAF_HEADLESS_WINDOW_DEFAULT_WIDTH (leaf::px_t)600
+
+///
+/// @brief  The default height of a headless window.
+///
+#define LEAF_HEADLESS_WINDOW_DEFAULT_HEIGHT (leaf::px_t)400
+
+///
+/// @brief  The height of the simulated title bar of a framed headless window. The frame has no
+///         other borders.
+///
+#define LEAF_HEADLESS_WINDOW_TITLE_BAR_HEIGHT (leaf::px_t)28
+
+namespace leaf
+{
+    ///
+    /// @brief  Represents a window without a windowing system. Its state only exists in memory and
+    ///         its events are synthetic. Setters change the state immediately and queue the events
+    ///         a windowing system would report, so handlers observe the same sequence of
+    ///         notifications as with a real window. Events a user would cause can be injected. A
+    ///         window is immediately alive (open) upon its object's construction, however, it may
+    ///         be closed before its object's destruction.
+    ///
+    class headless_window : public managed_window
+    {
+        // The headless window manager must be able to access hidden functionality of a headless
+        // window.
+        friend class headless;
+
+        // The headless window event manager must be able to access hidden functionality of a
+        // headless window.
+        friend class headless_window_event_manager;
+
+        private:
+            ///
+            /// @brief  Denotes whether the window should be closed the next time events are polled.
+            ///
+            bool m_should_close;
+
+            ///
+            /// @brief  Denotes whether the window is resizable by the user.
+            ///
+            bool m_is_user_resizable;
+
+            ///
+            /// @brief  A pointer to the window's event manager.
+            ///
+            headless_window_event_manager *const m_event_manager;
+
+            ///
+            /// @brief  The bounds of the window's display surface in pixels.
+            ///
+            bounds2_t m_bounds;
+
+            ///
+            /// @brief  The position of the window's display surface.
+            ///
+            pos2_t m_pos;
+
+            ///
+            /// @brief  Denotes whether the window is visible.
+            ///
+            bool m_is_visible;
+
+            ///
+            /// @brief  Denotes whether the window has input focus.
+            ///
+            bool m_has_focus;
+
+            ///
+            /// @brief  Denotes whether the window has a frame.
+            ///
+            bool m_framed;
+
+            ///
+            /// @brief  The title of the window.
+            ///
+            std::string m_title;
+
+            ///
+            /// @brief  Denotes whether the size changed during the batched update in progress.
+            ///
+            bool m_has_pending_resize;
+
+            ///
+            /// @brief  Denotes whether the position changed during the batched update in progress.
+            ///
+            bool m_has_pending_move;
+
+            ///
+            /// @brief  Queues a synthetic event addressed to the window.
+            ///
+            /// @param  type    the kind of event
+            /// @param  data1   the first data component
+            /// @param  data2   the second data component
+            ///
+            void post_event(headless_event_type type, px_t data1 = 0, px_t data2 = 0) const;
+
+        protected:
+            ///
+            /// @brief  Destroys the window and deems it dead and therefore closed. Handlers are
+            ///         notified of the close. If the window was already closed, nothing happens.
+            ///
+            /// @return true if and only if the window was not already dead (closed)
+            ///
+            bool destroy(void) noexcept override;
+
+            ///
+            /// @brief  Determines whether the window should close the next time events are polled.
+            ///
+            /// @return true if the window should close
+            ///
+            virtual bool should_close(void) const noexcept override;
+
+            ///
+            /// @brief  Sets the flag indicating whether the window should close the next time
+            ///         events are polled.
+            ///
+            /// @param  should_close    true if the window should close, false if it should not
+            ///                         close
+            ///
+            /// @return a pointer to the window for chaining
+            ///
+            virtual managed_window *set_should_close(bool should_close) noexcept override;
+
+            ///
+            /// @brief  Performs any necessary updates for the window. This includes closing the
+            ///         window if a close was requested. If the window is closed, nothing happens.
+            ///
+            /// @return true if and only if the window is active (has not been closed), if this
+            ///         action causes the window to close or it was already closed, false will be
+            ///         returned
+            ///
+            virtual bool poll_events(void) noexcept override;
+
+            ///
+            /// @brief  Handles a synthetic event addressed to the window. The window's state is
+            ///         updated before handlers are notified.
+            ///
+            /// @param  event   the synthetic event
+            ///
+            /// @return true if and only if the window now has deferred events that must be flushed
+            ///         at the end of the poll cycle and did not have any before
+            ///
+            bool handle_event(const headless_event_t &event) noexcept;
+
+            ///
+            /// @brief  Notifies event handlers of the coalesced events deferred during the current
+            ///         poll cycle.
+            ///
+            void flush_deferred_events(void) noexcept;
+
+            ///
+            /// @brief  Queues a single resize and a single move event for the changes made during
+            ///         the batched update.
+            ///
+            virtual void apply_update(void) noexcept override;
+
+        public:
+            ///
+            /// @brief  Creates a headless window with an empty title and default size at the
+            ///         origin. It is hidden until made visible.
+            ///
+            headless_window(void);
+
+            ///
+            /// @brief  Creates a headless window with the given title and size at the origin. It
+            ///         is hidden until made visible.
+            ///
+            /// @param  title   the title of the window
+            /// @param  width   the width of the window's display surface
+            /// @param  height  the height of the window's display surface
+            ///
+            headless_window(const std::string &title, px_t width, px_t height);
+
+            ///
+            /// @brief  Creates a headless window with the given title, position, and size. It is
+            ///         hidden until made visible.
+            ///
+            /// @param  title   the title of the window
+            /// @param  x       the x-position of the window's display surface
+            /// @param  y       the y-position of the window's display surface
+            /// @param  width   the width of the window's display surface
+            /// @param  height  the height of the window's display surface
+            ///
+            headless_window(const std::string &title, px_t x, px_t y, px_t width, px_t height);
+
+            ///
+            /// @brief  Destructs the window, closing it if it is not already closed.
+            ///
+            virtual ~headless_window() noexcept;
+
+            ///
+            /// @brief  Determines the bounds of the window's display surface in pixels.
+            ///
+            /// @return the bounds of the window's display surface
+            ///
+            virtual bounds2_t bounds(void) const noexcept override;
+
+            ///
+            /// @brief  Sets the width of the window's display surface in pixels. The height is not
+            ///         affected.
+            ///
+            /// @param  width   the new width of the surface in pixels
+            ///
+            /// @return a pointer to the window for chaining
+            ///
+            virtual headless_window *set_width(px_t width) noexcept override;
+
+            ///
+            /// @brief  Sets the height of the window's display surface in pixels. The width is not
+            ///         affected.
+            ///
+            /// @param  height  the new height of the surface in pixels
+            ///
+            /// @return a pointer to the window for chaining
+            ///
+            virtual headless_window *set_height(px_t height) noexcept override;
+
+            ///
+            /// @brief  Sets the size of the window's display surface in pixels.
+            ///
+            /// @param  width   the new width of the surface in pixels
+            /// @param  height  the new height of the surface in pixels
+            ///
+            /// @return a pointer to the window for chaining
+            ///
+            virtual headless_window *set_size(px_t width, px_t height) noexcept override;
+
+            ///
+            /// @brief  Determines whether the window is visible.
+            ///
+            /// @return whether the window is visible
+            ///
+            virtual bool is_visible(void) const noexcept override;
+
+            ///
+            /// @brief  Sets whether the window is visible.
+            ///
+            /// @param  is_visible  true if the window should be visible
+            ///
+            /// @return a pointer to the window for chaining
+            ///
+            virtual headless_window *set_visible(bool is_visible) noexcept override;
+
+            ///
+            /// @brief  Determines the position of the top left corner of the window's display
+            ///         surface.
+            ///
+            /// @return the position of the window's display surface
+            ///
+            virtual pos2_t pos(void) const noexcept override;
+
+            ///
+            /// @brief  Sets the x-position of the window's display surface in pixels. The
+            ///         y-position is not affected.
+            ///
+            /// @param  x   the new x-position of the surface in pixels
+            ///
+            /// @return a pointer to the window for chaining
+            ///
+            virtual headless_window *set_x(px_t x) noexcept override;
+
+            ///
+            /// @brief  Sets the y-position of the window's display surface in pixels. The
+            ///         x-position is not affected.
+            ///
+            /// @param  y   the new y-position of the surface in pixels
+            ///
+            /// @return a pointer to the window for chaining
+            ///
+            virtual headless_window *set_y(px_t y) noexcept override;
+
+            ///
+            /// @brief  Sets the position of the window's display surface in pixels.
+            ///
+            /// @param  x   the new x-position of the surface in pixels
+            /// @param  y   the new y-position of the surface in pixels
+            ///
+            /// @return a pointer to the window for chaining
+            ///
+            virtual headless_window *set_pos(px_t x, px_t y) noexcept override;
+
+            ///
+            /// @brief  Determines whether the user can interact with the window's frame to resize
+            ///         it.
+            ///
+            /// @return true if and only if the user can interact with the frame to resize it
+            ///
+            virtual bool is_user_resizable(void) const noexcept override;
+
+            ///
+            /// @brief  Sets whether the user can interact with the window's frame to resize it.
+            ///
+            /// @param  is_user_resizable   whether the user can interact with the frame to resize
+            ///                             it
+            ///
+            /// @return a pointer to the window for chaining
+            ///
+            virtual headless_window *set_user_resizable(bool is_user_resizable) noexcept override;
+
+            ///
+            /// @brief  Determines the title of the window.
+            ///
+            /// @return the title of the window
+            ///
+            virtual std::string title(void) const noexcept override;
+
+            ///
+            /// @brief  Sets the title of the window.
+            ///
+            /// @param  title   the title of the window
+            ///
+            /// @return a pointer to the window for chaining
+            ///
+            virtual headless_window *set_title(const std::string &title) noexcept override;
+
+            ///
+            /// @brief  Determines whether the window has input focus.
+            ///
+            /// @return true if and only if the window has input focus
+            ///
+            virtual bool has_focus(void) const noexcept override;
+
+            ///
+            /// @brief  Gives the window input focus.
+            ///
+            /// @return a pointer to the window for chaining
+            ///
+            virtual headless_window *focus(void) noexcept override;
+
+            ///
+            /// @brief  Determines whether the window has a frame.
+            ///
+            /// @return true if and only if the window has a frame
+            ///
+            virtual bool framed(void) const noexcept override;
+
+            ///
+            /// @brief  Sets whether the window has a frame.
+            ///
+            /// @param  framed  true if the window should have a frame
+            ///
+            /// @return a pointer to the window for chaining
+            ///
+            virtual headless_window *set_framed(bool framed) noexcept override;
+
+            ///
+            /// @brief  Determines the size of the frame as border measurements. A framed headless
+            ///         window only has a title bar, a frameless one has no border.
+            ///
+            /// @return the size of the frame as border measurements
+            ///
+            virtual border_t frame_border(void) const noexcept override;
+
+            ///
+            /// @brief  Determines the position of the top left corner of the frame.
+            ///
+            /// @return the position of the frame
+            ///
+            virtual pos2_t frame_pos(void) const noexcept override;
+
+            ///
+            /// @brief  Returns a pointer to the window's event manager.
+            ///
+            /// @return a pointer to the window's event manager
+            ///
+            virtual headless_window_event_manager *event_manager(void) const noexcept override;
+
+            ///
+            /// @brief  Injects a close request as if the user clicked the close button on the
+            ///         frame. It is delivered the next time events are polled. This is safe to call
+            ///         from any thread.
+            ///
+            void inject_close_request(void) const;
+
+            ///
+            /// @brief  Injects a resize as if the user dragged the frame. The window's bounds
+            ///         change when it is delivered the next time events are polled. This is safe to
+            ///         call from any thread.
+            ///
+            /// @param  width   the new width of the surface in pixels
+            /// @param  height  the new height of the surface in pixels
+            ///
+            void inject_resize(px_t width, px_t height) const;
+
+            ///
+            /// @brief  Injects a move as if the user dragged the frame. The window's position
+            ///         changes when it is delivered the next time events are polled. This is safe
+            ///         to call from any thread.
+            ///
+            /// @param  x   the new x-position of the surface in pixels
+            /// @param  y   the new y-position of the surface in pixels
+            ///
+            void inject_move(px_t x, px_t y) const;
+
+            ///
+            /// @brief  Injects a minimization. It is delivered the next time events are polled.
+            ///         This is safe to call from any thread.
+            ///
+            void inject_minimize(void) const;
+
+            ///
+            /// @brief  Injects a maximization. It is delivered the next time events are polled.
+            ///         This is safe to call from any thread.
+            ///
+            void inject_maximize(void) const;
+
+            ///
+            /// @brief  Injects a change of input focus as if the user switched windows. The
+            ///         window's focus changes when it is delivered the next time events are polled.
+            ///         This is safe to call from any thread.
+            ///
+            /// @param  has_focus   true if the window gains focus, false if it loses focus
+            ///
+            void inject_focus(bool has_focus) const;
+    };
+}
+
+#endif
@@ -0,0 +1,139 @@
+///
+/// @file       headless_window_event_manager.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a class that manages the synthetic events of a headless window
+///             and notifies subscribed handlers. Resize and move events are coalesced per poll
+///             cycle the same way as for SDL windows.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include "headless_window_event_manager.hpp"
+#include "headless_window.hpp"
+
+namespace leaf
+{
+    headless_window_event_manager::headless_window_event_manager(headless_window *window) noexcept
+        // Store the pointer to the window whose events are managed. Initially nothing is pending
+        // and no events have been coalesced.
+        : m_window(window), m_has_pending_resize(false), m_has_pending_move(false),
+        m_coalesced_event_count(0), m_pending_resize_time_ns(0), m_pending_move_time_ns(0) {}
+
+    bool headless_window_event_manager::handle_event(const headless_event_t &event) noexcept
+    {
+        // Remember whether a notification was already pending before this event.
+        bool was_pending = m_has_pending_resize || m_has_pending_move;
+
+        // Stamp the notifications made for this event with the time it was posted.
+        set_event_time(event.time_ns);
+
+        // Process the event based on its type.
+        switch (event.type)
+        {
+            // If the window is user-closable set the close flag, then notify the handlers.
+            case headless_event_type::close_requested:
+
+                if (m_window->is_user_closable())
+                {
+                    m_window->close();
+                }
+
+                user_requested_close();
+
+                break;
+
+            // Fold the resize into a pending one or mark one as pending.
+            case headless_event_type::resized:
+
+                if (m_has_pending_resize)
+                {
+                    m_coalesced_event_count++;
+                }
+
+                m_has_pending_resize = true;
+                m_pending_resize_time_ns = event.time_ns;
+
+                break;
+
+            // Fold the move into a pending one or mark one as pending.
+            case headless_event_type::moved:
+
+                if (m_has_pending_move)
+                {
+                    m_coalesced_event_count++;
+                }
+
+                m_has_pending_move = true;
+                m_pending_move_time_ns = event.time_ns;
+
+                break;
+
+            case headless_event_type::shown:
+                shown();
+                break;
+
+            case headless_event_type::hidden:
+                hidden();
+                break;
+
+            case headless_event_type::minimized:
+                minimized();
+                break;
+
+            case headless_event_type::maximized:
+                maximized();
+                break;
+
+            // Focus changes only affect the window's state, handlers are not notified.
+            default:
+                break;
+        }
+
+        // Notifications made outside of event handling have no known time.
+        set_event_time(0);
+
+        // Return whether this event is the first of the poll cycle to leave a notification pending.
+        return !was_pending && (m_has_pending_resize || m_has_pending_move);
+    }
+
+    void headless_window_event_manager::flush_deferred_events(void) noexcept
+    {
+        // Take the pending flags and clear them before notifying handlers, so that any events
+        // handled during the notifications are deferred to the next flush.
+        bool has_pending_resize = m_has_pending_resize;
+        bool has_pending_move = m_has_pending_move;
+
+        m_has_pending_resize = false;
+        m_has_pending_move = false;
+
+        // Notify the handlers with the final state of the window, stamped with the time of the
+        // last event that produced it.
+        if (has_pending_resize)
+        {
+            set_event_time(m_pending_resize_time_ns);
+            resized(m_window->bounds());
+        }
+
+        if (has_pending_move)
+        {
+            set_event_time(m_pending_move_time_ns);
+            moved(m_window->pos(), m_window->frame_pos());
+        }
+
+        set_event_time(0);
+    }
+
+    void headless_window_event_manager::notify_closed(void) noexcept
+    {
+        // Notify the handlers of the close.
+        closed();
+    }
+
+    size_t headless_window_event_manager::coalesced_event_count(void) const noexcept
+    {
+        // Return the counter of coalesced events.
+        return m_coalesced_event_count;
+    }
+}
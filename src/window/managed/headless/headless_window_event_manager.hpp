@@ -0,0 +1,113 @@
+///
+/// @file       headless_window_event_manager.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a class that manages the synthetic events of a headless window and
+///             notifies subscribed handlers. Resize and move events are coalesced per poll cycle
+///             the same way as for SDL windows.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_HEADLESS_WINDOW_EVENT_MANAGER_HEADER_GUARD
+#define LEAF_SRC_HEADLESS_WINDOW_EVENT_MANAGER_HEADER_GUARD
+
+// The class must be forward declared because there are circular includes between the headless
+// window and headless window event manager classes.
+namespace leaf
+{
+    class headless_window;
+}
+
+#include "../../window_event_manager.hpp"
+#include "headless_event_types.hpp"
+
+namespace leaf
+{
+    ///
+    /// @brief  Manages the synthetic events of a headless window and notifies subscribed handlers.
+    ///         Resize and move events are coalesced per poll cycle the same way as for SDL windows.
+    ///
+    class headless_window_event_manager : public window_event_manager
+    {
+        // The headless window must be able to access hidden functionality of its event manager.
+        friend class headless_window;
+
+        private:
+            ///
+            /// @brief  A pointer to the window whose events are managed.
+            ///
+            headless_window *const m_window;
+
+            ///
+            /// @brief  Denotes whether a resize occured during the current poll cycle that handlers
+            ///         have not yet been notified of.
+            ///
+            bool m_has_pending_resize;
+
+            ///
+            /// @brief  Denotes whether a move occured during the current poll cycle that handlers
+            ///         have not yet been notified of.
+            ///
+            bool m_has_pending_move;
+
+            ///
+            /// @brief  The number of resize and move events folded into an already pending
+            ///         notification.
+            ///
+            size_t m_coalesced_event_count;
+
+            ///
+            /// @brief  The time in nanoseconds of the last resize event folded into the pending
+            ///         resize.
+            ///
+            uint64_t m_pending_resize_time_ns;
+
+            ///
+            /// @brief  The time in nanoseconds of the last move event folded into the pending move.
+            ///
+            uint64_t m_pending_move_time_ns;
+
+            ///
+            /// @brief  Creates an event manager for a headless window.
+            ///
+            /// @param  window  a pointer to the window whose events are managed
+            ///
+            headless_window_event_manager(headless_window *window) noexcept;
+
+            ///
+            /// @brief  Handles a synthetic event addressed to the window and notifies the proper
+            ///         handlers. Resize and move events are deferred until the end of the poll
+            ///         cycle. Notifications are stamped with the time the event was posted.
+            ///
+            /// @param  event   the synthetic event
+            ///
+            /// @return true if and only if the event left a notification pending and none was
+            ///         pending before
+            ///
+            bool handle_event(const headless_event_t &event) noexcept;
+
+            ///
+            /// @brief  Notifies handlers of the resize and move deferred during the current poll
+            ///         cycle.
+            ///
+            void flush_deferred_events(void) noexcept;
+
+            ///
+            /// @brief  Notifies handlers that the window was closed.
+            ///
+            void notify_closed(void) noexcept;
+
+        public:
+            ///
+            /// @brief  Determines the number of resize and move events that were folded into an
+            ///         already pending notification.
+            ///
+            /// @return the number of coalesced events
+            ///
+            size_t coalesced_event_count(void) const noexcept;
+    };
+}
+
+#endif
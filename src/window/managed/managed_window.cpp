@@ -17,8 +17,61 @@ using namespace std;
 
 namespace leaf
 {
-    // The window is alive upon construction. By default, it is closable by the user.
-    managed_window::managed_window(void) noexcept : m_is_alive(true), m_is_user_closable(true) {}
+    // The window is alive upon construction. By default, it is closable by the user. It is not
+    // registered with a window manager until its implementation registers it. No batched update is
+    // in progress.
+    managed_window::managed_window(void) noexcept
+        : m_is_alive(true), m_is_user_closable(true), m_manager(NULL), m_update_depth(0) {}
+
+    bool managed_window::flag_as_closed(void) noexcept
+    {
+        // If the window is already closed, return false.
+        if (!m_is_alive)
+        {
+            return false;
+        }
+
+        // Set the flag to true indicating that the window is closed.
+        m_is_alive = false;
+
+        // Inform the window manager so that its living window count stays accurate.
+        if (m_manager)
+        {
+            m_manager->window_closed();
+        }
+
+        // Return true indicating that the flag was set successfully.
+        return true;
+    }
+
+    managed_window *managed_window::begin_update(void) noexcept
+    {
+        // Increment the depth so nested updates are only applied by the outermost commit.
+        m_update_depth++;
+
+        // Return a pointer to the window for chaining.
+        return this;
+    }
+
+    managed_window *managed_window::commit_update(void)
+    {
+        // If no update is in progress, do nothing.
+        if (m_update_depth == 0)
+        {
+            return this;
+        }
+
+        // Decrement the depth and apply the recorded changes if this ends the outermost update.
+        // The depth is decremented first so that setters called while applying take effect
+        // immediately.
+        if (--m_update_depth == 0)
+        {
+            apply_update();
+        }
+
+        // Return a pointer to the window for chaining.
+        return this;
+    }
 
     bool managed_window::is_alive(void) const noexcept
     {
@@ -21,6 +21,7 @@ namespace leaf
 }
 
 #include "../../utils/unique.hpp"
+#include "../../utils/slot_map.hpp"
 #include "../../graphics/surface/native_surface_i.hpp"
 #include "../nonatomic_window_i.hpp"
 #include "window_manager.hpp"
@@ -49,6 +50,23 @@ namespace leaf
             ///
             bool m_is_user_closable;
 
+            /// 
+            /// @brief  A pointer to the window manager the window is registered with or null if it
+            ///         is not registered.
+            /// 
+            window_manager *m_manager;
+
+            /// 
+            /// @brief  The handle identifying the window within its window manager's registry. It
+            ///         is null if the window is not registered.
+            /// 
+            utl::slot_handle_t m_handle;
+
+            /// 
+            /// @brief  The number of batched updates that have begun but not yet been committed.
+            /// 
+            uint32_t m_update_depth;
+
         protected:
             /// 
             /// @brief  Creates a managed window. The title, position, and size are set to default
@@ -82,20 +100,7 @@ namespace leaf
             /// 
             /// @return true if and only if the window was not already flagged as closed
             ///
-            inline bool flag_as_closed(void) noexcept
-            {
-                // If the window is already closed, return false.
-                if (!m_is_alive)
-                {
-                    return false;
-                }
-
-                // Set the flag to true indicating that the window is closed.
-                m_is_alive = false;
-
-                // Return true indicating that the flag was set successfully.
-                return true;
-            }
+            bool flag_as_closed(void) noexcept;
 
             /// 
             /// @brief  Determines whether the window should close the next time events are polled.
@@ -131,7 +136,40 @@ namespace leaf
             ///
             virtual bool poll_events(void) override = 0;
 
+            /// 
+            /// @brief  Determines whether a batched update is in progress. While it is, setters
+            ///         should record their changes rather than applying them.
+            /// 
+            /// @return true if and only if a batched update has begun and not yet been committed
+            /// 
+            inline bool is_updating(void) const noexcept
+            {
+                // An update is in progress while any begin is uncommitted.
+                return m_update_depth > 0;
+            }
+
+            /// 
+            /// @brief  Applies every change recorded since the outermost batched update began. This
+            ///         is called once when the outermost update is committed.
+            /// 
+            /// @throw  exception if an error occurs applying the changes
+            /// 
+            virtual void apply_update(void) = 0;
+
         public:
+            /// 
+            /// @brief  Returns the handle identifying the window within its window manager's
+            ///         registry. The handle can be resolved through the window manager and stops
+            ///         resolving once the window is unregistered.
+            /// 
+            /// @return the handle of the window or a null handle if it is not registered
+            /// 
+            inline utl::slot_handle_t handle(void) const noexcept
+            {
+                // Return the registry handle.
+                return m_handle;
+            }
+
             /// 
             /// @brief  Determines the bounds of the window's display surface in pixel measurements.
             ///         Note that the surface is only the inner content area of the window, not the
@@ -272,6 +310,30 @@ namespace leaf
             ///
             virtual managed_window *set_pos(px_t x, px_t y) override = 0;
 
+            /// 
+            /// @brief  Begins a batched update. Until the matching commit, changes made through
+            ///         setters are recorded rather than applied, and are then applied together in
+            ///         as few native calls as possible. Batched updates may be nested, only the
+            ///         outermost commit applies the changes.
+            /// 
+            /// @return a pointer to the window for chaining
+            /// 
+            managed_window *begin_update(void) noexcept;
+
+            /// 
+            /// @brief  Commits a batched update. If this ends the outermost update, every recorded
+            ///         change is applied. If no update is in progress, nothing happens.
+            /// 
+            /// @note   Applying the changes together does not guarantee a single resize or move
+            ///         notification. Events are coalesced per poll cycle, so handlers are notified
+            ///         once for each poll cycle in which the native window reports the changes.
+            /// 
+            /// @return a pointer to the window for chaining
+            /// 
+            /// @throw  exception if an error occurs applying the changes
+            /// 
+            managed_window *commit_update(void);
+
             /// 
             /// @brief  Determines whether the window is alive (as opposed to being closed).
             /// 
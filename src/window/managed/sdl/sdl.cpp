@@ -12,6 +12,7 @@
 
 #include <SDL3/SDL.h>
 #include "sdl.hpp"
+#include "../../../utils/trace.hpp"
 
 using namespace std;
 
@@ -21,9 +22,21 @@ namespace leaf
     sdl sdl::instance;
 
     sdl::sdl(void)
+        // Events are not recorded until a recorder is created.
+        : m_recorder(NULL)
     {
-        // Initialize SDL with no flags.
-        SDL_Init(0);
+        // Initialize SDL with only its event subsystem, so that events can be pushed (e.g. by a
+        // wake) before the first window initializes the video subsystem.
+        SDL_Init(SDL_INIT_EVENTS);
+
+        // Register an event type for waking a waiting thread. If no event type could be
+        // registered, which SDL reports as 0, fall back to the generic user event type.
+        m_wake_event_type = SDL_RegisterEvents(1);
+
+        if (!m_wake_event_type)
+        {
+            m_wake_event_type = SDL_EVENT_USER;
+        }
     }
     
     sdl::~sdl() noexcept
@@ -35,30 +48,116 @@ namespace leaf
         SDL_Quit();
     }
 
-    void sdl::handle_event_on_subject_window(const SDL_Event &event) const noexcept
+    bool sdl::register_sdl_window(sdl_window *window)
     {
-        // Check each window to determine if it matches the ID of the event.
-        for (managed_window *window : windows())
+        // Register the window with the generic window manager first. This also ensures that the
+        // pointer is not null. If the window was already being managed, there is nothing to index.
+        if (!register_window(window))
         {
-            // Cast the managed window pointer to an SDL window pointer. Compare the window's ID to
-            // the ID of the event. It is assumed that despite variation in SDL event types, the
-            // 'windowID' field of the 'window' structure will always be populated with the correct
-            // ID.
-            if (((sdl_window *)window)->id() == event.window.windowID)
+            return false;
+        }
+
+        // Get the SDL 4-byte internal ID of the window.
+        uint32_t id = window->id();
+
+        // Grow the index so that the ID is addressable. New slots are filled with null pointers
+        // since they do not correspond to managed windows.
+        if (id >= m_windows_by_id.size())
+        {
+            m_windows_by_id.resize(id + 1, NULL);
+        }
+
+        // Store the window in the slot for its ID.
+        m_windows_by_id[id] = window;
+
+        // Return true indicating that the window is now being managed.
+        return true;
+    }
+
+    bool sdl::unregister_sdl_window(sdl_window *window)
+    {
+        // Unregister the window with the generic window manager first. This also ensures that the
+        // pointer is not null. If the window was not being managed, it was never indexed.
+        if (!unregister_window(window))
+        {
+            return false;
+        }
+
+        // Clear the slot for the window's ID.
+        m_windows_by_id[window->id()] = NULL;
+
+        // If the window has deferred events, forget it so that they are not flushed.
+        for (sdl_window *&deferring_window : m_windows_with_deferred_events)
+        {
+            if (deferring_window == window)
             {
-                // Cast the managed window pointer to an SDL window pointer and instruct it to
-                // handle the SDL event.
-                ((sdl_window *)window)->handle_sdl_event(event);
+                deferring_window = NULL;
+            }
+        }
 
-                // Return false since it is assumed no other windows hold input focus so there is no
-                // need to keep looking.
-                return;
+        // Trim trailing empty slots so that the index does not keep growing as windows with
+        // increasing IDs are created and destroyed.
+        while (!m_windows_by_id.empty() && !m_windows_by_id.back())
+        {
+            m_windows_by_id.pop_back();
+        }
+
+        // Return true indicating that the window is no longer being managed.
+        return true;
+    }
+
+    sdl_window *sdl::window_from_id(uint32_t id) const noexcept
+    {
+        // IDs beyond the end of the index have never been registered. This also covers events
+        // that are not associated with any window.
+        if (id >= m_windows_by_id.size())
+        {
+            return NULL;
+        }
+
+        // Return the window in the slot for the ID. This is null if the ID is not registered.
+        return m_windows_by_id[id];
+    }
+
+    void sdl::flush_deferred_events(void) noexcept
+    {
+        // Notify the handlers of each window with deferred events. The list is walked by index
+        // since a handler may destroy a window, which nulls its entry.
+        for (size_t i = 0; i < m_windows_with_deferred_events.size(); i++)
+        {
+            if (m_windows_with_deferred_events[i])
+            {
+                m_windows_with_deferred_events[i]->flush_deferred_events();
             }
         }
+
+        // Start the next poll cycle with no windows deferring events.
+        m_windows_with_deferred_events.clear();
+    }
+
+    void sdl::handle_event_on_subject_window(const SDL_Event &event) noexcept
+    {
+        // Look up the window whose ID matches the ID of the event. It is assumed that despite
+        // variation in SDL event types, the 'windowID' field of the 'window' structure will always
+        // be populated with the correct ID (or an ID that is not registered).
+        sdl_window *window = window_from_id(event.window.windowID);
+
+        // If a managed window is the subject of the event, instruct it to handle the SDL event. If
+        // the window deferred its first event of the poll cycle, remember to flush it.
+        if (window && window->handle_sdl_event(event))
+        {
+            m_windows_with_deferred_events.push_back(window);
+        }
     }
 
     bool sdl::poll_events(void) noexcept
     {
+        LEAF_TRACE_ZONE("sdl::poll_events");
+
+        // Execute a frame that is already available, if any, without waiting. This does nothing if
+        // no frame hook is set.
+        run_frame_hook(0);
+
         // Create an event variable to hold SDL events that occur.
         SDL_Event event;
 
@@ -66,10 +165,25 @@ namespace leaf
         // been read.
         while (SDL_PollEvent(&event))
         {
+            // Record the event before it is handled, if events are being recorded.
+            if (m_recorder)
+            {
+                m_recorder->record_event(event);
+            }
+
             // Instruct the relevant currently-focussed window to handle the event.
             handle_event_on_subject_window(event);
         }
 
+        // Notify handlers of the events that were coalesced during this poll cycle.
+        flush_deferred_events();
+
+        // Record the end of the poll cycle so that a replay coalesces events the same way.
+        if (m_recorder)
+        {
+            m_recorder->record_cycle_end();
+        }
+
         // Poll all managed windows. If the number of living windows is not zero, store this in a
         // boolean flag as true indicating that there are still living windows.
         bool has_living_windows = poll_windows();
@@ -77,4 +191,86 @@ namespace leaf
         // Return the flag indicating whether there are living windows.
         return has_living_windows;
     }
+
+    bool sdl::replay_poll_cycle(const vector<SDL_Event> &events)
+    {
+        LEAF_TRACE_ZONE("sdl::replay_poll_cycle");
+
+        // Execute a frame that is already available, if any, as polling does.
+        run_frame_hook(0);
+
+        // Instruct the subject window of each event to handle it.
+        for (const SDL_Event &event : events)
+        {
+            handle_event_on_subject_window(event);
+        }
+
+        // Notify handlers of the events that were coalesced during this poll cycle.
+        flush_deferred_events();
+
+        // Poll all managed windows and return whether there are still living windows.
+        return poll_windows();
+    }
+
+    bool sdl::wait_events(int32_t timeout_ms) noexcept
+    {
+        // Poll the managed windows first so that windows flagged to close since the last update
+        // are destroyed without waiting for an SDL event. If no living windows remain, there is
+        // nothing to wait for.
+        if (!poll_windows())
+        {
+            return false;
+        }
+
+        // If a frame hook is set, this thread must keep executing the frames it provides (e.g.
+        // those a renderer's API thread submits). Wait for the next frame instead of for an SDL
+        // event, bounded so that window events are still handled promptly while a frame takes
+        // long to build. The frame wait cannot be interrupted, so a wake is only handled once it
+        // ends.
+        if (has_frame_hook())
+        {
+            if (timeout_ms == LEAF_WINDOW_MANAGER_WAIT_FOREVER
+                || timeout_ms > LEAF_WINDOW_MANAGER_FRAME_WAIT_MS)
+            {
+                timeout_ms = LEAF_WINDOW_MANAGER_FRAME_WAIT_MS;
+            }
+
+            run_frame_hook(timeout_ms);
+        }
+        else
+        {
+            // Create an event variable to hold the SDL event that ends the wait.
+            SDL_Event event;
+
+            // Sleep until an SDL event occurs or the timeout elapses. If an event occured, instruct
+            // the relevant window to handle it. Wake events have no subject window and are
+            // ignored.
+            if (SDL_WaitEventTimeout(&event, timeout_ms))
+            {
+                // The event belongs to the poll cycle that follows, so it is recorded as part of
+                // it.
+                if (m_recorder)
+                {
+                    m_recorder->record_event(event);
+                }
+
+                handle_event_on_subject_window(event);
+            }
+        }
+
+        // Handle any further events that queued up and poll the managed windows.
+        return poll_events();
+    }
+
+    bool sdl::wake(void) noexcept
+    {
+        // Create a wake event that is not associated with any window.
+        SDL_Event event;
+        SDL_memset(&event, 0, sizeof(event));
+        event.type = m_wake_event_type;
+
+        // Push the event onto the SDL event queue. This is safe from any thread. SDL reports 1 if
+        // the event was queued, 0 if it was filtered out, and a negative value if it failed.
+        return SDL_PushEvent(&event) > 0;
+    }
 }
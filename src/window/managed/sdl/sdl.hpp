@@ -20,11 +20,12 @@ namespace leaf
     class sdl;
 }
 
-#include <set>
+#include <vector>
 #include <SDL3/SDL.h>
 #include <bx/platform.h>
 #include "../../../utils/release_types.hpp"
 #include "../window_manager.hpp"
+#include "sdl_event_recorder.hpp"
 #include "sdl_window.hpp"
 
 namespace leaf
@@ -38,6 +39,11 @@ namespace leaf
         // SDL windows must be able to access hidden functionality of the SDL window manager.
         friend class sdl_window;
 
+        // SDL event recorders and replayers must be able to access the event routing of the SDL
+        // window manager.
+        friend class sdl_event_recorder;
+        friend class sdl_event_replayer;
+
         public:
             /// 
             /// @brief  One single instance of the SDL window manager will be created. This
@@ -45,6 +51,53 @@ namespace leaf
             /// 
             static sdl instance;
 
+        private:
+            /// 
+            /// @brief  Maps internal SDL window IDs to the managed SDL windows that own them. The
+            ///         vector is indexed directly by ID (SDL assigns IDs sequentially starting from
+            ///         1) so that an event can be routed to its subject window in constant time.
+            ///         Slots for IDs that are not registered hold null pointers.
+            /// 
+            std::vector<sdl_window *> m_windows_by_id;
+
+            /// 
+            /// @brief  The SDL event type registered for waking a thread that is waiting for
+            ///         events.
+            /// 
+            uint32_t m_wake_event_type;
+
+            /// 
+            /// @brief  The SDL windows with events deferred during the current poll cycle. Each
+            ///         window appears at most once. Entries of windows unregistered during the
+            ///         cycle are set to null.
+            /// 
+            std::vector<sdl_window *> m_windows_with_deferred_events;
+
+            /// 
+            /// @brief  The recorder that events read from the SDL event queue are written to, or
+            ///         null if events are not being recorded.
+            /// 
+            sdl_event_recorder *m_recorder;
+
+            /// 
+            /// @brief  Notifies the event handlers of every window with deferred events and clears
+            ///         the list of such windows. This ends a poll cycle.
+            /// 
+            void flush_deferred_events(void) noexcept;
+
+            /// 
+            /// @brief  Performs a poll cycle with the given events in place of the events on the
+            ///         SDL event queue. The events are routed and handled exactly as polled events
+            ///         are, but they are not recorded.
+            /// 
+            /// @param  events  the events of the poll cycle in order
+            /// 
+            /// @return true if and only if at least one living window is under management
+            /// 
+            /// @throw  exception if any window failed to poll events
+            /// 
+            bool replay_poll_cycle(const std::vector<SDL_Event> &events);
+
         protected:
             /// 
             /// @brief  Creates a new instance of the SDL library and initializes SDL. Only one SDL
@@ -61,23 +114,89 @@ namespace leaf
             virtual ~sdl() noexcept;
 
             /// 
-            /// @brief  Determines which window has input focus (if any) and instructs the window to
-            ///         handle the SDL event that occured.
+            /// @brief  Adds the given SDL window to the set of managed windows and indexes it by its
+            ///         internal SDL ID.
+            /// 
+            /// @param  window  a pointer to the SDL window to start managing
+            /// 
+            /// @return true if and only if the window was not already being managed
+            /// 
+            /// @throw  runtime exception if the given window pointer is null
+            /// 
+            bool register_sdl_window(sdl_window *window);
+
+            /// 
+            /// @brief  Removes the given SDL window from the set of managed windows and from the
+            ///         ID index.
+            /// 
+            /// @param  window  a pointer to the SDL window to stop managing
+            /// 
+            /// @return true if and only if the window was being managed
+            /// 
+            /// @throw  runtime exception if the given window pointer is null
+            /// 
+            bool unregister_sdl_window(sdl_window *window);
+
+            /// 
+            /// @brief  Finds the managed SDL window with the given internal SDL ID in constant
+            ///         time.
+            /// 
+            /// @param  id  the 4-byte internal SDL ID of the window
+            /// 
+            /// @return a pointer to the window or null if no managed window has the given ID
+            /// 
+            sdl_window *window_from_id(uint32_t id) const noexcept;
+
+            /// 
+            /// @brief  Determines which window is the subject of the SDL event (if any) and
+            ///         instructs the window to handle the SDL event that occured. If the window
+            ///         defers the event, it is remembered so that it is flushed at the end of the
+            ///         poll cycle.
             /// 
             /// @param  event   an SDL event that has just occured
             /// 
-            void handle_event_on_subject_window(const SDL_Event &event) const noexcept;
+            void handle_event_on_subject_window(const SDL_Event &event) noexcept;
 
         public:
             /// 
             /// @brief  Performs updates on the SDL window manager. This will poll the events of
             ///         each individual living managed window as well as perform any necessary SDL
-            ///         calls.
+            ///         calls. If a frame hook is set, a frame that is already available is
+            ///         executed first without waiting. If an SDL event recorder exists, every event
+            ///         and the end of the poll cycle are recorded.
             /// 
             /// @return true if and only if at least one living window is under management
             /// 
             virtual bool poll_events(void) noexcept override;
 
+            /// 
+            /// @brief  Waits until at least one SDL event occurs, the timeout elapses, or the SDL
+            ///         window manager is woken, then performs the same updates as polling events.
+            ///         The calling thread sleeps while no events occur. If a frame hook is set, the
+            ///         thread instead waits for the next frame through it and executes it, so the
+            ///         wait ends after at most LEAF_WINDOW_MANAGER_FRAME_WAIT_MS milliseconds.
+            ///
+            /// @note   While a frame hook is set, waking does not interrupt the wait for the next
+            ///         frame. The wake is handled once that wait ends, which takes at most
+            ///         LEAF_WINDOW_MANAGER_FRAME_WAIT_MS milliseconds.
+            /// 
+            /// @param  timeout_ms  the maximum number of milliseconds to wait or
+            ///                     LEAF_WINDOW_MANAGER_WAIT_FOREVER to wait without a timeout
+            /// 
+            /// @return true if and only if at least one living window is under management
+            /// 
+            virtual bool wait_events(int32_t timeout_ms) noexcept override;
+
+            /// 
+            /// @brief  Wakes a thread that is waiting for SDL events by pushing a wake event onto
+            ///         the SDL event queue. This may be called from any thread. While a frame hook
+            ///         is set, the waiting thread returns once its wait for the next frame ends
+            ///         (see wait_events).
+            /// 
+            /// @return true if and only if SDL queued the wake event
+            /// 
+            virtual bool wake(void) noexcept override;
+
             /// 
             /// @brief  Determines the version of SDL being used.
             /// 
@@ -0,0 +1,269 @@
+///
+/// @file       sdl_event_record_format.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for the binary format SDL event recordings are stored in. It is shared by the
+///             recorder that writes recordings and the replayer that reads them.
+///
+///             A recording starts with the 4-byte magic "LFEV" and a 1-byte format version. It is
+///             followed by records, each of which starts with a 1-byte tag and the signed
+///             difference in nanoseconds between its timestamp and that of the previous record.
+///             Window events store their type, window ID, and data fields. Other events store their
+///             raw bytes with pointers cleared and trailing zero bytes trimmed, followed by the
+///             text each of their text fields points to as its length plus 1 (0 for null) and its
+///             bytes. Text held in arrays within an event (e.g. by text input events) is part of its
+///             bytes. Pointers that are not text (e.g. the data of user events) are not recorded.
+///             Poll cycle ends store nothing else.
+///             Integers are stored as variable-length quantities (7 bits per byte, low bits
+///             first), and signed integers are zigzag encoded first so that small negative values
+///             stay short.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_SDL_EVENT_RECORD_FORMAT_HEADER_GUARD
+#define LEAF_SRC_SDL_EVENT_RECORD_FORMAT_HEADER_GUARD
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <SDL3/SDL_events.h>
+
+///
+/// @brief  The bytes every SDL event recording starts with.
+///
+#define LEAF_SDL_EVENT_RECORD_MAGIC "LFEV"
+
+///
+/// @brief  The number of bytes in the magic of an SDL event recording.
+///
+#define LEAF_SDL_EVENT_RECORD_MAGIC_SIZE 4
+
+///
+/// @brief  The most text fields any SDL event has.
+///
+#define LEAF_SDL_EVENT_RECORD_MAX_TEXTS 1
+
+///
+/// @brief  The version of the SDL event recording format written by the recorder. The replayer
+///         rejects recordings of any other version.
+///
+#define LEAF_SDL_EVENT_RECORD_VERSION 2
+
+namespace leaf
+{
+    ///
+    /// @brief  The kinds of records an SDL event recording is made of.
+    ///
+    enum class sdl_event_record_tag : uint8_t
+    {
+        window_event,
+        raw_event,
+        cycle_end
+    };
+
+    ///
+    /// @brief  Finds the window ID field of an SDL event, so that a replay can route the event to
+    ///         the window the recorded ID is mapped to.
+    ///
+    /// @param  event   the SDL event
+    ///
+    /// @return a pointer to the window ID field or null if the event has none
+    ///
+    inline Uint32 *sdl_event_window_id(SDL_Event &event) noexcept
+    {
+        // Window events are a range of their own.
+        if (event.type >= SDL_EVENT_WINDOW_FIRST && event.type <= SDL_EVENT_WINDOW_LAST)
+        {
+            return &event.window.windowID;
+        }
+
+        // User events are a range of their own as well.
+        if (event.type >= SDL_EVENT_USER && event.type <= SDL_EVENT_LAST)
+        {
+            return &event.user.windowID;
+        }
+
+        switch (event.type)
+        {
+            case SDL_EVENT_KEY_DOWN:
+            case SDL_EVENT_KEY_UP:
+                return &event.key.windowID;
+
+            case SDL_EVENT_TEXT_EDITING:
+                return &event.edit.windowID;
+
+            case SDL_EVENT_TEXT_EDITING_EXT:
+                return &event.editExt.windowID;
+
+            case SDL_EVENT_TEXT_INPUT:
+                return &event.text.windowID;
+
+            case SDL_EVENT_MOUSE_MOTION:
+                return &event.motion.windowID;
+
+            case SDL_EVENT_MOUSE_BUTTON_DOWN:
+            case SDL_EVENT_MOUSE_BUTTON_UP:
+                return &event.button.windowID;
+
+            case SDL_EVENT_MOUSE_WHEEL:
+                return &event.wheel.windowID;
+
+            case SDL_EVENT_FINGER_DOWN:
+            case SDL_EVENT_FINGER_UP:
+            case SDL_EVENT_FINGER_MOTION:
+                return &event.tfinger.windowID;
+
+            case SDL_EVENT_DROP_FILE:
+            case SDL_EVENT_DROP_TEXT:
+            case SDL_EVENT_DROP_BEGIN:
+            case SDL_EVENT_DROP_COMPLETE:
+                return &event.drop.windowID;
+
+            default:
+                return NULL;
+        }
+    }
+
+    ///
+    /// @brief  Finds the text fields of an SDL event that point to their text, which a recording
+    ///         stores the text of since the pointers are meaningless once replayed.
+    ///
+    /// @param  event   the SDL event
+    /// @param  fields  filled with pointers to the text fields
+    ///
+    /// @return the number of text fields
+    ///
+    inline size_t sdl_event_texts(SDL_Event &event, char **fields[LEAF_SDL_EVENT_RECORD_MAX_TEXTS])
+        noexcept
+    {
+        // Text editing and text input events hold their text in arrays, which are recorded with
+        // the rest of their bytes, so only their extended and drop counterparts point to theirs.
+        switch (event.type)
+        {
+            case SDL_EVENT_TEXT_EDITING_EXT:
+                fields[0] = &event.editExt.text;
+                return 1;
+
+            case SDL_EVENT_DROP_FILE:
+            case SDL_EVENT_DROP_TEXT:
+            case SDL_EVENT_DROP_BEGIN:
+            case SDL_EVENT_DROP_COMPLETE:
+                fields[0] = &event.drop.file;
+                return 1;
+
+            default:
+                return 0;
+        }
+    }
+
+    ///
+    /// @brief  Clears the pointers of an SDL event that are not text, which a recording cannot
+    ///         store since it does not know what they point to.
+    ///
+    /// @param  event   the SDL event
+    ///
+    inline void clear_sdl_event_data_pointers(SDL_Event &event) noexcept
+    {
+        // User events carry two pointers of their own.
+        if (event.type >= SDL_EVENT_USER && event.type <= SDL_EVENT_LAST)
+        {
+            event.user.data1 = NULL;
+            event.user.data2 = NULL;
+            return;
+        }
+
+        // System window manager events point to the message of the platform.
+        if (event.type == SDL_EVENT_SYSWM)
+        {
+            event.syswm.msg = NULL;
+        }
+    }
+
+    ///
+    /// @brief  Appends an unsigned integer to the buffer as a variable-length quantity.
+    ///
+    /// @param  buffer  the buffer to append to
+    /// @param  value   the integer to append
+    ///
+    inline void write_varint(std::vector<uint8_t> &buffer, uint64_t value)
+    {
+        // Append 7 bits at a time, setting the high bit of every byte but the last.
+        while (value >= 0x80)
+        {
+            buffer.push_back((uint8_t)(value | 0x80));
+            value >>= 7;
+        }
+
+        buffer.push_back((uint8_t)value);
+    }
+
+    ///
+    /// @brief  Appends a signed integer to the buffer as a zigzag encoded variable-length quantity.
+    ///
+    /// @param  buffer  the buffer to append to
+    /// @param  value   the integer to append
+    ///
+    inline void write_signed_varint(std::vector<uint8_t> &buffer, int64_t value)
+    {
+        // Interleave negative and positive values so that both are small when their magnitude is.
+        write_varint(buffer, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+    }
+
+    ///
+    /// @brief  Reads a variable-length quantity from the buffer.
+    ///
+    /// @param  buffer  the buffer to read from
+    /// @param  pos     the position to read at, advanced past the integer
+    /// @param  value   set to the integer that was read
+    ///
+    /// @return true if and only if a complete integer was read
+    ///
+    inline bool read_varint(const std::vector<uint8_t> &buffer, size_t &pos, uint64_t &value)
+        noexcept
+    {
+        value = 0;
+
+        // Gather 7 bits at a time until a byte without the high bit. An integer can span at most
+        // 10 bytes.
+        for (uint32_t shift = 0; shift < 64 && pos < buffer.size(); shift += 7)
+        {
+            uint8_t byte = buffer[pos++];
+            value |= (uint64_t)(byte & 0x7f) << shift;
+
+            if (!(byte & 0x80))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    ///
+    /// @brief  Reads a zigzag encoded variable-length quantity from the buffer.
+    ///
+    /// @param  buffer  the buffer to read from
+    /// @param  pos     the position to read at, advanced past the integer
+    /// @param  value   set to the integer that was read
+    ///
+    /// @return true if and only if a complete integer was read
+    ///
+    inline bool read_signed_varint(const std::vector<uint8_t> &buffer, size_t &pos, int64_t &value)
+        noexcept
+    {
+        uint64_t encoded;
+
+        if (!read_varint(buffer, pos, encoded))
+        {
+            return false;
+        }
+
+        // Undo the interleaving of negative and positive values.
+        value = (int64_t)(encoded >> 1) ^ -(int64_t)(encoded & 1);
+        return true;
+    }
+}
+
+#endif
@@ -0,0 +1,189 @@
+///
+/// @file       sdl_event_recorder.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a class that records the SDL events the SDL window manager
+///             handles to a compact binary file, so that the same workload can later be replayed.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <cstring>
+#include <stdexcept>
+#include <SDL3/SDL.h>
+#include "sdl_event_recorder.hpp"
+#include "sdl.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    sdl_event_recorder::sdl_event_recorder(const string &path)
+        // Store the path. The first record is timed relative to the moment recording starts.
+        : m_path(path), m_last_time_ns(SDL_GetTicksNS()), m_event_count(0), m_cycle_count(0)
+    {
+        // Only one recorder can receive the events of the SDL window manager.
+        if (sdl::instance.m_recorder)
+        {
+            throw runtime_error("Another SDL event recorder already exists.");
+        }
+
+        // Open the file, replacing any existing file.
+        m_file.open(path, ios::binary | ios::trunc);
+
+        if (!m_file)
+        {
+            throw runtime_error("Failed to open '" + path + "' for recording SDL events.");
+        }
+
+        // Write the magic and the format version.
+        m_file.write(LEAF_SDL_EVENT_RECORD_MAGIC, LEAF_SDL_EVENT_RECORD_MAGIC_SIZE);
+        m_file.put((char)LEAF_SDL_EVENT_RECORD_VERSION);
+
+        // Start receiving events.
+        sdl::instance.m_recorder = this;
+    }
+
+    sdl_event_recorder::~sdl_event_recorder() noexcept
+    {
+        // Stop receiving events. The file is flushed and closed when it is destroyed.
+        sdl::instance.m_recorder = NULL;
+    }
+
+    void sdl_event_recorder::begin_record(sdl_event_record_tag tag, uint64_t time_ns)
+    {
+        // Encode the tag and the time since the previous record. The difference is signed since
+        // an event can have occured before the previous poll cycle ended.
+        m_buffer.push_back((uint8_t)tag);
+        write_signed_varint(m_buffer, (int64_t)(time_ns - m_last_time_ns));
+
+        m_last_time_ns = time_ns;
+    }
+
+    void sdl_event_recorder::end_record(void) noexcept
+    {
+        // Write the encoded record and clear the buffer for the next one. A failed write leaves
+        // the file in a failed state, which is reported by 'failed'.
+        m_file.write((const char *)m_buffer.data(), (streamsize)m_buffer.size());
+        m_buffer.clear();
+    }
+
+    void sdl_event_recorder::record_event(const SDL_Event &event) noexcept
+    {
+        try
+        {
+            // Window events are stored field by field since they make up most of the stream and
+            // their fields are small.
+            if (event.type >= SDL_EVENT_WINDOW_FIRST && event.type <= SDL_EVENT_WINDOW_LAST)
+            {
+                begin_record(sdl_event_record_tag::window_event, event.common.timestamp);
+                write_varint(m_buffer, event.type);
+                write_varint(m_buffer, event.window.windowID);
+                write_signed_varint(m_buffer, event.window.data1);
+                write_signed_varint(m_buffer, event.window.data2);
+            }
+            else
+            {
+                // Copy the event and clear its timestamp, which is stored in the record header.
+                SDL_Event copy = event;
+                copy.common.timestamp = 0;
+
+                // Take the text out of the copy, since it is stored after the bytes, and clear any
+                // other pointers, which would dangle when replayed.
+                char **fields[LEAF_SDL_EVENT_RECORD_MAX_TEXTS];
+                const char *texts[LEAF_SDL_EVENT_RECORD_MAX_TEXTS];
+                size_t text_count = sdl_event_texts(copy, fields);
+
+                for (size_t i = 0; i < text_count; i++)
+                {
+                    texts[i] = *fields[i];
+                    *fields[i] = NULL;
+                }
+
+                clear_sdl_event_data_pointers(copy);
+
+                // Trim trailing zero bytes, which most events have plenty of since the event union
+                // is far larger than most of its members.
+                const uint8_t *bytes = (const uint8_t *)&copy;
+                size_t size = sizeof(copy);
+
+                while (size > 0 && !bytes[size - 1])
+                {
+                    size--;
+                }
+
+                begin_record(sdl_event_record_tag::raw_event, event.common.timestamp);
+                write_varint(m_buffer, size);
+                m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+
+                // Store each text as its length plus 1, so that 0 stands for a null pointer.
+                for (size_t i = 0; i < text_count; i++)
+                {
+                    if (!texts[i])
+                    {
+                        write_varint(m_buffer, 0);
+                        continue;
+                    }
+
+                    size_t length = strlen(texts[i]);
+                    write_varint(m_buffer, length + 1);
+                    m_buffer.insert(m_buffer.end(), texts[i], texts[i] + length);
+                }
+            }
+        }
+        catch (const exception &)
+        {
+            // Encoding can only fail if the buffer could not grow. Drop the event.
+            m_buffer.clear();
+            return;
+        }
+
+        // Write the record and count the event.
+        end_record();
+        m_event_count++;
+    }
+
+    void sdl_event_recorder::record_cycle_end(void) noexcept
+    {
+        try
+        {
+            // A cycle end is timed when it is recorded.
+            begin_record(sdl_event_record_tag::cycle_end, SDL_GetTicksNS());
+        }
+        catch (const exception &)
+        {
+            // Encoding can only fail if the buffer could not grow. Drop the cycle end.
+            m_buffer.clear();
+            return;
+        }
+
+        // Write the record and count the poll cycle.
+        end_record();
+        m_cycle_count++;
+    }
+
+    const string &sdl_event_recorder::path(void) const noexcept
+    {
+        // Return the path of the recording.
+        return m_path;
+    }
+
+    size_t sdl_event_recorder::event_count(void) const noexcept
+    {
+        // Return the counter of recorded events.
+        return m_event_count;
+    }
+
+    size_t sdl_event_recorder::cycle_count(void) const noexcept
+    {
+        // Return the counter of recorded poll cycles.
+        return m_cycle_count;
+    }
+
+    bool sdl_event_recorder::failed(void) const noexcept
+    {
+        // A failed write leaves the file in a failed state.
+        return !m_file.good();
+    }
+}
@@ -0,0 +1,149 @@
+///
+/// @file       sdl_event_recorder.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a class that records the SDL events the SDL window manager handles to a
+///             compact binary file, so that the same workload can later be replayed.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_SDL_EVENT_RECORDER_HEADER_GUARD
+#define LEAF_SRC_SDL_EVENT_RECORDER_HEADER_GUARD
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <SDL3/SDL_events.h>
+#include "../../../utils/unique.hpp"
+#include "sdl_event_record_format.hpp"
+
+namespace leaf
+{
+    ///
+    /// @brief  Records the SDL events the SDL window manager handles to a compact binary file.
+    ///         While a recorder exists, every event read from the SDL event queue is written with
+    ///         its timestamp before it is routed, and the end of every poll cycle is written as
+    ///         well, so that a replay delivers the same events in the same cycles and coalesces
+    ///         them the same way. Only one recorder can exist at a time.
+    ///
+    ///         The recording is written with the format described in sdl_event_record_format.hpp
+    ///         and is complete once the recorder is destroyed.
+    ///
+    /// @note   The text of text input, text editing, and drop events is recorded along with them.
+    ///         Other pointers (e.g. the data of user events) are recorded as null.
+    ///
+    class sdl_event_recorder : public utl::unique
+    {
+        // The SDL window manager must be able to record the events it handles.
+        friend class sdl;
+
+        private:
+            ///
+            /// @brief  The path of the file the recording is written to.
+            ///
+            const std::string m_path;
+
+            ///
+            /// @brief  The file the recording is written to.
+            ///
+            std::ofstream m_file;
+
+            ///
+            /// @brief  A buffer that each record is encoded into before it is written, reused so
+            ///         that recording does not allocate once the buffer has grown.
+            ///
+            std::vector<uint8_t> m_buffer;
+
+            ///
+            /// @brief  The timestamp in nanoseconds of the previous record, which the timestamp of
+            ///         the next record is stored relative to.
+            ///
+            uint64_t m_last_time_ns;
+
+            ///
+            /// @brief  The number of events recorded.
+            ///
+            size_t m_event_count;
+
+            ///
+            /// @brief  The number of poll cycles recorded.
+            ///
+            size_t m_cycle_count;
+
+            ///
+            /// @brief  Encodes the tag and timestamp that start every record into the buffer.
+            ///
+            /// @param  tag     the kind of record
+            /// @param  time_ns the timestamp of the record in nanoseconds
+            ///
+            void begin_record(sdl_event_record_tag tag, uint64_t time_ns);
+
+            ///
+            /// @brief  Writes the record in the buffer to the file and clears the buffer.
+            ///
+            void end_record(void) noexcept;
+
+            ///
+            /// @brief  Records an SDL event read from the SDL event queue.
+            ///
+            /// @param  event   the SDL event
+            ///
+            void record_event(const SDL_Event &event) noexcept;
+
+            ///
+            /// @brief  Records the end of a poll cycle.
+            ///
+            void record_cycle_end(void) noexcept;
+
+        public:
+            ///
+            /// @brief  Creates a recorder that writes to the file at the given path and starts
+            ///         recording the events the SDL window manager handles.
+            ///
+            /// @param  path    the path of the file to write the recording to, replaced if it
+            ///                 exists
+            ///
+            /// @throw  runtime_error if the file could not be opened or if another recorder exists
+            ///
+            sdl_event_recorder(const std::string &path);
+
+            ///
+            /// @brief  Stops recording and closes the file.
+            ///
+            ~sdl_event_recorder() noexcept;
+
+            ///
+            /// @brief  Returns the path of the file the recording is written to.
+            ///
+            /// @return the path of the recording
+            ///
+            const std::string &path(void) const noexcept;
+
+            ///
+            /// @brief  Determines how many events have been recorded.
+            ///
+            /// @return the number of events recorded
+            ///
+            size_t event_count(void) const noexcept;
+
+            ///
+            /// @brief  Determines how many poll cycles have been recorded.
+            ///
+            /// @return the number of poll cycles recorded
+            ///
+            size_t cycle_count(void) const noexcept;
+
+            ///
+            /// @brief  Determines whether writing to the file has failed, in which case the
+            ///         recording is incomplete.
+            ///
+            /// @return true if and only if a write failed
+            ///
+            bool failed(void) const noexcept;
+    };
+}
+
+#endif
@@ -0,0 +1,391 @@
+///
+/// @file       sdl_event_replayer.cpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Implementation for a class that replays an SDL event recording through the SDL
+///             window manager, so that a recorded workload can be benchmarked repeatably.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include <SDL3/SDL.h>
+#include "sdl_event_replayer.hpp"
+#include "sdl_event_record_format.hpp"
+#include "sdl.hpp"
+
+using namespace std;
+
+namespace leaf
+{
+    sdl_event_replayer::sdl_event_replayer(const string &path)
+        // Replaying starts at the first poll cycle and replays every recorded event.
+        : m_next_cycle(0), m_skips_close_requests(false), m_routed_count(0)
+    {
+        // Read the whole recording into memory so that file access is not part of the replay.
+        load(path);
+    }
+
+    void sdl_event_replayer::load(const string &path)
+    {
+        // Read the whole file into a buffer.
+        ifstream file(path, ios::binary);
+
+        if (!file)
+        {
+            throw runtime_error("Failed to open '" + path + "' for replaying SDL events.");
+        }
+
+        vector<uint8_t> buffer((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+        string invalid_message = "'" + path + "' is not a valid SDL event recording.";
+
+        // Check the magic and the format version.
+        if (buffer.size() < LEAF_SDL_EVENT_RECORD_MAGIC_SIZE + 1
+            || memcmp(buffer.data(), LEAF_SDL_EVENT_RECORD_MAGIC, LEAF_SDL_EVENT_RECORD_MAGIC_SIZE)
+            || buffer[LEAF_SDL_EVENT_RECORD_MAGIC_SIZE] != LEAF_SDL_EVENT_RECORD_VERSION)
+        {
+            throw runtime_error(invalid_message);
+        }
+
+        size_t pos = LEAF_SDL_EVENT_RECORD_MAGIC_SIZE + 1;
+        int64_t time_ns = 0;
+        size_t cycle_first_event = 0;
+
+        // The text fields of events are pointed into the text once all of it has been read, since
+        // it moves while it grows. Each text is noted by its event, field, and offset until then.
+        struct text_ref
+        {
+            size_t event;
+            size_t field;
+            size_t offset;
+        };
+
+        vector<text_ref> text_refs;
+
+        // Decode records until the end of the buffer.
+        while (pos < buffer.size())
+        {
+            // Every record starts with its tag and the time since the previous record.
+            sdl_event_record_tag tag = (sdl_event_record_tag)buffer[pos++];
+            int64_t delta_ns;
+
+            if (!read_signed_varint(buffer, pos, delta_ns))
+            {
+                throw runtime_error(invalid_message);
+            }
+
+            time_ns += delta_ns;
+
+            switch (tag)
+            {
+                // A window event stores its fields.
+                case sdl_event_record_tag::window_event:
+                {
+                    uint64_t type, window_id;
+                    int64_t data1, data2;
+
+                    if (!read_varint(buffer, pos, type) || !read_varint(buffer, pos, window_id)
+                        || !read_signed_varint(buffer, pos, data1)
+                        || !read_signed_varint(buffer, pos, data2))
+                    {
+                        throw runtime_error(invalid_message);
+                    }
+
+                    SDL_Event event;
+                    SDL_memset(&event, 0, sizeof(event));
+                    event.type = (uint32_t)type;
+                    event.window.windowID = (uint32_t)window_id;
+                    event.window.data1 = (int32_t)data1;
+                    event.window.data2 = (int32_t)data2;
+
+                    m_events.push_back(event);
+                    m_event_times_ns.push_back(time_ns);
+
+                    break;
+                }
+
+                // Any other event stores its bytes without trailing zero bytes.
+                case sdl_event_record_tag::raw_event:
+                {
+                    uint64_t size;
+
+                    if (!read_varint(buffer, pos, size) || size > sizeof(SDL_Event)
+                        || size > buffer.size() - pos)
+                    {
+                        throw runtime_error(invalid_message);
+                    }
+
+                    SDL_Event event;
+                    SDL_memset(&event, 0, sizeof(event));
+                    memcpy(&event, buffer.data() + pos, size);
+                    pos += size;
+
+                    // Read the text of each text field, which follows the bytes.
+                    char **fields[LEAF_SDL_EVENT_RECORD_MAX_TEXTS];
+                    size_t text_count = sdl_event_texts(event, fields);
+
+                    for (size_t i = 0; i < text_count; i++)
+                    {
+                        uint64_t length;
+
+                        if (!read_varint(buffer, pos, length) || length > buffer.size() - pos + 1)
+                        {
+                            throw runtime_error(invalid_message);
+                        }
+
+                        // A length of 0 stands for a null pointer, otherwise it is 1 too large.
+                        *fields[i] = NULL;
+
+                        if (!length)
+                        {
+                            continue;
+                        }
+
+                        text_refs.push_back({m_events.size(), i, m_text.size()});
+                        m_text.insert(m_text.end(), buffer.begin() + pos,
+                            buffer.begin() + pos + (length - 1));
+                        m_text.push_back('\0');
+                        pos += length - 1;
+                    }
+
+                    m_events.push_back(event);
+                    m_event_times_ns.push_back(time_ns);
+
+                    break;
+                }
+
+                // A poll cycle end closes the cycle made of every event since the previous one.
+                case sdl_event_record_tag::cycle_end:
+
+                    m_cycles.push_back({time_ns, cycle_first_event,
+                        m_events.size() - cycle_first_event});
+                    cycle_first_event = m_events.size();
+
+                    break;
+
+                default:
+                    throw runtime_error(invalid_message);
+            }
+        }
+
+        // If recording stopped in the middle of a poll cycle, the events of that cycle still make
+        // up a cycle of their own.
+        if (cycle_first_event < m_events.size())
+        {
+            m_cycles.push_back({time_ns, cycle_first_event, m_events.size() - cycle_first_event});
+        }
+
+        // Point the text fields into the text, which no longer changes.
+        for (const text_ref &ref : text_refs)
+        {
+            char **fields[LEAF_SDL_EVENT_RECORD_MAX_TEXTS];
+            sdl_event_texts(m_events[ref.event], fields);
+            *fields[ref.field] = m_text.data() + ref.offset;
+        }
+
+        // Gather the window IDs the events were addressed to. An ID of 0 means no window.
+        for (SDL_Event &event : m_events)
+        {
+            Uint32 *window_id = sdl_event_window_id(event);
+
+            if (window_id && *window_id)
+            {
+                m_recorded_window_ids.push_back(*window_id);
+            }
+        }
+
+        // Reduce the window IDs to the distinct IDs.
+        sort(m_recorded_window_ids.begin(), m_recorded_window_ids.end());
+        m_recorded_window_ids.erase(std::unique(m_recorded_window_ids.begin(),
+            m_recorded_window_ids.end()), m_recorded_window_ids.end());
+    }
+
+    void sdl_event_replayer::replay_cycle(bool keep_spacing, int64_t time_offset_ns)
+    {
+        // Copy the events of the next cycle into the buffer so that they can be adjusted, leaving
+        // out close requests if they are skipped.
+        const cycle_t &cycle = m_cycles[m_next_cycle++];
+        uint64_t now_ns = SDL_GetTicksNS();
+
+        m_cycle_events.clear();
+
+        for (size_t i = 0; i < cycle.event_count; i++)
+        {
+            SDL_Event event = m_events[cycle.first_event + i];
+
+            if (m_skips_close_requests && event.type == SDL_EVENT_WINDOW_CLOSE_REQUESTED)
+            {
+                continue;
+            }
+
+            // Stamp the event with its recorded time shifted to the current clock, or with the
+            // current time if the spacing of the recording is not kept.
+            if (keep_spacing)
+            {
+                int64_t time_ns = time_offset_ns + m_event_times_ns[cycle.first_event + i];
+                event.common.timestamp = time_ns > 0 ? (uint64_t)time_ns : 0;
+            }
+            else
+            {
+                event.common.timestamp = now_ns;
+            }
+
+            // Route events to the window their recorded window ID is mapped to, if any.
+            Uint32 *window_id = sdl_event_window_id(event);
+
+            if (window_id && *window_id < m_window_ids.size() && m_window_ids[*window_id])
+            {
+                *window_id = m_window_ids[*window_id];
+            }
+
+            // Count the events that reach a managed window.
+            if (window_id && sdl::instance.window_from_id(*window_id))
+            {
+                m_routed_count++;
+            }
+
+            m_cycle_events.push_back(event);
+        }
+
+        // Hand the events to the SDL window manager as one poll cycle.
+        sdl::instance.replay_poll_cycle(m_cycle_events);
+    }
+
+    sdl_event_replayer *sdl_event_replayer::map_window(uint32_t recorded_id,
+        const sdl_window *window)
+    {
+        // Ensure the window pointer is not null.
+        if (!window)
+        {
+            throw runtime_error("Cannot map a recorded window ID to a null window.");
+        }
+
+        // Grow the map so that the recorded ID is addressable. New slots hold 0, which no window
+        // has, meaning that they are not mapped.
+        if (recorded_id >= m_window_ids.size())
+        {
+            m_window_ids.resize(recorded_id + 1, 0);
+        }
+
+        // Map the recorded ID to the current ID of the window.
+        m_window_ids[recorded_id] = window->id();
+
+        // Return a pointer to the replayer.
+        return this;
+    }
+
+    sdl_event_replayer *sdl_event_replayer::set_skips_close_requests(bool skips) noexcept
+    {
+        // Store whether close requests are skipped.
+        m_skips_close_requests = skips;
+
+        // Return a pointer to the replayer.
+        return this;
+    }
+
+    const vector<uint32_t> &sdl_event_replayer::recorded_window_ids(void) const noexcept
+    {
+        // Return the distinct recorded window IDs.
+        return m_recorded_window_ids;
+    }
+
+    size_t sdl_event_replayer::event_count(void) const noexcept
+    {
+        // Return the number of recorded events.
+        return m_events.size();
+    }
+
+    size_t sdl_event_replayer::cycle_count(void) const noexcept
+    {
+        // Return the number of recorded poll cycles.
+        return m_cycles.size();
+    }
+
+    uint64_t sdl_event_replayer::duration_ns(void) const noexcept
+    {
+        // The recording ends with its last poll cycle.
+        if (m_cycles.empty() || m_cycles.back().time_ns < 0)
+        {
+            return 0;
+        }
+
+        return (uint64_t)m_cycles.back().time_ns;
+    }
+
+    size_t sdl_event_replayer::routed_count(void) const noexcept
+    {
+        // Return the counter of routed events.
+        return m_routed_count;
+    }
+
+    bool sdl_event_replayer::is_finished(void) const noexcept
+    {
+        // Replaying is finished once the next cycle is past the last.
+        return m_next_cycle >= m_cycles.size();
+    }
+
+    bool sdl_event_replayer::step(void)
+    {
+        // If every cycle has been replayed, there is nothing to do.
+        if (is_finished())
+        {
+            return false;
+        }
+
+        // Replay the next cycle stamped with the current time.
+        replay_cycle(false, 0);
+
+        return true;
+    }
+
+    size_t sdl_event_replayer::replay(sdl_replay_speed speed)
+    {
+        bool keep_spacing = speed == sdl_replay_speed::recorded;
+
+        // Align the recording with the current time so that the next cycle is replayed after the
+        // same delay from the previous one as when it was recorded.
+        int64_t origin_ns = m_next_cycle > 0 ? m_cycles[m_next_cycle - 1].time_ns : 0;
+        int64_t time_offset_ns = (int64_t)SDL_GetTicksNS() - origin_ns;
+
+        size_t replayed_count = 0;
+
+        // Replay every remaining cycle.
+        while (!is_finished())
+        {
+            // At the recorded speed, sleep until the cycle is due.
+            if (keep_spacing)
+            {
+                int64_t wait_ns = time_offset_ns + m_cycles[m_next_cycle].time_ns
+                    - (int64_t)SDL_GetTicksNS();
+
+                if (wait_ns > 0)
+                {
+                    this_thread::sleep_for(chrono::nanoseconds(wait_ns));
+                }
+            }
+
+            replay_cycle(keep_spacing, time_offset_ns);
+            replayed_count++;
+        }
+
+        // Return the number of cycles replayed.
+        return replayed_count;
+    }
+
+    sdl_event_replayer *sdl_event_replayer::rewind(void) noexcept
+    {
+        // Start again at the first cycle with no events routed.
+        m_next_cycle = 0;
+        m_routed_count = 0;
+
+        // Return a pointer to the replayer.
+        return this;
+    }
+}
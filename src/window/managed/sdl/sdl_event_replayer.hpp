@@ -0,0 +1,269 @@
+///
+/// @file       sdl_event_replayer.hpp
+/// @author     Will Brandon (brandon.w@northeastern.edu)
+/// @date       October 16, 2026
+///
+/// @brief      Header for a class that replays an SDL event recording through the SDL window
+///             manager, so that a recorded workload can be benchmarked repeatably.
+///
+/// @copyright  Copyright (c) 2026
+///
+
+#ifndef LEAF_SRC_SDL_EVENT_REPLAYER_HEADER_GUARD
+#define LEAF_SRC_SDL_EVENT_REPLAYER_HEADER_GUARD
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <SDL3/SDL_events.h>
+#include "../../../utils/unique.hpp"
+#include "sdl_window.hpp"
+
+namespace leaf
+{
+    ///
+    /// @brief  The speeds an SDL event recording can be replayed at.
+    ///
+    enum class sdl_replay_speed : uint8_t
+    {
+        // Each poll cycle is replayed after the same delay from the start as when it was recorded.
+        recorded,
+
+        // Each poll cycle is replayed as soon as the previous one is finished.
+        max
+    };
+
+    ///
+    /// @brief  Replays an SDL event recording made by an SDL event recorder. The recording is read
+    ///         into memory up front. Each recorded poll cycle is then replayed as a poll cycle of
+    ///         the SDL window manager: its events are routed to their subject windows and handled
+    ///         by their SDL window event managers exactly as if they had been read from the SDL
+    ///         event queue, deferred events are flushed, and the managed windows are polled. Since
+    ///         the cycles are the same, events are coalesced the same way as when recorded.
+    ///
+    ///         Events are routed by their recorded window IDs. SDL assigns IDs sequentially, so
+    ///         creating the windows in the same order as when recording usually reproduces them.
+    ///         Otherwise, each recorded ID can be mapped to a window with map_window.
+    ///
+    /// @note   The replayed events change the state windows report (e.g. their bounds) but not
+    ///         the native windows themselves.
+    ///
+    class sdl_event_replayer : public utl::unique
+    {
+        private:
+            ///
+            /// @brief  Represents a recorded poll cycle.
+            ///
+            typedef struct cycle
+            {
+                ///
+                /// @brief  The time in nanoseconds from the start of the recording to the end of
+                ///         the cycle.
+                ///
+                int64_t time_ns;
+
+                ///
+                /// @brief  The index of the first event of the cycle.
+                ///
+                size_t first_event;
+
+                ///
+                /// @brief  The number of events in the cycle.
+                ///
+                size_t event_count;
+            } cycle_t;
+
+            ///
+            /// @brief  Every recorded event in order.
+            ///
+            std::vector<SDL_Event> m_events;
+
+            ///
+            /// @brief  The time in nanoseconds from the start of the recording that each event
+            ///         occured at, indexed like the events. Events that occured before recording
+            ///         started have negative times.
+            ///
+            std::vector<int64_t> m_event_times_ns;
+
+            ///
+            /// @brief  The recorded text of every event, each null-terminated. The text fields of
+            ///         the events point into it, so it is not changed once the recording is read.
+            ///
+            std::vector<char> m_text;
+
+            ///
+            /// @brief  Every recorded poll cycle in order.
+            ///
+            std::vector<cycle_t> m_cycles;
+
+            ///
+            /// @brief  Maps recorded window IDs to the IDs events are routed to, indexed directly
+            ///         by recorded ID. IDs without a mapping are routed unchanged.
+            ///
+            std::vector<uint32_t> m_window_ids;
+
+            ///
+            /// @brief  The distinct window IDs recorded events were addressed to, in ascending
+            ///         order.
+            ///
+            std::vector<uint32_t> m_recorded_window_ids;
+
+            ///
+            /// @brief  The index of the next poll cycle to replay.
+            ///
+            size_t m_next_cycle;
+
+            ///
+            /// @brief  Denotes whether recorded close requests are left out of the replay, so that
+            ///         replaying does not close the windows events are routed to.
+            ///
+            bool m_skips_close_requests;
+
+            ///
+            /// @brief  The number of events routed to a managed window since the replay was last
+            ///         rewound.
+            ///
+            size_t m_routed_count;
+
+            ///
+            /// @brief  A buffer the events of a cycle are prepared in before they are routed,
+            ///         reused so that replaying does not allocate once the buffer has grown.
+            ///
+            std::vector<SDL_Event> m_cycle_events;
+
+            ///
+            /// @brief  Reads and decodes the recording at the given path.
+            ///
+            /// @param  path    the path of the recording
+            ///
+            /// @throw  runtime_error if the file could not be read or is not a valid recording
+            ///
+            void load(const std::string &path);
+
+            ///
+            /// @brief  Replays the next poll cycle.
+            ///
+            /// @param  keep_spacing    whether the events are stamped with their recorded times
+            ///                         shifted by the given offset rather than with the current
+            ///                         time
+            /// @param  time_offset_ns  the SDL clock time in nanoseconds that corresponds to the
+            ///                         start of the recording
+            ///
+            /// @throw  exception if any window failed to poll events
+            ///
+            void replay_cycle(bool keep_spacing, int64_t time_offset_ns);
+
+        public:
+            ///
+            /// @brief  Creates a replayer for the recording at the given path.
+            ///
+            /// @param  path    the path of a recording made by an SDL event recorder
+            ///
+            /// @throw  runtime_error if the file could not be read or is not a valid recording
+            ///
+            sdl_event_replayer(const std::string &path);
+
+            ///
+            /// @brief  Routes the events recorded for the window with the given ID to the given
+            ///         window.
+            ///
+            /// @param  recorded_id the SDL ID the window had when the recording was made
+            /// @param  window      a pointer to the window to route the events to
+            ///
+            /// @return a pointer to this replayer
+            ///
+            /// @throw  runtime_error if the window pointer is null
+            ///
+            sdl_event_replayer *map_window(uint32_t recorded_id, const sdl_window *window);
+
+            ///
+            /// @brief  Sets whether recorded close requests are left out of the replay. Skipping
+            ///         them keeps the windows open, so that every replay of the recording routes the
+            ///         same events (e.g. when benchmarking).
+            ///
+            /// @param  skips   whether close requests are skipped
+            ///
+            /// @return a pointer to this replayer
+            ///
+            sdl_event_replayer *set_skips_close_requests(bool skips) noexcept;
+
+            ///
+            /// @brief  Returns the distinct window IDs recorded events were addressed to.
+            ///         Each is a candidate for map_window.
+            ///
+            /// @return the recorded window IDs in ascending order
+            ///
+            const std::vector<uint32_t> &recorded_window_ids(void) const noexcept;
+
+            ///
+            /// @brief  Determines how many events the recording contains.
+            ///
+            /// @return the number of recorded events
+            ///
+            size_t event_count(void) const noexcept;
+
+            ///
+            /// @brief  Determines how many poll cycles the recording contains.
+            ///
+            /// @return the number of recorded poll cycles
+            ///
+            size_t cycle_count(void) const noexcept;
+
+            ///
+            /// @brief  Determines how long the recording took to make.
+            ///
+            /// @return the time in nanoseconds from the start of the recording to the end of its
+            ///         last poll cycle
+            ///
+            uint64_t duration_ns(void) const noexcept;
+
+            ///
+            /// @brief  Determines how many replayed events were routed to a managed window since
+            ///         the replay was last rewound. Events for windows that were closed are not
+            ///         counted, so a replay that closes windows routes fewer events when repeated.
+            ///
+            /// @return the number of routed events
+            ///
+            size_t routed_count(void) const noexcept;
+
+            ///
+            /// @brief  Determines whether every poll cycle has been replayed.
+            ///
+            /// @return true if and only if no poll cycles remain
+            ///
+            bool is_finished(void) const noexcept;
+
+            ///
+            /// @brief  Replays the next poll cycle immediately. Its events are stamped with the
+            ///         current time.
+            ///
+            /// @return true if and only if a poll cycle was replayed
+            ///
+            /// @throw  exception if any window failed to poll events
+            ///
+            bool step(void);
+
+            ///
+            /// @brief  Replays every remaining poll cycle at the given speed. At the recorded
+            ///         speed, the calling thread sleeps between cycles and event timestamps are
+            ///         shifted so that they keep their recorded spacing.
+            ///
+            /// @param  speed   the speed to replay at
+            ///
+            /// @return the number of poll cycles replayed
+            ///
+            /// @throw  exception if any window failed to poll events
+            ///
+            size_t replay(sdl_replay_speed speed);
+
+            ///
+            /// @brief  Starts replaying from the first poll cycle again and resets the count of
+            ///         routed events.
+            ///
+            /// @return a pointer to this replayer
+            ///
+            sdl_event_replayer *rewind(void) noexcept;
+    };
+}
+
+#endif
@@ -93,6 +93,82 @@ namespace leaf
         set_user_resizable(false);
     }
 
+    border_t sdl_window::read_frame_border(void) const
+    {
+        // SDL fails to recognize the macOS X frame border size. It can be manually defined.
+        #if BX_PLATFORM_OSX
+
+            // mac OS X frames only have a bar on top that is 28 pixels tall.
+            return {0, 28, 0, 0};
+
+        #endif
+
+        // Allocate variables to store the left, top, right, and bottom measurements.
+        int left, top, right, bottom;
+
+        // Use SDL functionality to try to read the measurements of the frame border. If the call
+        // fails and the window is framed, an error must have occured, and a runtime error will be
+        // thrown.
+        if (
+            SDL_GetWindowBordersSize(m_internal_window, &top, &left, &bottom, &right) < 0
+            && !(SDL_GetWindowFlags(m_internal_window) & SDL_WINDOW_BORDERLESS)
+        )
+        {
+            throw runtime_error("Failed to determine SDL window frame border size. ("
+                + string(SDL_GetError()) + ')');
+        }
+
+        // Return a border structure of the given left, top, right, and bottom measurements. The
+        // downcast can be assumed to never truncate the dimension since it is currently safe to
+        // assume that no single dimension will ever need to store a value of more than 32767 pixels
+        // (the maximum value of a 16-byte integer).
+        return {(px_t)left, (px_t)top, (px_t)right, (px_t)bottom};
+    }
+
+    void sdl_window::update_state(const SDL_Event &event) noexcept
+    {
+        // Mirror the changes each relevant window event carries into the state snapshot.
+        switch (event.type)
+        {
+            // The size of the display surface in pixels is carried by the event data.
+            case SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED:
+                m_state.bounds = {(px_t)event.window.data1, (px_t)event.window.data2};
+                break;
+
+            // The new position of the display surface is carried by the event data.
+            case SDL_EVENT_WINDOW_MOVED:
+                m_state.pos = {(px_t)event.window.data1, (px_t)event.window.data2};
+                break;
+
+            // Some platforms only report the frame border once the window is shown, so it is read
+            // again here. A failure leaves the previous measurements in place.
+            case SDL_EVENT_WINDOW_SHOWN:
+                m_state.is_visible = true;
+                try
+                {
+                    m_state.frame_border = read_frame_border();
+                }
+                catch (const runtime_error &) {}
+                break;
+
+            case SDL_EVENT_WINDOW_HIDDEN:
+                m_state.is_visible = false;
+                break;
+
+            case SDL_EVENT_WINDOW_FOCUS_GAINED:
+                m_state.has_focus = true;
+                break;
+
+            case SDL_EVENT_WINDOW_FOCUS_LOST:
+                m_state.has_focus = false;
+                break;
+
+            // Other events do not affect the mirrored state.
+            default:
+                break;
+        }
+    }
+
     sdl_window::sdl_window(void)
         // Delegate to the constructor with explicit parameters.
         : sdl_window("", LEAF_SDL_WINDOW_DEFAULT_WIDTH, LEAF_SDL_WINDOW_DEFAULT_HEIGHT) {}
@@ -105,7 +181,7 @@ namespace leaf
         // Upon creation, the window should not be flagged to close. It will not be resizable by the
         // user. Dynamically create a new window event manager on the heap.
         : m_should_close(false), m_is_user_resizable(false),
-        m_event_manager(new sdl_window_event_manager)
+        m_event_manager(new sdl_window_event_manager(this))
     {
         // Establish some default flags for the window state upon creation. Only the video window
         // mode is needed and the window should start hidden.
@@ -120,6 +196,13 @@ namespace leaf
             throw runtime_error("Failed to create SDL window. (" + string(SDL_GetError()) + ')');
         }
 
+        // No batched update is in progress so no changes are recorded.
+        m_update.has_bounds = false;
+        m_update.has_pos = false;
+        m_update.has_title = false;
+        m_update.has_framed = false;
+        m_update.has_visible = false;
+
         // Get the SDL 4-byte internal ID.
         m_id = SDL_GetWindowID(m_internal_window);
 
@@ -140,15 +223,18 @@ namespace leaf
 
         // Apply the defaut presets to the window.
         set_defaults();
+
+        // Populate the state snapshot from SDL so getters are valid before any events arrive.
+        refresh();
         
         // Register the window with the SDL window manager.
-        sdl::instance.register_window(this);
+        sdl::instance.register_sdl_window(this);
     }
 
     sdl_window::~sdl_window() noexcept
     {
         // Unregister the window with the SDL window manager.
-        sdl::instance.unregister_window(this);
+        sdl::instance.unregister_sdl_window(this);
 
         // Ensure that the internal window is destroyed.
         destroy();
@@ -216,74 +302,167 @@ namespace leaf
         return m_id;
     }
 
-    void sdl_window::handle_sdl_event(const SDL_Event &event) noexcept
+    sdl_window *sdl_window::refresh(void)
     {
-        
+        // Allocate variables to store the raw SDL measurements.
+        int width, height, x, y;
+
+        // Use SDL functionality to read the size of the display surface in pixels and its position.
+        SDL_GetWindowSizeInPixels(m_internal_window, &width, &height);
+        SDL_GetWindowPosition(m_internal_window, &x, &y);
+
+        // Read every flag at once.
+        uint32_t flags = SDL_GetWindowFlags(m_internal_window);
+
+        // Store the measurements. The downcast can be assumed to never truncate the dimension since
+        // it is currently safe to assume that no single dimension will ever need to store a value
+        // of more than 32767 pixels (the maximum value of a 16-byte integer).
+        m_state.bounds = {(px_t)width, (px_t)height};
+        m_state.pos = {(px_t)x, (px_t)y};
+
+        // Store the flags.
+        m_state.is_visible = !(flags & SDL_WINDOW_HIDDEN);
+        m_state.has_focus = flags & SDL_WINDOW_INPUT_FOCUS;
+        m_state.framed = !(flags & SDL_WINDOW_BORDERLESS);
+
+        // Store the title.
+        m_state.title = SDL_GetWindowTitle(m_internal_window);
+
+        // Store the frame border measurements last since reading them may throw.
+        m_state.frame_border = read_frame_border();
+
+        // Return a pointer to the window for chaining.
+        return this;
     }
 
-    bounds2_t sdl_window::bounds(void) const noexcept
+    bool sdl_window::handle_sdl_event(const SDL_Event &event) noexcept
     {
-        // Allocate variables to store the width and height.
-        int width, height;
+        // Mirror any state change the event carries before handlers are notified so that getters
+        // called from handlers already observe the new state.
+        update_state(event);
 
-        // Use SDL fucntionality to read the width and height.
-        SDL_GetWindowSizeInPixels(m_internal_window, &width, &height);
+        // Forward the event to the window's event manager so that subscribed handlers are
+        // notified. Return whether the event manager now has deferred events to flush.
+        return m_event_manager->handle_sdl_event(event);
+    }
 
-        // Return a bounding rectangle structure of the given width and height. The downcast can be
-        // assumed to never truncate the dimension since it is currently safe to assume that no
-        // single dimension will ever need to store a value of more than 32767 pixels (the maximum
-        // value of a 16-byte integer).
-        return {(px_t)width, (px_t)height};
+    void sdl_window::flush_deferred_events(void) noexcept
+    {
+        // Instruct the window's event manager to notify handlers of its deferred events.
+        m_event_manager->flush_deferred_events();
     }
 
-    sdl_window *sdl_window::set_width(px_t width) noexcept
+    void sdl_window::apply_update(void) noexcept
     {
-        // Allocate a variable to store the current height.
-        int height;
+        // Take the recorded changes and clear them so that the setters called below apply
+        // immediately and a later update starts empty.
+        sdl_window_update_t update = m_update;
+        m_update.has_bounds = false;
+        m_update.has_pos = false;
+        m_update.has_title = false;
+        m_update.has_framed = false;
+        m_update.has_visible = false;
 
-        // Use SDL fucntionality to read the current height.
-        SDL_GetWindowSizeInPixels(m_internal_window, NULL, &height);
+        // Apply the title and frame first since they do not produce geometry events of their own.
+        // Skip properties whose target already matches the state snapshot.
+        if (update.has_title && update.state.title != m_state.title)
+        {
+            set_title(update.state.title);
+        }
 
-        // Use SDL functionality to set the width, explicitly set the height to its previous value.
-        SDL_SetWindowSize(m_internal_window, width, height);
+        if (update.has_framed && update.state.framed != m_state.framed)
+        {
+            set_framed(update.state.framed);
+        }
 
-        // Return a pointer to the window for chaining.
-        return this;
+        // Apply the size and position with a single SDL call each. They are never skipped, since
+        // the user may have resized or moved the window since the snapshot was last updated.
+        if (update.has_bounds)
+        {
+            set_size(update.state.bounds.width, update.state.bounds.height);
+        }
+
+        if (update.has_pos)
+        {
+            set_pos(update.state.pos.x, update.state.pos.y);
+        }
+
+        // Apply the visibility last so that a window being shown appears with its final geometry.
+        if (update.has_visible && update.state.is_visible != m_state.is_visible)
+        {
+            set_visible(update.state.is_visible);
+        }
     }
 
-    sdl_window *sdl_window::set_height(px_t height) noexcept
+    bounds2_t sdl_window::bounds(void) const noexcept
     {
-        // Allocate a variable to store the current width.
-        int width;
+        // Return the bounds from the state snapshot.
+        return m_state.bounds;
+    }
+
+    sdl_window *sdl_window::set_width(px_t width) noexcept
+    {
+        // During a batched update, record the width and keep the height of the target size.
+        if (is_updating())
+        {
+            return set_size(width, m_update.has_bounds
+                ? m_update.state.bounds.height : m_state.bounds.height);
+        }
 
-        // Use SDL fucntionality to read the current width.
-        SDL_GetWindowSizeInPixels(m_internal_window, &width, NULL);
+        // Set the width, explicitly set the height to its last known value.
+        return set_size(width, m_state.bounds.height);
+    }
 
-        // Use SDL functionality to set the height, explicitly set the width to its previous value.
-        SDL_SetWindowSize(m_internal_window, width, height);
+    sdl_window *sdl_window::set_height(px_t height) noexcept
+    {
+        // During a batched update, record the height and keep the width of the target size.
+        if (is_updating())
+        {
+            return set_size(m_update.has_bounds
+                ? m_update.state.bounds.width : m_state.bounds.width, height);
+        }
 
-        // Return a pointer to the window for chaining.
-        return this;
+        // Set the height, explicitly set the width to its last known value.
+        return set_size(m_state.bounds.width, height);
     }
 
     sdl_window *sdl_window::set_size(px_t width, px_t height) noexcept
     {
+        // During a batched update, record the size to be applied on commit.
+        if (is_updating())
+        {
+            m_update.has_bounds = true;
+            m_update.state.bounds = {width, height};
+            return this;
+        }
+
         // Use SDL functionality to set the size.
         SDL_SetWindowSize(m_internal_window, width, height);
 
+        // Write the size through to the state snapshot so that getters and the other setters see
+        // it before the next poll. The matching resize event will store the size SDL settled on.
+        m_state.bounds = {width, height};
+
         // Return a pointer to the window for chaining.
         return this;
     }
 
     bool sdl_window::is_visible(void) const noexcept
     {
-        // Use SDL functionality to determine if the window shown flag is enabled denoting that the
-        // window is not hidden.
-        return !(SDL_GetWindowFlags(m_internal_window) & SDL_WINDOW_HIDDEN);
+        // Return the visibility flag from the state snapshot.
+        return m_state.is_visible;
     }
 
     sdl_window *sdl_window::set_visible(bool is_visible) noexcept
     {
+        // During a batched update, record the visibility to be applied on commit.
+        if (is_updating())
+        {
+            m_update.has_visible = true;
+            m_update.state.is_visible = is_visible;
+            return this;
+        }
+
         // If the window should be visible, show the window. Otherwise hide it.
         if (is_visible)
         {
@@ -296,62 +475,64 @@ namespace leaf
             SDL_HideWindow(m_internal_window);
         }
 
+        // Write the visibility through to the state snapshot. The matching shown or hidden event
+        // will store the same value.
+        m_state.is_visible = is_visible;
+
         // Return a pointer to the window for chaining.
         return this;
     }
 
     pos2_t sdl_window::pos(void) const noexcept
     {
-        // Allocate variables to store the x-position and y-position.
-        int x, y;
-
-        // Use SDL fucntionality to read the x-position and y-position.
-        SDL_GetWindowPosition(m_internal_window, &x, &y);
-
-        // Return a position structure of the given x-position and y-position. The downcast can be
-        // assumed to never truncate the dimension since it is currently safe to assume that no
-        // single dimension will ever need to store a value of more than 32767 pixels (the maximum
-        // value of a 16-byte integer).
-        return {(px_t)x, (px_t)y};
+        // Return the position from the state snapshot.
+        return m_state.pos;
     }
 
     sdl_window *sdl_window::set_x(px_t x) noexcept
     {
-        // Allocate a variable to store the current y-position.
-        int y;
-
-        // Use SDL fucntionality to read the current y-position.
-        SDL_GetWindowSizeInPixels(m_internal_window, NULL, &y);
-
-        // Use SDL functionality to set the x-position, explicitly set the y-position to its
-        // previous value.
-        SDL_SetWindowPosition(m_internal_window, x, y);
+        // During a batched update, record the x-position and keep the y-position of the target
+        // position.
+        if (is_updating())
+        {
+            return set_pos(x, m_update.has_pos ? m_update.state.pos.y : m_state.pos.y);
+        }
 
-        // Return a pointer to the window for chaining.
-        return this;
+        // Set the x-position, explicitly set the y-position to its last known value.
+        return set_pos(x, m_state.pos.y);
     }
 
     sdl_window *sdl_window::set_y(px_t y) noexcept
     {
-        // Allocate a variable to store the current x-position.
-        int x;
-
-        // Use SDL fucntionality to read the current x-position.
-        SDL_GetWindowSizeInPixels(m_internal_window, &x, NULL);
-
-        // Use SDL functionality to set the y-position, explicitly set the x-position to its
-        // previous value.
-        SDL_SetWindowPosition(m_internal_window, x, y);
+        // During a batched update, record the y-position and keep the x-position of the target
+        // position.
+        if (is_updating())
+        {
+            return set_pos(m_update.has_pos ? m_update.state.pos.x : m_state.pos.x, y);
+        }
 
-        // Return a pointer to the window for chaining.
-        return this;
+        // Set the y-position, explicitly set the x-position to its last known value.
+        return set_pos(m_state.pos.x, y);
     }
 
     sdl_window *sdl_window::set_pos(px_t x, px_t y) noexcept
     {
+        // During a batched update, record the position to be applied on commit.
+        if (is_updating())
+        {
+            m_update.has_pos = true;
+            m_update.state.pos = {x, y};
+            return this;
+        }
+
         // Use SDL functionality to set the position.
         SDL_SetWindowPosition(m_internal_window, x, y);
 
+        // Write the position through to the state snapshot so that getters and the other setters
+        // see it before the next poll. The matching move event will store the position SDL
+        // settled on.
+        m_state.pos = {x, y};
+
         // Return a pointer to the window for chaining.
         return this;
     }
@@ -376,23 +557,34 @@ namespace leaf
 
     string sdl_window::title(void) const noexcept
     {
-        // Use SDL functionality to retrieve the title of the window.
-        return SDL_GetWindowTitle(m_internal_window);
+        // Return the title from the state snapshot.
+        return m_state.title;
     }
 
     sdl_window *sdl_window::set_title(const string &title) noexcept
     {
+        // During a batched update, record the title to be applied on commit.
+        if (is_updating())
+        {
+            m_update.has_title = true;
+            m_update.state.title = title;
+            return this;
+        }
+
         // Use SDL functionality to set the window title.
         SDL_SetWindowTitle(m_internal_window, title.c_str());
 
+        // Write the title through to the state snapshot. SDL does not report title changes.
+        m_state.title = title;
+
         // Return a pointer to the window for chaining.
         return this;
     }
 
     bool sdl_window::has_focus(void) const noexcept
     {
-        // Use SDL functionality to reteieve the flag indicating whether the window has input focus.
-        return SDL_GetWindowFlags(m_internal_window) & SDL_WINDOW_INPUT_FOCUS;
+        // Return the focus flag from the state snapshot.
+        return m_state.has_focus;
     }
 
     sdl_window *sdl_window::focus(void) noexcept
@@ -407,59 +599,52 @@ namespace leaf
 
     bool sdl_window::framed(void) const noexcept
     {
-        // Use SDL functionality to determine if the window borderless flag is enabled denoting that
-        // the window has a border (frame).
-        return !(SDL_GetWindowFlags(m_internal_window) & SDL_WINDOW_BORDERLESS);
+        // Return the frame flag from the state snapshot.
+        return m_state.framed;
     }
 
     sdl_window *sdl_window::set_framed(bool framed) noexcept
     {
+        // During a batched update, record whether the window should be framed to be applied on
+        // commit.
+        if (is_updating())
+        {
+            m_update.has_framed = true;
+            m_update.state.framed = framed;
+            return this;
+        }
+
         // Use SDL functionality to set whether the window has a border (frame).
         SDL_SetWindowBordered(m_internal_window, (SDL_bool)framed);
 
+        // Write the flag through to the state snapshot. SDL does not report frame changes, so the
+        // frame border is read again. An unframed window has no border, and a failed read leaves
+        // the previous measurements in place.
+        m_state.framed = framed;
+
+        try
+        {
+            m_state.frame_border = framed ? read_frame_border() : border_t{0, 0, 0, 0};
+        }
+        catch (const runtime_error &) {}
+
         // Return a pointer to the window for chaining.
         return this;
     }
 
-    border_t sdl_window::frame_border(void) const
+    border_t sdl_window::frame_border(void) const noexcept
     {
-        // SDL fails to recognize the macOS X frame border size. It can be manually defined.
-        #if BX_PLATFORM_OSX
-
-            // mac OS X frames only have a bar on top that is 28 pixels tall.
-            return {0, 28, 0, 0};
-
-        #endif
-
-        // Allocate variables to store the left, top, right, and bottom measurements.
-        int left, top, right, bottom;
-
-        // Use SDL functionality to try to read the measurements of the frame border. If the call
-        // fails and the window is framed, an error must have occured, and a runtime error will be
-        // thrown.
-        if (
-            SDL_GetWindowBordersSize(m_internal_window, &top, &left, &bottom, &right) < 0
-            && framed()
-        )
-        {
-            throw runtime_error("Failed to determine SDL window frame border size. ("
-                + string(SDL_GetError()) + ')');
-        }
-
-        // Return a border structure of the given left, top, right, and bottom measurements. The
-        // downcast can be assumed to never truncate the dimension since it is currently safe to
-        // assume that no single dimension will ever need to store a value of more than 32767 pixels
-        // (the maximum value of a 16-byte integer).
-        return {(px_t)left, (px_t)top, (px_t)right, (px_t)bottom};
+        // Return the frame border measurements from the state snapshot.
+        return m_state.frame_border;
     }
 
-    pos2_t sdl_window::frame_pos(void) const
+    pos2_t sdl_window::frame_pos(void) const noexcept
     {
         // Get the position of the window's display surface.
         pos2_t surface_pos = pos();
 
         // Get the frame border measurements.
-        border_t frame_border = this->frame_border();
+        border_t frame_border = m_state.frame_border;
 
         // Using the position of the surface and the frame border measurements on the left and top
         // sides of the surface, use subtraction to determine where the top left corner of the frame
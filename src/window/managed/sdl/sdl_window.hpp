@@ -39,6 +39,87 @@ namespace leaf
 
 namespace leaf
 {
+    /// 
+    /// @brief  Represents a snapshot of the state of an SDL window. The snapshot is kept up to date
+    ///         from SDL window events so that reading the state does not call into SDL.
+    /// 
+    typedef struct sdl_window_state
+    {
+        /// 
+        /// @brief  The bounds of the window's display surface in pixels.
+        /// 
+        bounds2_t bounds;
+
+        /// 
+        /// @brief  The position of the window's display surface.
+        /// 
+        pos2_t pos;
+
+        /// 
+        /// @brief  The size of the window's frame as border measurements.
+        /// 
+        border_t frame_border;
+
+        /// 
+        /// @brief  Denotes whether the window is visible.
+        /// 
+        bool is_visible;
+
+        /// 
+        /// @brief  Denotes whether the window has input focus.
+        /// 
+        bool has_focus;
+
+        /// 
+        /// @brief  Denotes whether the window has a frame.
+        /// 
+        bool framed;
+
+        /// 
+        /// @brief  The title of the window.
+        /// 
+        std::string title;
+
+    } sdl_window_state_t;
+
+    /// 
+    /// @brief  Represents the changes recorded by setters during a batched update of an SDL window.
+    ///         Each property is only applied on commit if its flag is set.
+    /// 
+    typedef struct sdl_window_update
+    {
+        /// 
+        /// @brief  Denotes whether the size of the display surface was changed.
+        /// 
+        bool has_bounds;
+
+        /// 
+        /// @brief  Denotes whether the position of the display surface was changed.
+        /// 
+        bool has_pos;
+
+        /// 
+        /// @brief  Denotes whether the title was changed.
+        /// 
+        bool has_title;
+
+        /// 
+        /// @brief  Denotes whether the frame was added or removed.
+        /// 
+        bool has_framed;
+
+        /// 
+        /// @brief  Denotes whether the visibility was changed.
+        /// 
+        bool has_visible;
+
+        /// 
+        /// @brief  The target state. Only the properties whose flags are set are meaningful.
+        /// 
+        sdl_window_state_t state;
+
+    } sdl_window_update_t;
+
     /// 
     /// @brief  Represents a graphical user interface window implemented with SDL. A window is
     ///         immediately alive (open) upon its object's construction, however, it may be closed
@@ -86,6 +167,34 @@ namespace leaf
             /// 
             native_surface_data_t m_native_data;
 
+            /// 
+            /// @brief  A snapshot of the window's state that getters read from. It is updated from
+            ///         SDL window events, by setters, and by refreshing.
+            /// 
+            sdl_window_state_t m_state;
+
+            /// 
+            /// @brief  Reads the size of the frame as border measurements from SDL.
+            /// 
+            /// @return the size of the frame as border measurements
+            /// 
+            /// @throw  runtime_error if the size of the frame border could not be determined on the
+            ///         operating system
+            /// 
+            border_t read_frame_border(void) const;
+
+            /// 
+            /// @brief  Updates the state snapshot from an SDL event that is relevant to the window.
+            /// 
+            /// @param  event   the SDL event
+            /// 
+            void update_state(const SDL_Event &event) noexcept;
+
+            /// 
+            /// @brief  The changes recorded during the batched update in progress.
+            /// 
+            sdl_window_update_t m_update;
+
             /// 
             /// @brief  Creates the native data for the window's display surface.
             /// 
@@ -137,24 +246,41 @@ namespace leaf
             /// 
             virtual bool poll_events(void) noexcept override;
 
-            /// 
-            /// @brief  Determines the window's 4-byte internal SDL identifier.
-            /// 
-            /// @return the 4-byte ID
-            /// 
-            uint32_t id(void) const noexcept;
-
             /// 
             /// @brief      Handles an SDL event that is relevant to this window (i.e. this window
             ///             is the subject of the event).
             /// 
             /// @param      event   the SDL event
             /// 
+            /// @return     true if and only if the window now has deferred events that must be
+            ///             flushed at the end of the poll cycle and did not have any before
+            /// 
             /// @warning    There is no check in place to ensure this event is relevant to this
             ///             window. It is the duty of the caller to responsibly pass only events
             ///             where the subject is this window.
             /// 
-            void handle_sdl_event(const SDL_Event &event) noexcept;
+            bool handle_sdl_event(const SDL_Event &event) noexcept;
+
+            /// 
+            /// @brief      Notifies event handlers of the coalesced events deferred during the
+            ///             current poll cycle.
+            /// 
+            void flush_deferred_events(void) noexcept;
+
+            /// 
+            /// @brief      Applies the changes recorded during the batched update with at most one
+            ///             SDL call per property. The frame and title are applied first and the
+            ///             visibility last so that a window being shown appears with its final
+            ///             geometry. The resulting resize and move events are coalesced into single
+            ///             notifications only if SDL reports them within the same poll cycle, since
+            ///             events are coalesced per poll cycle. Otherwise, e.g. when the window
+            ///             manager of the system applies the size and position separately, handlers
+            ///             are notified once per poll cycle the events span.
+            /// 
+            /// @warning    Behavior is undefined if the window is closed and a segmentation fault
+            ///             is likely.
+            /// 
+            virtual void apply_update(void) noexcept override;
 
         public:
             /// 
@@ -204,6 +330,29 @@ namespace leaf
             /// 
             virtual ~sdl_window() noexcept;
 
+            /// 
+            /// @brief  Determines the window's 4-byte internal SDL identifier.
+            /// 
+            /// @return the 4-byte ID
+            /// 
+            uint32_t id(void) const noexcept;
+
+            /// 
+            /// @brief      Reads the full state of the window from SDL into the state snapshot that
+            ///             getters read from. The snapshot is normally kept up to date from SDL
+            ///             events, so this is only needed to force a resynchronization, e.g. right
+            ///             after setting geometry and before SDL has reported the change.
+            /// 
+            /// @return     a pointer to the window for chaining
+            /// 
+            /// @throw      runtime_error if the size of the frame border could not be determined on
+            ///             the operating system
+            /// 
+            /// @warning    Behavior is undefined if the window is closed and a segmentation fault
+            ///             is likely.
+            /// 
+            sdl_window *refresh(void);
+
             /// 
             /// @brief      Determines the bounds of the window's display surface in pixel
             ///             measurements. Note that the surface is only the inner content area of
@@ -211,8 +360,8 @@ namespace leaf
             /// 
             /// @return     the bounds of the window's display surface
             /// 
-            /// @warning    Behavior is undefined if the window is closed and a segmentation fault
-            ///             is likely.
+            /// @note       The value is read from the window's state snapshot without calling into
+            ///             SDL. After the window is closed, the last known value is returned.
             ///
             virtual bounds2_t bounds(void) const noexcept override;
 
@@ -270,8 +419,8 @@ namespace leaf
             /// 
             /// @return     whether the window is currently visible
             /// 
-            /// @warning    Behavior is undefined if the window is closed and a segmentation fault
-            ///             is likely.
+            /// @note       The value is read from the window's state snapshot without calling into
+            ///             SDL. After the window is closed, the last known value is returned.
             /// 
             virtual bool is_visible(void) const noexcept override;
 
@@ -297,8 +446,8 @@ namespace leaf
             /// 
             /// @return     the position of the window's display surface
             /// 
-            /// @warning    Behavior is undefined if the window is closed and a segmentation fault
-            ///             is likely.
+            /// @note       The value is read from the window's state snapshot without calling into
+            ///             SDL. After the window is closed, the last known value is returned.
             /// 
             virtual pos2_t pos(void) const noexcept override;
 
@@ -380,8 +529,8 @@ namespace leaf
             /// 
             /// @return     the title of the window
             /// 
-            /// @warning    Behavior is undefined if the window is closed and a segmentation fault
-            ///             is likely.
+            /// @note       The value is read from the window's state snapshot without calling into
+            ///             SDL. After the window is closed, the last known value is returned.
             /// 
             virtual std::string title(void) const noexcept override;
 
@@ -403,6 +552,9 @@ namespace leaf
             /// 
             /// @return  true if and only if the window has input focus
             /// 
+            /// @note    The value is read from the window's state snapshot without calling into
+            ///          SDL.
+            /// 
             virtual bool has_focus(void) const noexcept override;
 
             /// 
@@ -418,8 +570,8 @@ namespace leaf
             ///
             /// @return     true if and only if the window has a frame
             ///
-            /// @warning    Behavior is undefined if the window is closed and a segmentation fault
-            ///             is likely.
+            /// @note       The value is read from the window's state snapshot without calling into
+            ///             SDL. After the window is closed, the last known value is returned.
             /// 
             virtual bool framed(void) const noexcept override;
 
@@ -441,13 +593,10 @@ namespace leaf
             ///         
             /// @return     the size of the frame as border measurements
             /// 
-            /// @throw      runtime_error if the size of the frame border could not be determined on
-            ///             the operating system
-            /// 
-            /// @warning    Behavior is undefined if the window is closed and a segmentation fault
-            ///             is likely.
+            /// @note       The value is read from the window's state snapshot without calling into
+            ///             SDL. After the window is closed, the last known value is returned.
             ///
-            virtual border_t frame_border(void) const override;
+            virtual border_t frame_border(void) const noexcept override;
 
             /// 
             /// @brief      Determines the position of the top left corner of the frame originating
@@ -457,13 +606,10 @@ namespace leaf
             ///  
             /// @return     the position of the frame
             /// 
-            /// @throw      runtime_error if the position of the frame could not be determined on
-            ///             the operating system
-            /// 
-            /// @warning    Behavior is undefined if the window is closed and a segmentation fault
-            ///             is likely.
+            /// @note       The value is read from the window's state snapshot without calling into
+            ///             SDL. After the window is closed, the last known value is returned.
             /// 
-            virtual pos2_t frame_pos(void) const override;
+            virtual pos2_t frame_pos(void) const noexcept override;
 
             /// 
             /// @brief      Returns a pointer to the window's event manager. The event manager can
@@ -3,18 +3,39 @@
 /// @author     Will Brandon (brandon.w@northeastern.edu)
 /// @date       May 14, 2023
 /// 
-/// @brief      
+/// @brief      Implementation for a class that represents a manager for the events of a window
+///             implemented with SDL. SDL window events are translated into notifications for the
+///             subscribed event handlers. Resize and move events are coalesced per poll cycle.
 /// 
 /// @copyright  Copyright (c) 2023
 /// 
 
-#include <SDL3/SDL_events.h>
+#include <SDL3/SDL.h>
 #include "sdl_window_event_manager.hpp"
+#include "sdl_window.hpp"
 
 namespace leaf
 {
-    void sdl_window_event_manager::handle_sdl_event(const SDL_Event &event) noexcept
+    sdl_window_event_manager::sdl_window_event_manager(sdl_window *window) noexcept
+        // Store the pointer to the window whose events are managed. Initially nothing is pending
+        // and no events have been coalesced.
+        : m_window(window), m_has_pending_resize(false), m_has_pending_move(false),
+        m_coalesced_event_count(0), m_pending_resize_time_ns(0), m_pending_move_time_ns(0) {}
+
+    uint64_t sdl_window_event_manager::now_ns(void) const noexcept
+    {
+        // Read the clock SDL stamps events with.
+        return SDL_GetTicksNS();
+    }
+
+    bool sdl_window_event_manager::handle_sdl_event(const SDL_Event &event) noexcept
     {
+        // Remember whether a notification was already pending before this event.
+        bool was_pending = m_has_pending_resize || m_has_pending_move;
+
+        // Stamp the notifications made for this event with the time SDL says it occured.
+        set_event_time(event.common.timestamp);
+
         // Proccess the event based on its type. This changed in SDL3. In SDL2, the event structure
         // was heirarchical and 2 nested conditional switches were necessary. Now the structure is
         // more conveniently flat.
@@ -25,9 +46,9 @@ namespace leaf
 
                 // If the window is user-closable set the close flag to indicate that a close is
                 // necessary.
-                if (is_user_closable())
+                if (m_window->is_user_closable())
                 {
-                    this->close();
+                    m_window->close();
                 }
 
                 // Notify the event manager of the user-requested close.
@@ -38,20 +59,108 @@ namespace leaf
             // Called when the window is resized. This can either be user-initiated or automatic.
             case SDL_EVENT_WINDOW_RESIZED:
 
-                // Notify the event manager of the resize.
-                resized(this->bounds());
+                // If a resize is already pending, this event is folded into it. Otherwise mark a
+                // resize as pending so that handlers are notified when deferred events are flushed.
+                if (m_has_pending_resize)
+                {
+                    m_coalesced_event_count++;
+                }
+
+                m_has_pending_resize = true;
+                m_pending_resize_time_ns = event.common.timestamp;
 
                 break;
             
             // Called when the window is moved. This can either be user-initiated or automatic.
             case SDL_EVENT_WINDOW_MOVED:
 
-                // Notify the event manager of the move.
-                moved(this->pos(), this->frame_pos());
+                // If a move is already pending, this event is folded into it. Otherwise mark a move
+                // as pending so that handlers are notified when deferred events are flushed.
+                if (m_has_pending_move)
+                {
+                    m_coalesced_event_count++;
+                }
+
+                m_has_pending_move = true;
+                m_pending_move_time_ns = event.common.timestamp;
 
                 break;
 
+            // Called when the window is shown. This can either be user-initiated or automatic.
             case SDL_EVENT_WINDOW_SHOWN:
+
+                // Notify the event manager that the window was shown.
+                shown();
+
+                break;
+
+            // Called when the window is hidden. This can either be user-initiated or automatic.
+            case SDL_EVENT_WINDOW_HIDDEN:
+
+                // Notify the event manager that the window was hidden.
+                hidden();
+
+                break;
+
+            // Called when the window is minimized. This can either be user-initiated or automatic.
+            case SDL_EVENT_WINDOW_MINIMIZED:
+
+                // Notify the event manager that the window was minimized.
+                minimized();
+
+                break;
+
+            // Called when the window is maximized. This can either be user-initiated or automatic.
+            case SDL_EVENT_WINDOW_MAXIMIZED:
+
+                // Notify the event manager that the window was maximized.
+                maximized();
+
+                break;
+
+            // Events that are not window related are ignored.
+            default:
+                break;
+        }
+
+        // Notifications made outside of event handling have no known time.
+        set_event_time(0);
+
+        // Return whether this event is the first of the poll cycle to leave a notification pending.
+        return !was_pending && (m_has_pending_resize || m_has_pending_move);
+    }
+
+    void sdl_window_event_manager::flush_deferred_events(void) noexcept
+    {
+        // Take the pending flags and clear them before notifying handlers, so that any events
+        // handled during the notifications are deferred to the next flush.
+        bool has_pending_resize = m_has_pending_resize;
+        bool has_pending_move = m_has_pending_move;
+
+        m_has_pending_resize = false;
+        m_has_pending_move = false;
+
+        // Notify the event manager of the resize with the final bounds of the window. It is
+        // stamped with the time of the last resize event since that is the state it reports.
+        if (has_pending_resize)
+        {
+            set_event_time(m_pending_resize_time_ns);
+            resized(m_window->bounds());
         }
+
+        // Notify the event manager of the move with the final positions of the window.
+        if (has_pending_move)
+        {
+            set_event_time(m_pending_move_time_ns);
+            moved(m_window->pos(), m_window->frame_pos());
+        }
+
+        set_event_time(0);
+    }
+
+    size_t sdl_window_event_manager::coalesced_event_count(void) const noexcept
+    {
+        // Return the counter of coalesced events.
+        return m_coalesced_event_count;
     }
 }
@@ -3,7 +3,9 @@
 /// @author     Will Brandon (brandon.w@northeastern.edu)
 /// @date       May 14, 2023
 /// 
-/// @brief      
+/// @brief      Header for a class that represents a manager for the events of a window implemented
+///             with SDL. SDL window events are translated into notifications for the subscribed
+///             event handlers. Resize and move events are coalesced per poll cycle.
 /// 
 /// @copyright  Copyright (c) 2023
 /// 
@@ -11,22 +13,109 @@
 #ifndef LEAF_SRC_SDL_WINDOW_EVENT_MANAGER_HEADER_GUARD
 #define LEAF_SRC_SDL_WINDOW_EVENT_MANAGER_HEADER_GUARD
 
-#include "../window_event_manager.hpp"
+// The class must be forward declared because there are circular includes between the SDL window
+// and SDL window event manager classes.
+namespace leaf
+{
+    class sdl_window;
+}
+
+#include <SDL3/SDL_events.h>
+#include "../../window_event_manager.hpp"
 
 namespace leaf
 {
     /// 
-    /// @brief  
+    /// @brief  Represents a manager for the events of a window implemented with SDL. SDL window
+    ///         events are translated into notifications for the subscribed event handlers.
+    ///         Resize and move events are coalesced: however many arrive during one SDL poll cycle,
+    ///         handlers are notified once with the final state after all other events of the cycle
+    ///         have been handled.
     /// 
     class sdl_window_event_manager : public window_event_manager
     {
-        /// 
-        /// @brief      Handles an SDL window event and notifies the proper handler of the event.
-        ///             Events that are not window related will be ignored.
-        /// 
-        /// @param      event   the SDL event
-        /// 
-        void handle_sdl_event(const SDL_Event &event) noexcept;
+        // The SDL window must be able to access hidden functionality of its event manager.
+        friend class sdl_window;
+
+        private:
+            /// 
+            /// @brief  A pointer to the SDL window whose events are managed.
+            /// 
+            sdl_window *const m_window;
+
+            /// 
+            /// @brief  Denotes whether a resize occured during the current poll cycle that handlers
+            ///         have not yet been notified of.
+            /// 
+            bool m_has_pending_resize;
+
+            /// 
+            /// @brief  Denotes whether a move occured during the current poll cycle that handlers
+            ///         have not yet been notified of.
+            /// 
+            bool m_has_pending_move;
+
+            /// 
+            /// @brief  The number of resize and move events that were folded into an already
+            ///         pending notification instead of being dispatched on their own.
+            /// 
+            size_t m_coalesced_event_count;
+
+            /// 
+            /// @brief  The SDL timestamp in nanoseconds of the last resize event folded into the
+            ///         pending resize.
+            /// 
+            uint64_t m_pending_resize_time_ns;
+
+            /// 
+            /// @brief  The SDL timestamp in nanoseconds of the last move event folded into the
+            ///         pending move.
+            /// 
+            uint64_t m_pending_move_time_ns;
+
+            /// 
+            /// @brief  Creates an event manager for the given SDL window.
+            /// 
+            /// @param  window  a pointer to the SDL window whose events will be managed
+            /// 
+            sdl_window_event_manager(sdl_window *window) noexcept;
+
+            /// 
+            /// @brief      Handles an SDL window event and notifies the proper handler of the event.
+            ///             Events that are not window related will be ignored. Resize and move
+            ///             events are only recorded; handlers are notified of them when deferred
+            ///             events are flushed. Notifications are stamped with the SDL timestamp of
+            ///             the event.
+            /// 
+            /// @param      event   the SDL event
+            /// 
+            /// @return     true if and only if the event left a notification pending when none
+            ///             was pending before, i.e. the deferred events must be flushed at the end
+            ///             of the poll cycle
+            /// 
+            bool handle_sdl_event(const SDL_Event &event) noexcept;
+
+            /// 
+            /// @brief      Notifies handlers of the resize and move that are pending (if any). The
+            ///             final bounds and positions of the window are read once.
+            /// 
+            void flush_deferred_events(void) noexcept;
+
+        public:
+            /// 
+            /// @brief  Reads the SDL clock, which SDL stamps events with.
+            /// 
+            /// @return the number of nanoseconds since SDL was initialized
+            /// 
+            virtual uint64_t now_ns(void) const noexcept override;
+
+            /// 
+            /// @brief  Determines how many resize and move events have been folded into an already
+            ///         pending notification instead of being dispatched on their own.
+            /// 
+            /// @return the number of coalesced events
+            /// 
+            size_t coalesced_event_count(void) const noexcept;
     };
 }
 
@@ -11,14 +11,25 @@
 /// 
 
 #include "window_manager.hpp"
+#include "../../utils/trace.hpp"
 
 using namespace std;
 
 namespace leaf
 {
-    const set<managed_window *> &window_manager::windows(void) const noexcept
+    window_manager::window_manager(void) noexcept
+        // Initially no windows are managed, so none are alive, and no frames are executed.
+        : m_living_window_count(0), m_frame_hook(NULL) {}
+
+    void window_manager::window_closed(void) noexcept
+    {
+        // One less managed window is alive.
+        m_living_window_count--;
+    }
+
+    const utl::slot_map<managed_window *> &window_manager::windows(void) const noexcept
     {
-        // Return a reference to the set of managed windows.
+        // Return a reference to the registry of managed windows.
         return m_windows;
     }
 
@@ -31,10 +42,25 @@ namespace leaf
                 "Failed to register managed window. (Given window pointer was null)");
         }
 
-        // Add the window at the given pointer to the set of managed windows. Return the second flag
-        // in the pair denoting whether the insertion was successful or if the pointer was already
-        // present in the set.
-        return m_windows.insert(window).second;
+        // If the window is already registered with this manager, there is nothing to do.
+        if (window->m_manager == this)
+        {
+            return false;
+        }
+
+        // Add the window at the given pointer to the registry and give the window its handle so
+        // that it can later be unregistered without a search.
+        window->m_handle = m_windows.insert(window);
+        window->m_manager = this;
+
+        // If the window is alive, count it.
+        if (window->is_alive())
+        {
+            m_living_window_count++;
+        }
+
+        // Return true indicating that the window is now being managed.
+        return true;
     }
             
     bool window_manager::unregister_window(managed_window *window)
@@ -46,56 +72,91 @@ namespace leaf
                 "Failed to unregister managed window. (Given window pointer was null)");
         }
 
-        // Remove the window at the given pointer from the set of managed windows. Return the number
-        // of pointers erased casted as a boolean. This means that a true value indicates that a
-        // window was successfully unregistered from the set.
-        return m_windows.erase(window);
+        // If the window is not registered with this manager, there is nothing to do.
+        if (window->m_manager != this)
+        {
+            return false;
+        }
+
+        // Remove the window's entry from the registry. Any outstanding copies of its handle become
+        // stale.
+        m_windows.erase(window->m_handle);
+
+        // If the window is still alive, it no longer counts towards the living windows.
+        if (window->is_alive())
+        {
+            m_living_window_count--;
+        }
+
+        // Detach the window from the manager.
+        window->m_handle = utl::slot_handle_t();
+        window->m_manager = NULL;
+
+        // Return true indicating that the window was unregistered.
+        return true;
     }
 
-    size_t window_manager::poll_windows(void) const
+    size_t window_manager::poll_windows(void)
     {
-        // Initialize a living window counter.
-        size_t living_window_count = 0;
+        LEAF_TRACE_ZONE("window_manager::poll_windows");
 
-        // For each window under management, poll its events and check whether it is still alive
-        // after its events are polled.
+        // For each window under management, poll its events. Windows that close while polling
+        // report it to the manager, so the living window counter stays accurate.
         for (managed_window *window : m_windows)
         {
-            // Try to poll the window's events. If the window is alive when events are polled and is
-            // still alive after events are polled, increment the counter.
-            if (window->poll_events())
-            {
-                living_window_count++;
-            }
+            window->poll_events();
         }
 
-        // Return the counter.
-        return living_window_count;
+        // Return the number of windows still alive.
+        return m_living_window_count;
+    }
+
+    bool window_manager::run_frame_hook(int32_t timeout_ms) noexcept
+    {
+        // If there is no frame hook, there is nothing to execute.
+        if (!m_frame_hook)
+        {
+            return false;
+        }
+
+        // Execute the next frame if one arrives within the timeout.
+        return m_frame_hook(timeout_ms);
     }
 
     size_t window_manager::window_count(void) const noexcept
     {
-        // Count the number of windows in the set of windows.
+        // Count the number of windows in the registry.
         return m_windows.size();
     }
 
     size_t window_manager::living_window_count(void) const noexcept
     {
-        // Initialize a living window counter.
-        size_t living_window_count = 0;
+        // Return the maintained counter.
+        return m_living_window_count;
+    }
 
-        // For each window under management, check if it is alive.
-        for (const managed_window *window : m_windows)
-        {
-            // If the window is alive, increment the counter.
-            if (window->is_alive())
-            {
-                living_window_count++;
-            }
-        }
+    managed_window *window_manager::window(const utl::slot_handle_t &handle) const noexcept
+    {
+        // Resolve the handle in the registry. A stale or null handle resolves to nothing.
+        managed_window *const *window = m_windows.get(handle);
 
-        // Return the counter.
-        return living_window_count;
+        // Return the window pointer if the handle resolved, otherwise null.
+        return window ? *window : NULL;
+    }
+
+    bool window_manager::has_frame_hook(void) const noexcept
+    {
+        // A frame hook is set if the pointer is not null.
+        return m_frame_hook != NULL;
+    }
+
+    window_manager *window_manager::set_frame_hook(frame_hook_t frame_hook) noexcept
+    {
+        // Store the function, replacing any previous one.
+        m_frame_hook = frame_hook;
+
+        // Return a pointer to the window manager for chaining.
+        return this;
     }
 
     size_t window_manager::close_all_windows(void) noexcept
@@ -20,30 +20,80 @@ namespace leaf
     class window_manager;
 }
 
-#include <set>
+#include "../../utils/slot_map.hpp"
 #include "managed_window.hpp"
 
+/// 
+/// @brief  A wait timeout that causes a window manager to wait for events indefinitely.
+/// 
+#define LEAF_WINDOW_MANAGER_WAIT_FOREVER (int32_t)-1
+
+/// 
+/// @brief  The longest time in milliseconds a window manager waits for a frame through its frame
+///         hook before handling events, so that events are still handled promptly while a frame
+///         takes long to build.
+/// 
+#define LEAF_WINDOW_MANAGER_FRAME_WAIT_MS 16
+
 namespace leaf
 {
+    /// 
+    /// @brief  A function the event loop of a window manager calls to execute work that must run on
+    ///         the thread that handles events, such as the frames of a renderer whose render thread
+    ///         is that thread.
+    /// 
+    /// @param  timeout_ms  the longest time in milliseconds to wait for a frame, or 0 to execute
+    ///                     one only if it is already available
+    /// 
+    /// @return true if and only if a frame was executed
+    /// 
+    typedef bool (*frame_hook_t)(int32_t timeout_ms);
+
     /// 
     /// @brief  Represents a manager for graphical user interface windows. The class creates a
     ///         singleton object, i.e. only one window manager object can be created.
     /// 
     class window_manager
     {
+        // Managed windows must be able to report changes in their state to their manager.
+        friend class managed_window;
+
         private:
             /// 
-            /// @brief  Keeps a pointer for each window being managed.
+            /// @brief  Keeps a pointer for each window being managed. Pointers are stored densely
+            ///         and each window holds the generational handle of its own entry.
+            /// 
+            utl::slot_map<managed_window *> m_windows;
+
             /// 
-            std::set<managed_window *> m_windows;
+            /// @brief  The number of managed windows that are alive. It is maintained as windows
+            ///         are registered, unregistered, and closed.
+            /// 
+            size_t m_living_window_count;
+
+            /// 
+            /// @brief  The function the event loop calls to execute frames, or null if there is
+            ///         none.
+            /// 
+            frame_hook_t m_frame_hook;
+
+            /// 
+            /// @brief  Records that a managed window has been closed.
+            /// 
+            void window_closed(void) noexcept;
         
         protected:
             /// 
-            /// @brief  Returns a reference to the set of all windows under management.
+            /// @brief  Creates a window manager with no windows under management.
             /// 
-            /// @return a reference to the set of all windows under management
+            window_manager(void) noexcept;
+
+            /// 
+            /// @brief  Returns a reference to the registry of all windows under management.
+            /// 
+            /// @return a reference to the registry of all windows under management
             /// 
-            const std::set<managed_window *> &windows(void) const noexcept;
+            const utl::slot_map<managed_window *> &windows(void) const noexcept;
 
             /// 
             /// @brief  Adds the given window to the set of managed windows.
@@ -74,7 +124,17 @@ namespace leaf
             /// 
             /// @throw  exception if any window failed to poll events
             /// 
-            size_t poll_windows(void) const;
+            size_t poll_windows(void);
+
+            /// 
+            /// @brief  Executes a frame through the frame hook, waiting for it up to the given
+            ///         timeout. If there is no frame hook, nothing happens.
+            /// 
+            /// @param  timeout_ms  the longest time in milliseconds to wait for a frame
+            /// 
+            /// @return true if and only if a frame was executed
+            /// 
+            bool run_frame_hook(int32_t timeout_ms) noexcept;
 
         public:
             /// 
@@ -91,6 +151,16 @@ namespace leaf
             /// 
             size_t living_window_count(void) const noexcept;
 
+            /// 
+            /// @brief  Finds the managed window a handle refers to. Handles of windows that have
+            ///         since been unregistered do not resolve.
+            /// 
+            /// @param  handle  the handle of the window
+            /// 
+            /// @return a pointer to the window or null if the handle is stale or null
+            /// 
+            managed_window *window(const utl::slot_handle_t &handle) const noexcept;
+
             /// 
             /// @brief  Performs updates on the window manager. This will poll the events of each
             ///         individual living managed window as well as perform any necessary window
@@ -102,6 +172,48 @@ namespace leaf
             /// 
             virtual bool poll_events(void) = 0;
 
+            /// 
+            /// @brief  Waits until at least one event occurs, the timeout elapses, or the window
+            ///         manager is woken, then performs the same updates as polling events. Unlike
+            ///         polling in a loop, the calling thread sleeps while no events occur.
+            /// 
+            /// @param  timeout_ms  the maximum number of milliseconds to wait or
+            ///                     LEAF_WINDOW_MANAGER_WAIT_FOREVER to wait without a timeout
+            /// 
+            /// @return true if and only if at least one living window is under management
+            /// 
+            /// @throw  exception if an error occured waiting for or polling events
+            /// 
+            virtual bool wait_events(int32_t timeout_ms) = 0;
+
+            /// 
+            /// @brief  Wakes a thread that is waiting for events so that it returns promptly. This
+            ///         may be called from any thread. Waking a window manager that is not waiting
+            ///         causes its next wait to return immediately.
+            /// 
+            /// @return true if and only if the wake was delivered
+            /// 
+            virtual bool wake(void) noexcept = 0;
+
+            /// 
+            /// @brief  Determines whether a frame hook is set.
+            /// 
+            /// @return true if and only if the event loop executes frames through a frame hook
+            /// 
+            bool has_frame_hook(void) const noexcept;
+
+            /// 
+            /// @brief  Sets the function the event loop calls to execute frames. While it is set,
+            ///         polling executes a frame that is already available, and waiting waits for
+            ///         the next frame instead of for an event. It must be cleared once whatever it
+            ///         executes frames for is gone.
+            /// 
+            /// @param  frame_hook  the function to call or null to clear it
+            /// 
+            /// @return a pointer to the window manager
+            /// 
+            window_manager *set_frame_hook(frame_hook_t frame_hook) noexcept;
+
             /// 
             /// @brief  Performs a close call on all living managed windows. Note that this does not
             ///         immediately destroy them, it simply instructs them to close the next time
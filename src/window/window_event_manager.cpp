@@ -10,129 +10,337 @@
 /// @copyright  Copyright (c) 2023
 /// 
 
+#include <algorithm>
+#include <chrono>
 #include "window_event_manager.hpp"
 
+using namespace std;
+
 namespace leaf
 {
+    // Name each dispatch zone after the event type, in the order of the enumeration.
+    const char *const
+        window_event_manager::f_dispatch_zone_names[(size_t)window_event_type::count] =
+    {
+        "dispatch closed",
+        "dispatch user_requested_close",
+        "dispatch resized",
+        "dispatch moved",
+        "dispatch hidden",
+        "dispatch shown",
+        "dispatch minimized",
+        "dispatch maximized",
+        "dispatch entered_fullscreen",
+        "dispatch exited_fullscreen"
+    };
+
+    window_event_manager::window_event_manager(void) noexcept
+        // Initially no dispatch is in progress and the dispatch tables hold no null entries. No
+        // event time is known. Metrics are not collected until asked for, so that dispatch does
+        // not read the clock around every handler.
+        : m_dispatch_depth(0), m_has_null_entries(false), m_event_time_ns(0),
+        m_collects_metrics(false) {}
+
+    uint64_t window_event_manager::now_ns(void) const noexcept
+    {
+        // Read the monotonic clock in nanoseconds.
+        return (uint64_t)chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void window_event_manager::set_event_time(uint64_t time_ns) noexcept
+    {
+        // Stamp the events dispatched next.
+        m_event_time_ns = time_ns;
+    }
+
+    uint64_t window_event_manager::event_time_ns(void) const noexcept
+    {
+        // Return the stamp of the event being dispatched.
+        return m_event_time_ns;
+    }
+
+    const utl::latency_histogram &window_event_manager::event_latency(void) const noexcept
+    {
+        // Return the event latency histogram.
+        return m_event_latency;
+    }
+
+    const utl::latency_histogram &window_event_manager::handler_duration(void) const noexcept
+    {
+        // Return the handler duration histogram.
+        return m_handler_duration;
+    }
+
+    bool window_event_manager::collects_metrics(void) const noexcept
+    {
+        // Return whether metrics are collected.
+        return m_collects_metrics;
+    }
+
+    window_event_manager *window_event_manager::set_collects_metrics(bool collects_metrics)
+        noexcept
+    {
+        // Set whether metrics are collected.
+        m_collects_metrics = collects_metrics;
+
+        // Return a pointer to the window event manager.
+        return this;
+    }
+
+    void window_event_manager::reset_metrics(void) noexcept
+    {
+        // Clear both histograms.
+        m_event_latency.reset();
+        m_handler_duration.reset();
+    }
+
+    void window_event_manager::add_to_dispatch_tables(
+        const window_event_subscription_t &subscription) noexcept
+    {
+        // Append the handler to the dispatch table of each event type the subscription selects.
+        for (size_t type = 0; type < (size_t)window_event_type::count; type++)
+        {
+            if (subscription.mask & window_event_mask((window_event_type)type))
+            {
+                m_dispatch_tables[type].push_back(subscription.handler);
+            }
+        }
+    }
+
+    void window_event_manager::apply_deferred_subscriptions(void) noexcept
+    {
+        // Remove the null entries left by handlers that were unsubscribed during a dispatch.
+        if (m_has_null_entries)
+        {
+            for (vector<window_event_handler_i *> &table : m_dispatch_tables)
+            {
+                table.erase(remove(table.begin(), table.end(), nullptr), table.end());
+            }
+
+            m_has_null_entries = false;
+        }
+
+        // Add the subscriptions made during a dispatch to the dispatch tables.
+        for (const window_event_subscription_t &subscription : m_pending_subscriptions)
+        {
+            add_to_dispatch_tables(subscription);
+        }
+
+        m_pending_subscriptions.clear();
+    }
+
     void window_event_manager::closed(void) noexcept
     {
-        // Loop through all window event handlers and notify them of the event.
-        for (window_event_handler_i *handler : m_window_event_handlers)
+        // Notify every handler subscribed to the event type.
+        dispatch(window_event_type::closed, [&](window_event_handler_i *handler)
         {
             handler->closed();
-        }
+        });
     }
 
     void window_event_manager::user_requested_close(void) noexcept
     {
-        // Loop through all window event handlers and notify them of the event.
-        for (window_event_handler_i *handler : m_window_event_handlers)
+        // Notify every handler subscribed to the event type.
+        dispatch(window_event_type::user_requested_close, [&](window_event_handler_i *handler)
         {
             handler->user_requested_close();
-        }
+        });
     }
 
     void window_event_manager::resized(const bounds2_t &new_bounds) noexcept
     {
-        // Loop through all window event handlers and notify them of the event.
-        for (window_event_handler_i *handler : m_window_event_handlers)
+        // Notify every handler subscribed to the event type.
+        dispatch(window_event_type::resized, [&](window_event_handler_i *handler)
         {
             handler->resized(new_bounds);
-        }
+        });
     }
 
     void window_event_manager::moved(const pos2_t &new_pos, const pos2_t &new_frame_pos) noexcept
     {
-        // Loop through all window event handlers and notify them of the event.
-        for (window_event_handler_i *handler : m_window_event_handlers)
+        // Notify every handler subscribed to the event type.
+        dispatch(window_event_type::moved, [&](window_event_handler_i *handler)
         {
             handler->moved(new_pos, new_frame_pos);
-        }
+        });
     }
             
     void window_event_manager::hidden(void) noexcept
     {
-        // Loop through all window event handlers and notify them of the event.
-        for (window_event_handler_i *handler : m_window_event_handlers)
+        // Notify every handler subscribed to the event type.
+        dispatch(window_event_type::hidden, [&](window_event_handler_i *handler)
         {
             handler->hidden();
-        }
+        });
     }
 
     void window_event_manager::shown(void) noexcept
     {
-        // Loop through all window event handlers and notify them of the event.
-        for (window_event_handler_i *handler : m_window_event_handlers)
+        // Notify every handler subscribed to the event type.
+        dispatch(window_event_type::shown, [&](window_event_handler_i *handler)
         {
             handler->shown();
-        }
+        });
     }
 
     void window_event_manager::minimized(void) noexcept
     {
-        // Loop through all window event handlers and notify them of the event.
-        for (window_event_handler_i *handler : m_window_event_handlers)
+        // Notify every handler subscribed to the event type.
+        dispatch(window_event_type::minimized, [&](window_event_handler_i *handler)
         {
             handler->minimized();
-        }
+        });
     }
             
     void window_event_manager::maximized() noexcept
     {
-        // Loop through all window event handlers and notify them of the event.
-        for (window_event_handler_i *handler : m_window_event_handlers)
+        // Notify every handler subscribed to the event type.
+        dispatch(window_event_type::maximized, [&](window_event_handler_i *handler)
         {
             handler->maximized();
-        }
+        });
     }
 
     void window_event_manager::entered_fullscreen(void) noexcept
     {
-        // Loop through all window event handlers and notify them of the event.
-        for (window_event_handler_i *handler : m_window_event_handlers)
+        // Notify every handler subscribed to the event type.
+        dispatch(window_event_type::entered_fullscreen, [&](window_event_handler_i *handler)
         {
             handler->entered_fullscreen();
-        }
+        });
     }
 
     void window_event_manager::exited_fullscreen(void) noexcept
     {
-        // Loop through all window event handlers and notify them of the event.
-        for (window_event_handler_i *handler : m_window_event_handlers)
+        // Notify every handler subscribed to the event type.
+        dispatch(window_event_type::exited_fullscreen, [&](window_event_handler_i *handler)
         {
             handler->exited_fullscreen();
-        }
+        });
     }
 
-    bool window_event_manager::subscribe(window_event_handler_i *window_event_handler) noexcept
+    bool window_event_manager::subscribe(
+        window_event_handler_i *window_event_handler, window_event_mask_t mask) noexcept
     {
-        // Add the event handler to the set so that it is subscribed to notifications. Return the
-        // second item in the return pair identifying whether the handler was inserted or if it
-        // already was in the set.
-        return m_window_event_handlers.insert(window_event_handler).second;
+        // If the handler is already subscribed, return false.
+        for (const window_event_subscription_t &subscription : m_window_event_subscriptions)
+        {
+            if (subscription.handler == window_event_handler)
+            {
+                return false;
+            }
+        }
+
+        // Record the subscription.
+        window_event_subscription_t subscription = {window_event_handler, mask};
+        m_window_event_subscriptions.push_back(subscription);
+
+        // If a dispatch is in progress, the dispatch tables must not change until it finishes, so
+        // defer adding the handler. Otherwise add it immediately.
+        if (m_dispatch_depth)
+        {
+            m_pending_subscriptions.push_back(subscription);
+        }
+        else
+        {
+            add_to_dispatch_tables(subscription);
+        }
+
+        // Return true indicating that the handler was subscribed.
+        return true;
     }
             
     bool window_event_manager::subscribe(key_event_handler_i *key_event_handler) noexcept
     {
-        // Add the event handler to the set so that it is subscribed to notifications. Return the
-        // second item in the return pair identifying whether the handler was inserted or if it
-        // already was in the set.
-        return m_key_event_handlers.insert(key_event_handler).second;
+        // If the handler is already subscribed, return false.
+        if (find(m_key_event_handlers.begin(), m_key_event_handlers.end(), key_event_handler)
+            != m_key_event_handlers.end())
+        {
+            return false;
+        }
+
+        // Add the handler to the list so that it is subscribed to notifications.
+        m_key_event_handlers.push_back(key_event_handler);
+
+        // Return true indicating that the handler was subscribed.
+        return true;
     }
 
     bool window_event_manager::unsubscribe(window_event_handler_i *window_event_handler) noexcept
     {
-        // Remove the event handler from the set so that it is no longer subscribed to
-        // notifications. Return the number of erased items cast to a boolean so that it will yield
-        // false if no item could be erased.
-        return m_window_event_handlers.erase(window_event_handler);
+        // Find the handler's subscription. If it is not subscribed, return false.
+        vector<window_event_subscription_t>::iterator subscription = find_if(
+            m_window_event_subscriptions.begin(), m_window_event_subscriptions.end(),
+            [=](const window_event_subscription_t &subscription)
+            {
+                return subscription.handler == window_event_handler;
+            });
+
+        if (subscription == m_window_event_subscriptions.end())
+        {
+            return false;
+        }
+
+        // Remember which event types the handler was subscribed to and remove the subscription.
+        window_event_mask_t mask = subscription->mask;
+        m_window_event_subscriptions.erase(subscription);
+
+        // If the subscription was made during the current dispatch, it has not reached the
+        // dispatch tables yet. Discarding the pending subscription is enough.
+        for (vector<window_event_subscription_t>::iterator pending =
+            m_pending_subscriptions.begin(); pending != m_pending_subscriptions.end(); pending++)
+        {
+            if (pending->handler == window_event_handler)
+            {
+                m_pending_subscriptions.erase(pending);
+                return true;
+            }
+        }
+
+        // Remove the handler from the dispatch table of each event type it was subscribed to. If a
+        // dispatch is in progress, null the entry instead so that table indices do not shift.
+        for (size_t type = 0; type < (size_t)window_event_type::count; type++)
+        {
+            if (!(mask & window_event_mask((window_event_type)type)))
+            {
+                continue;
+            }
+
+            vector<window_event_handler_i *> &table = m_dispatch_tables[type];
+            vector<window_event_handler_i *>::iterator entry =
+                find(table.begin(), table.end(), window_event_handler);
+
+            if (m_dispatch_depth)
+            {
+                *entry = nullptr;
+                m_has_null_entries = true;
+            }
+            else
+            {
+                table.erase(entry);
+            }
+        }
+
+        // Return true indicating that the handler was unsubscribed.
+        return true;
     }
 
     bool window_event_manager::unsubscribe(key_event_handler_i *key_event_handler) noexcept
     {
-        // Remove the event handler from the set so that it is no longer subscribed to
-        // notifications. Return the number of erased items cast to a boolean so that it will yield
-        // false if no item could be erased.
-        return m_key_event_handlers.erase(key_event_handler);
+        // Find the handler. If it is not subscribed, return false.
+        vector<key_event_handler_i *>::iterator handler =
+            find(m_key_event_handlers.begin(), m_key_event_handlers.end(), key_event_handler);
+
+        if (handler == m_key_event_handlers.end())
+        {
+            return false;
+        }
+
+        // Remove the handler from the list so that it is no longer subscribed to notifications.
+        m_key_event_handlers.erase(handler);
+
+        // Return true indicating that the handler was unsubscribed.
+        return true;
     }
 }
@@ -4,7 +4,8 @@
 /// @date       May 12, 2023
 /// 
 /// @brief      Header for a class that represents a manager for window events. Event handlers can
-///             be subscribed and unsubscribed. Windows can notify the manager of events.
+///             be subscribed and unsubscribed. Windows can notify the manager of events. The
+///             latency and duration of every handler notification can be measured.
 /// 
 /// @copyright  Copyright (c) 2023
 /// 
@@ -12,8 +13,13 @@
 #ifndef LEAF_SRC_WINDOW_EVENT_MANAGER_HEADER_GUARD
 #define LEAF_SRC_WINDOW_EVENT_MANAGER_HEADER_GUARD
 
-#include <set>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
 #include "../utils/unique.hpp"
+#include "../utils/latency_histogram.hpp"
+#include "../utils/trace.hpp"
+#include "../event_handler/window_event_types.hpp"
 #include "../event_handler/window_event_handler_i.hpp"
 #include "../event_handler/key_event_handler_i.hpp"
 
@@ -23,21 +29,278 @@ namespace leaf
     /// @brief  Represents a manager for window events. Event handlers can be subscribed and
     ///         unsubscribed. Windows can notify the manager of events.
     ///
+    ///         Windows stamp each event with the time it occured before notifying the manager.
+    ///         While the event is dispatched, handlers can read the stamp to tell how stale the
+    ///         event is. If enabled, the manager records two histograms per window: the
+    ///         latency from the time each event occured to the invocation of each handler, and
+    ///         the duration of each handler invocation.
+    ///
     class window_event_manager : public utl::unique,
         virtual protected window_event_handler_i, virtual protected key_event_handler_i
     {
         private:
             /// 
-            /// @brief  A set containing all of the subscribed window event handlers.
+            /// @brief  Represents the subscription of a window event handler to a selection of
+            ///         window event types.
+            /// 
+            typedef struct window_event_subscription
+            {
+                /// 
+                /// @brief  A pointer to the subscribed window event handler.
+                /// 
+                window_event_handler_i *handler;
+
+                /// 
+                /// @brief  The window event types the handler is notified of.
+                /// 
+                window_event_mask_t mask;
+
+            } window_event_subscription_t;
+
+            /// 
+            /// @brief  Determines the class that declares a member given a pointer to the member.
+            /// 
+            /// @tparam M   the type of the member pointer
+            /// 
+            template<typename M> struct member_class;
+
+            /// 
+            /// @brief  Determines the class that declares a member given a pointer to the member.
+            /// 
+            /// @tparam R   the type of the member
+            /// @tparam C   the class that declares the member
+            /// 
+            template<typename R, typename C> struct member_class<R C::*>
+            {
+                typedef C type;
+            };
+
+            ///
+            /// @brief  The name of the trace zone of a dispatch for each window event type.
+            ///
+            static const char *const f_dispatch_zone_names[(size_t)window_event_type::count];
+
+            /// 
+            /// @brief  A list of all subscribed window event handlers and the event types each is
+            ///         subscribed to, in subscription order.
+            /// 
+            std::vector<window_event_subscription_t> m_window_event_subscriptions;
+
+            /// 
+            /// @brief  A contiguous dispatch table for each window event type. Each table holds
+            ///         only the handlers subscribed to that event type, in subscription order.
+            ///         Entries of handlers unsubscribed during a dispatch are set to null until the
+            ///         dispatch finishes.
+            /// 
+            std::vector<window_event_handler_i *>
+                m_dispatch_tables[(size_t)window_event_type::count];
+
+            /// 
+            /// @brief  Subscriptions made during a dispatch. They are added to the dispatch tables
+            ///         once the outermost dispatch finishes.
+            /// 
+            std::vector<window_event_subscription_t> m_pending_subscriptions;
+
+            /// 
+            /// @brief  The number of dispatches currently in progress. It is greater than 1 if a
+            ///         handler causes another event to be dispatched.
+            /// 
+            unsigned int m_dispatch_depth;
+
+            /// 
+            /// @brief  Denotes whether a handler was unsubscribed during a dispatch, leaving null
+            ///         entries in the dispatch tables.
+            /// 
+            bool m_has_null_entries;
+
+            /// 
+            /// @brief  The time in nanoseconds the event being dispatched occured at according to
+            ///         now_ns, or 0 if it is unknown.
+            /// 
+            uint64_t m_event_time_ns;
+
+            /// 
+            /// @brief  Denotes whether the latency and duration of handler notifications are
+            ///         measured.
+            /// 
+            bool m_collects_metrics;
+
+            /// 
+            /// @brief  The latency from the time each event occured to the invocation of each
+            ///         handler. Events of unknown time are not measured.
+            /// 
+            utl::latency_histogram m_event_latency;
+
+            /// 
+            /// @brief  The duration of each handler invocation.
+            /// 
+            utl::latency_histogram m_handler_duration;
+
+            /// 
+            /// @brief  A list containing all of the subscribed keybaord event handlers.
             /// 
-            std::set<window_event_handler_i *> m_window_event_handlers;
+            std::vector<key_event_handler_i *> m_key_event_handlers;
+
+            /// 
+            /// @brief  Adds a subscription to the dispatch tables of the event types it selects.
+            /// 
+            /// @param  subscription    the subscription to add
+            /// 
+            void add_to_dispatch_tables(const window_event_subscription_t &subscription) noexcept;
+
+            /// 
+            /// @brief  Applies subscription changes that were deferred while dispatching. Null
+            ///         entries are removed and pending subscriptions are added.
+            /// 
+            void apply_deferred_subscriptions(void) noexcept;
+
+            /// 
+            /// @brief  Notifies every handler in the dispatch table of the given event type.
+            ///         Handlers may subscribe and unsubscribe while being notified. Unsubscribed
+            ///         handlers are not notified for the rest of the dispatch, new subscribers are
+            ///         first notified of the next event.
+            /// 
+            /// @tparam F       the type of the notification function
+            /// @param  type    the window event type to dispatch
+            /// @param  notify  a function that notifies a single handler of the event
+            /// 
+            template<typename F> inline void dispatch(window_event_type type, F notify) noexcept
+            {
+                LEAF_TRACE_ZONE(f_dispatch_zone_names[(size_t)type]);
+
+                // Get the dispatch table of the event type.
+                std::vector<window_event_handler_i *> &table = m_dispatch_tables[(size_t)type];
+
+                // Mark that a dispatch is in progress so subscription changes are deferred. The
+                // table will not grow during the dispatch, so its size can be read once.
+                m_dispatch_depth++;
+
+                // Read the event time and whether to measure once. When measuring, the time a
+                // handler returns is also the time the next handler is invoked, so the clock is
+                // read once per handler.
+                uint64_t event_time_ns = m_event_time_ns;
+                bool collects_metrics = m_collects_metrics;
+                uint64_t time_ns = collects_metrics ? now_ns() : 0;
 
+                for (size_t i = 0, count = table.size(); i < count; i++)
+                {
+                    // Skip handlers that were unsubscribed during the dispatch.
+                    if (!table[i])
+                    {
+                        continue;
+                    }
+
+                    if (!collects_metrics)
+                    {
+                        notify(table[i]);
+                        continue;
+                    }
+
+                    // Measure how stale the event is when the handler is invoked, then how long
+                    // the handler takes.
+                    if (event_time_ns && time_ns >= event_time_ns)
+                    {
+                        m_event_latency.record(time_ns - event_time_ns);
+                    }
+
+                    notify(table[i]);
+
+                    uint64_t end_time_ns = now_ns();
+                    m_handler_duration.record(end_time_ns - time_ns);
+                    time_ns = end_time_ns;
+                }
+
+                // Once the outermost dispatch finishes, apply deferred subscription changes.
+                if (--m_dispatch_depth == 0
+                    && (m_has_null_entries || !m_pending_subscriptions.empty()))
+                {
+                    apply_deferred_subscriptions();
+                }
+            }
+
+            /// 
+            /// @brief  Determines whether a member pointer refers to a method declared by a class
+            ///         other than the window event handler interface.
             /// 
-            /// @brief  A set containing all of the subscribed keybaord event handlers.
+            /// @tparam M   the type of the member pointer
             /// 
-            std::set<key_event_handler_i *> m_key_event_handlers;
+            /// @return true if and only if the method is declared outside of the interface
+            /// 
+            template<typename M> static constexpr bool is_overridden(void) noexcept
+            {
+                // Compare the declaring class against the interface.
+                return !std::is_same<typename member_class<M>::type, window_event_handler_i>::value;
+            }
+
+            // Defines a trait that determines whether a handler type overrides the notification
+            // method with the given name. The interface declares every notification method public,
+            // so if the method cannot be accessed through the handler type it must have been
+            // overridden with narrower access.
+            #define LEAF_WINDOW_EVENT_OVERRIDE_TRAIT(method)                                    \
+                template<typename H, typename = void> struct overrides_##method                 \
+                    : std::true_type {};                                                        \
+                template<typename H> struct overrides_##method<H, decltype((void)&H::method)>   \
+                    : std::integral_constant<bool, is_overridden<decltype(&H::method)>()> {};
+
+            LEAF_WINDOW_EVENT_OVERRIDE_TRAIT(closed)
+            LEAF_WINDOW_EVENT_OVERRIDE_TRAIT(user_requested_close)
+            LEAF_WINDOW_EVENT_OVERRIDE_TRAIT(resized)
+            LEAF_WINDOW_EVENT_OVERRIDE_TRAIT(moved)
+            LEAF_WINDOW_EVENT_OVERRIDE_TRAIT(hidden)
+            LEAF_WINDOW_EVENT_OVERRIDE_TRAIT(shown)
+            LEAF_WINDOW_EVENT_OVERRIDE_TRAIT(minimized)
+            LEAF_WINDOW_EVENT_OVERRIDE_TRAIT(maximized)
+            LEAF_WINDOW_EVENT_OVERRIDE_TRAIT(entered_fullscreen)
+            LEAF_WINDOW_EVENT_OVERRIDE_TRAIT(exited_fullscreen)
+
+            #undef LEAF_WINDOW_EVENT_OVERRIDE_TRAIT
+
+            /// 
+            /// @brief  Determines which window event notification methods a handler type overrides.
+            /// 
+            /// @tparam H   the type of the window event handler
+            /// 
+            /// @return a window event mask selecting each event type whose notification method is
+            ///         overridden
+            /// 
+            template<typename H> static constexpr window_event_mask_t overridden_window_events(void)
+                noexcept
+            {
+                // Check each notification method and select the event types that are overridden.
+                return
+                    (overrides_closed<H>::value
+                        ? window_event_mask(window_event_type::closed) : 0)
+                    | (overrides_user_requested_close<H>::value
+                        ? window_event_mask(window_event_type::user_requested_close) : 0)
+                    | (overrides_resized<H>::value
+                        ? window_event_mask(window_event_type::resized) : 0)
+                    | (overrides_moved<H>::value
+                        ? window_event_mask(window_event_type::moved) : 0)
+                    | (overrides_hidden<H>::value
+                        ? window_event_mask(window_event_type::hidden) : 0)
+                    | (overrides_shown<H>::value
+                        ? window_event_mask(window_event_type::shown) : 0)
+                    | (overrides_minimized<H>::value
+                        ? window_event_mask(window_event_type::minimized) : 0)
+                    | (overrides_maximized<H>::value
+                        ? window_event_mask(window_event_type::maximized) : 0)
+                    | (overrides_entered_fullscreen<H>::value
+                        ? window_event_mask(window_event_type::entered_fullscreen) : 0)
+                    | (overrides_exited_fullscreen<H>::value
+                        ? window_event_mask(window_event_type::exited_fullscreen) : 0);
+            }
         
         protected:            
+            /// 
+            /// @brief  Stamps the events that are dispatched next with the time they occured.
+            ///         Windows call this before notifying the manager of an event, and reset the
+            ///         time to 0 once they are done.
+            /// 
+            /// @param  time_ns the time in nanoseconds the event occured at according to now_ns,
+            ///                 or 0 if it is unknown
+            /// 
+            void set_event_time(uint64_t time_ns) noexcept;
+
             /// 
             /// @brief  Notifies all handlers that the window was closed either by the user or
             ///         automatically. This indicates a full window destruction has finished.
@@ -111,6 +374,11 @@ namespace leaf
             virtual void exited_fullscreen(void) noexcept override;
         
         public:
+            /// 
+            /// @brief  Creates a window event manager with no subscribed handlers.
+            /// 
+            window_event_manager(void) noexcept;
+
             /// 
             /// @brief  Destructs the window event manager object.
             /// 
@@ -118,15 +386,97 @@ namespace leaf
             ///         declared default to ensure that it is virtual.
             /// 
             virtual ~window_event_manager() noexcept = default;
+
+            /// 
+            /// @brief  Reads the clock events are stamped with. By default this is a monotonic
+            ///         clock. Managers for windows whose library stamps events with its own clock
+            ///         override it to read that clock.
+            /// 
+            /// @return the current time in nanoseconds
+            /// 
+            virtual uint64_t now_ns(void) const noexcept;
+
+            /// 
+            /// @brief  Determines when the event being dispatched occured. Handlers can compare
+            ///         this against now_ns to tell how stale the event is. Coalesced resizes and
+            ///         moves are stamped with the time of the last event folded into them.
+            /// 
+            /// @return the time in nanoseconds the event occured at according to now_ns, or 0 if
+            ///         it is unknown or no event is being dispatched
+            /// 
+            uint64_t event_time_ns(void) const noexcept;
+
+            /// 
+            /// @brief  Returns the histogram of latencies from the time each event occured to the
+            ///         invocation of each handler it was dispatched to.
+            /// 
+            /// @return a reference to the event latency histogram
+            /// 
+            const utl::latency_histogram &event_latency(void) const noexcept;
+
+            /// 
+            /// @brief  Returns the histogram of the durations of handler invocations.
+            /// 
+            /// @return a reference to the handler duration histogram
+            /// 
+            const utl::latency_histogram &handler_duration(void) const noexcept;
+
+            /// 
+            /// @brief  Determines whether the latency and duration of handler notifications are
+            ///         measured. They are not by default.
+            /// 
+            /// @return true if and only if metrics are collected
+            /// 
+            bool collects_metrics(void) const noexcept;
+
+            /// 
+            /// @brief  Sets whether the latency and duration of handler notifications are
+            ///         measured. Enabling this reads the clock around every handler.
+            /// 
+            /// @param  collects_metrics    whether metrics are collected
+            /// 
+            /// @return a pointer to the window event manager
+            /// 
+            window_event_manager *set_collects_metrics(bool collects_metrics) noexcept;
+
+            /// 
+            /// @brief  Removes every measurement from the latency and duration histograms.
+            /// 
+            void reset_metrics(void) noexcept;
             
             /// 
-            /// @brief  Subscribes a window event handler.
+            /// @brief  Subscribes a window event handler to a selection of window event types. The
+            ///         handler is only notified of the selected event types.
+            /// 
+            /// @param  window_event_handler    a pointer to the new window event handler
+            /// @param  mask                    the window event types to notify the handler of
+            /// 
+            /// @return true if and only if the event handler was not already subscribed
+            /// 
+            bool subscribe(window_event_handler_i *window_event_handler,
+                window_event_mask_t mask = LEAF_WINDOW_EVENT_MASK_ALL) noexcept;
+
+            /// 
+            /// @brief  Subscribes a window event handler to the window event types whose
+            ///         notification methods its type overrides. Events the handler type does not
+            ///         override are never dispatched to it.
+            /// 
+            /// @note   The overrides are those of the static type H, not of the object. The pointer
+            ///         must therefore be of the most derived handler type, since events that only
+            ///         a derived type overrides would otherwise never be dispatched.
             /// 
+            /// @tparam H                       the type of the window event handler
             /// @param  window_event_handler    a pointer to the new window event handler
             /// 
             /// @return true if and only if the event handler was not already subscribed
             /// 
-            bool subscribe(window_event_handler_i *window_event_handler) noexcept;
+            template<typename H> inline typename std::enable_if<
+                std::is_base_of<window_event_handler_i, H>::value, bool>::type
+                subscribe_overridden(H *window_event_handler) noexcept
+            {
+                // Delegate to the general subscription with the mask of overridden methods.
+                return subscribe(window_event_handler, overridden_window_events<H>());
+            }
             
             /// 
             /// @brief  Subscribes a keyboard event handler.